@@ -0,0 +1,768 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Measures the cost of the native APL client against a corpus of documents, without a viewhost or the rest of the
+ * SDK.  For every corpus document the benchmark reports:
+ *
+ * - document build time (content creation, import resolution and inflation),
+ * - inflations of the first and of later builds, which differ for a rescaled document retried with another supported
+ *   viewport specification,
+ * - per-frame @c onUpdateTick cost while idle,
+ * - time and dirty-property bytes needed to settle an update command sequence,
+ * - start latency and heap allocations of update command sequences executed back to back, each interrupting the
+ *   previous one as in a karaoke stream,
+ * - round trip from a viewhost press to the resulting SendEvent,
+ * - time a scripted scroll through a DynamicIndexList spends past the loaded items, waiting for a stand-in skill,
+ * - frames, dirty messages and dirty bytes needed to absorb a burst of DynamicIndexList pages.
+ *
+ * A corpus file is a JSON object of the form:
+ * @code
+ * {
+ *   "document": { ... },               // APL document (required)
+ *   "datasources": { ... },            // Document data sources
+ *   "supportedViewports": [ ... ],     // Supported viewport specifications
+ *   "viewport": { "width": 1280, "height": 800, "dpi": 160, "shape": "RECTANGLE", "mode": "HUB" },
+ *   "updateCommands": [ ... ],         // Commands executed for the update measurement
+ *   "eventComponentId": "button",      // Component pressed for the event measurement
+ *   "dynamicScroll": {                 // Scripted scroll through a DynamicIndexList
+ *     "componentId": "list",           // The scrolled component
+ *     "itemHeight": 100,               // Height of a list item in pixels
+ *     "viewportHeight": 800,           // Height of the scrolled component in pixels
+ *     "loadedItems": 20,               // Number of items in the initial data source
+ *     "listSize": 500,                 // Number of items the stand-in skill can serve
+ *     "pixelsPerFrame": 60,            // Scroll speed
+ *     "frames": 300,                   // Length of the scroll
+ *     "skillLatencyMs": 250            // Delay before the stand-in skill answers a fetch request
+ *   },
+ *   "dynamicBurst": {                  // Pages of a DynamicIndexList delivered back to back
+ *     "listId": "catalog",             // The list id
+ *     "loadedItems": 20,               // Number of items in the initial data source
+ *     "pages": 5,                      // Number of pages
+ *     "pageSize": 20                   // Number of items per page
+ *   }
+ * }
+ * @endcode
+ *
+ * Usage: APLClientBenchmark [corpusDirectory] [--iterations N] [--frames N] [--output file]
+ */
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <apl/apl.h>
+
+#include "APLClient/AplClientBinding.h"
+#include "BenchmarkAplOptions.h"
+
+using namespace APLClient;
+using namespace APLClient::benchmark;
+
+/// Default corpus directory, relative to the working directory.
+static const std::string DEFAULT_CORPUS_DIRECTORY = "corpus";
+/// Sub-directory of the corpus holding import packages.
+static const std::string PACKAGES_DIRECTORY = "packages";
+/// Default number of build iterations per document.
+static const int DEFAULT_ITERATIONS = 10;
+/// Default number of idle frames measured per document.
+static const int DEFAULT_FRAMES = 120;
+/// Frame interval used while waiting for commands and events to settle, matching the SampleApp update timer.
+static const std::chrono::milliseconds FRAME_INTERVAL{16};
+/// Maximum number of frames to wait for commands or events to settle.
+static const int MAX_SETTLE_FRAMES = 600;
+/// Token used for all documents.
+static const std::string BENCHMARK_TOKEN = "benchmark";
+/// Default viewport when the corpus file does not specify one.
+static const char DEFAULT_VIEWPORT[] =
+    R"({"width":1280,"height":800,"dpi":160,"shape":"RECTANGLE","mode":"HUB"})";
+/// Number of frames without dirty properties which end a page burst.
+static const int BURST_QUIET_FRAMES = 3;
+/// Message type carrying dirty properties.
+static const std::string DIRTY_MESSAGE_TYPE = "dirty";
+/// Message type sent once per inflation attempt with the chosen scaling.
+static const std::string SCALING_MESSAGE_TYPE = "scaling";
+/// Number of command sequences executed back to back per iteration.
+static const int COMMAND_STREAM_LENGTH = 20;
+
+/// Number of heap allocations so far.
+static std::atomic<long> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+/// Duration type used for all measurements.
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+/**
+ * Summary statistics of a series of samples.
+ */
+struct Summary {
+    double mean = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double max = 0;
+};
+
+/**
+ * Computes summary statistics.
+ *
+ * @param samples The samples, reordered by this call.
+ * @return The summary.
+ */
+static Summary summarize(std::vector<double>& samples) {
+    Summary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    double total = 0;
+    for (auto sample : samples) {
+        total += sample;
+    }
+    summary.mean = total / samples.size();
+    summary.p50 = samples[samples.size() / 2];
+    summary.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    summary.max = samples.back();
+    return summary;
+}
+
+/**
+ * Serializes a JSON value.
+ *
+ * @param value The value.
+ * @return The serialized value.
+ */
+static std::string serialize(const rapidjson::Value& value) {
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    value.Accept(writer);
+    return sb.GetString();
+}
+
+/**
+ * Reads a whole file.
+ *
+ * @param path The file path.
+ * @param[out] content The file content.
+ * @return Whether the file was read.
+ */
+static bool readFile(const std::string& path, std::string* content) {
+    std::ifstream file(path, std::ifstream::binary);
+    if (!file.good()) {
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    *content = buffer.str();
+    return true;
+}
+
+/**
+ * Lists the corpus documents in a directory.
+ *
+ * @param directory The corpus directory.
+ * @return The sorted paths of all ".json" files in the directory.
+ */
+static std::vector<std::string> listCorpus(const std::string& directory) {
+    std::vector<std::string> files;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return files;
+    }
+    while (auto entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0) {
+            files.push_back(directory + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+/**
+ * Writes a summary as a JSON object.
+ *
+ * @param writer The writer.
+ * @param name The member name.
+ * @param summary The summary.
+ */
+static void writeSummary(
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer,
+    const char* name,
+    const Summary& summary) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("mean");
+    writer.Double(summary.mean);
+    writer.Key("p50");
+    writer.Double(summary.p50);
+    writer.Key("p95");
+    writer.Double(summary.p95);
+    writer.Key("max");
+    writer.Double(summary.max);
+    writer.EndObject();
+}
+
+/**
+ * Builds a page of DynamicIndexList items as a skill would send it.
+ *
+ * @param listId The list id.
+ * @param correlationToken The correlation token of the answered fetch request, empty for an unsolicited page.
+ * @param startIndex Index of the first item.
+ * @param endIndex Index after the last item.
+ * @param listSize Number of items in the list.
+ * @return The serialized page.
+ */
+static std::string makeListPage(
+    const std::string& listId,
+    const std::string& correlationToken,
+    int startIndex,
+    int endIndex,
+    int listSize) {
+    rapidjson::Document page(rapidjson::kObjectType);
+    auto& alloc = page.GetAllocator();
+    rapidjson::Value items(rapidjson::kArrayType);
+    for (int index = startIndex; index < endIndex; index++) {
+        rapidjson::Value item(rapidjson::kObjectType);
+        auto title = "Item " + std::to_string(index);
+        auto subtitle = "Secondary text for catalog item number " + std::to_string(index);
+        item.AddMember("title", rapidjson::Value(title.c_str(), alloc).Move(), alloc);
+        item.AddMember("subtitle", rapidjson::Value(subtitle.c_str(), alloc).Move(), alloc);
+        items.PushBack(item, alloc);
+    }
+    page.AddMember("listId", rapidjson::Value(listId.c_str(), alloc).Move(), alloc);
+    if (!correlationToken.empty()) {
+        page.AddMember("correlationToken", rapidjson::Value(correlationToken.c_str(), alloc).Move(), alloc);
+    }
+    page.AddMember("startIndex", startIndex, alloc);
+    page.AddMember("minimumInclusiveIndex", 0, alloc);
+    page.AddMember("maximumExclusiveIndex", listSize, alloc);
+    page.AddMember("items", items, alloc);
+    return serialize(page);
+}
+
+/**
+ * Scrolls through a DynamicIndexList at a constant speed while a stand-in skill answers fetch requests after a fixed
+ * latency, and reports how long the scroll was held at the end of the loaded items, where a real viewhost shows
+ * placeholders.
+ *
+ * @param client The client binding with the document rendered.
+ * @param options The options of @c client.
+ * @param scroll The "dynamicScroll" corpus object.
+ * @param writer The result writer.
+ */
+static void benchmarkDynamicScroll(
+    AplClientBinding& client,
+    BenchmarkAplOptions& options,
+    const rapidjson::Value& scroll,
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+    auto getInt = [&scroll](const char* key, int defaultValue) {
+        auto it = scroll.FindMember(key);
+        return (it != scroll.MemberEnd() && it->value.IsInt()) ? it->value.GetInt() : defaultValue;
+    };
+    auto componentIt = scroll.FindMember("componentId");
+    if (componentIt == scroll.MemberEnd() || !componentIt->value.IsString()) {
+        std::cerr << "dynamicScroll needs a componentId" << std::endl;
+        return;
+    }
+    std::string componentId = componentIt->value.GetString();
+    int itemHeight = std::max(1, getInt("itemHeight", 100));
+    int viewportHeight = getInt("viewportHeight", 800);
+    int listSize = getInt("listSize", 500);
+    int pixelsPerFrame = getInt("pixelsPerFrame", 60);
+    int frames = getInt("frames", 300);
+    auto skillLatency = std::chrono::milliseconds(getInt("skillLatencyMs", 250));
+
+    /// A stand-in skill response waiting for its latency to pass.
+    struct PendingResponse {
+        std::chrono::steady_clock::time_point due;
+        std::string type;
+        std::string payload;
+        int startIndex;
+        int endIndex;
+    };
+    std::deque<PendingResponse> pending;
+
+    int loadedEnd = getInt("loadedItems", 0);
+    int offset = 0;
+    unsigned int placeholderFrames = 0;
+    unsigned int fetchRequests = 0;
+    unsigned int requestedItems = 0;
+    int maxOffset = std::max(0, listSize * itemHeight - viewportHeight);
+
+    for (int frame = 0; frame < frames && offset < maxOffset; frame++) {
+        std::this_thread::sleep_for(FRAME_INTERVAL);
+        auto now = std::chrono::steady_clock::now();
+
+        while (!pending.empty() && pending.front().due <= now) {
+            auto& response = pending.front();
+            client.dataSourceUpdate(response.type, response.payload, BENCHMARK_TOKEN);
+            if (response.startIndex <= loadedEnd) {
+                loadedEnd = std::max(loadedEnd, response.endIndex);
+            }
+            pending.pop_front();
+        }
+
+        offset = std::min(maxOffset, offset + pixelsPerFrame);
+        int loadedOffset = std::max(0, loadedEnd * itemHeight - viewportHeight);
+        if (offset > loadedOffset) {
+            placeholderFrames++;
+        }
+
+        rapidjson::Document update(rapidjson::kObjectType);
+        auto& alloc = update.GetAllocator();
+        rapidjson::Value payload(rapidjson::kObjectType);
+        payload.AddMember("id", rapidjson::Value(componentId.c_str(), alloc).Move(), alloc);
+        payload.AddMember("type", static_cast<int>(apl::kUpdateScrollPosition), alloc);
+        payload.AddMember("value", std::min(offset, loadedOffset), alloc);
+        update.AddMember("type", "update", alloc);
+        update.AddMember("payload", payload, alloc);
+        auto message = serialize(update);
+        if (client.shouldHandleMessage(message)) {
+            client.handleMessage(message);
+        }
+        client.onUpdateTick();
+
+        for (auto& request : options.takeFetchRequests()) {
+            rapidjson::Document fetch;
+            if (fetch.Parse(request.second).HasParseError() || !fetch.IsObject() || !fetch.HasMember("listId") ||
+                !fetch.HasMember("correlationToken") || !fetch.HasMember("startIndex") || !fetch.HasMember("count")) {
+                continue;
+            }
+            fetchRequests++;
+            int startIndex = std::max(0, fetch["startIndex"].GetInt());
+            int endIndex = std::min(listSize, startIndex + std::max(0, fetch["count"].GetInt()));
+            requestedItems += std::max(0, endIndex - startIndex);
+
+            auto response = makeListPage(
+                fetch["listId"].GetString(), fetch["correlationToken"].GetString(), startIndex, endIndex, listSize);
+            pending.push_back({now + skillLatency, request.first, response, startIndex, endIndex});
+        }
+    }
+
+    writer.Key("dynamicScroll");
+    writer.StartObject();
+    writer.Key("scrolledPixels");
+    writer.Int(offset);
+    writer.Key("placeholderFrames");
+    writer.Uint(placeholderFrames);
+    writer.Key("placeholderMs");
+    writer.Double(placeholderFrames * std::chrono::duration<double, std::milli>(FRAME_INTERVAL).count());
+    writer.Key("fetchRequests");
+    writer.Uint(fetchRequests);
+    writer.Key("requestedItems");
+    writer.Uint(requestedItems);
+    writer.EndObject();
+}
+
+/**
+ * Delivers several pages of DynamicIndexList items back to back, as a skill streaming a catalog does, and reports
+ * the frames, dirty messages and dirty bytes needed to absorb them.
+ *
+ * @param client The client binding with the document freshly rendered.
+ * @param options The options of @c client.
+ * @param burst The "dynamicBurst" corpus object.
+ * @param writer The result writer.
+ */
+static void benchmarkDynamicBurst(
+    AplClientBinding& client,
+    BenchmarkAplOptions& options,
+    const rapidjson::Value& burst,
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+    auto getInt = [&burst](const char* key, int defaultValue) {
+        auto it = burst.FindMember(key);
+        return (it != burst.MemberEnd() && it->value.IsInt()) ? it->value.GetInt() : defaultValue;
+    };
+    auto listIdIt = burst.FindMember("listId");
+    if (listIdIt == burst.MemberEnd() || !listIdIt->value.IsString()) {
+        std::cerr << "dynamicBurst needs a listId" << std::endl;
+        return;
+    }
+    std::string listId = listIdIt->value.GetString();
+    int loadedItems = getInt("loadedItems", 0);
+    int pages = getInt("pages", 5);
+    int pageSize = getInt("pageSize", 20);
+    int listSize = getInt("listSize", loadedItems + pages * pageSize);
+
+    // Settle the initial layout and drop the fetch requests it raised.
+    client.onUpdateTick();
+    options.takeFetchRequests();
+    options.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int page = 0; page < pages; page++) {
+        int startIndex = loadedItems + page * pageSize;
+        int endIndex = std::min(listSize, startIndex + pageSize);
+        client.dataSourceUpdate(
+            "dynamicIndexList", makeListPage(listId, "", startIndex, endIndex, listSize), BENCHMARK_TOKEN);
+    }
+
+    int frames = 0;
+    int quietFrames = 0;
+    unsigned int dirtyMessages = 0;
+    while (frames < MAX_SETTLE_FRAMES && quietFrames < BURST_QUIET_FRAMES) {
+        client.onUpdateTick();
+        frames++;
+        auto& stats = options.getMessageStats();
+        auto dirty = stats.find(DIRTY_MESSAGE_TYPE);
+        unsigned int count = dirty != stats.end() ? dirty->second.count : 0;
+        quietFrames = count == dirtyMessages ? quietFrames + 1 : 0;
+        dirtyMessages = count;
+    }
+    auto elapsed = Microseconds(std::chrono::steady_clock::now() - start).count();
+
+    auto& stats = options.getMessageStats();
+    auto dirty = stats.find(DIRTY_MESSAGE_TYPE);
+
+    writer.Key("dynamicBurst");
+    writer.StartObject();
+    writer.Key("pages");
+    writer.Int(pages);
+    writer.Key("frames");
+    writer.Int(frames - quietFrames);
+    writer.Key("elapsedUs");
+    writer.Double(elapsed);
+    writer.Key("dirtyMessages");
+    writer.Uint(dirtyMessages);
+    writer.Key("dirtyBytes");
+    writer.Uint64(dirty != stats.end() ? dirty->second.bytes : 0);
+    writer.EndObject();
+}
+
+/**
+ * Runs all measurements for one corpus document.
+ *
+ * @param path The corpus file.
+ * @param packageDirectory Directory with import packages.
+ * @param iterations Number of build iterations.
+ * @param frames Number of idle frames.
+ * @param[out] result The results as a JSON object, set only if the document could be benchmarked.
+ * @return Whether the document could be benchmarked.
+ */
+static bool benchmarkDocument(
+    const std::string& path,
+    const std::string& packageDirectory,
+    int iterations,
+    int frames,
+    std::string* result) {
+    std::string corpusContent;
+    rapidjson::Document corpus;
+    if (!readFile(path, &corpusContent) || corpus.Parse(corpusContent).HasParseError() || !corpus.IsObject() ||
+        !corpus.HasMember("document")) {
+        std::cerr << "Skipping invalid corpus file: " << path << std::endl;
+        return false;
+    }
+
+    auto document = serialize(corpus["document"]);
+    auto datasources = corpus.HasMember("datasources") ? serialize(corpus["datasources"]) : "{}";
+    auto viewports = corpus.HasMember("supportedViewports") ? serialize(corpus["supportedViewports"]) : "[]";
+
+    rapidjson::Document build(rapidjson::kObjectType);
+    if (corpus.HasMember("viewport")) {
+        build.CopyFrom(corpus["viewport"], build.GetAllocator());
+    } else {
+        build.Parse(DEFAULT_VIEWPORT);
+    }
+    rapidjson::Document buildMessage(rapidjson::kObjectType);
+    buildMessage.AddMember("type", "build", buildMessage.GetAllocator());
+    buildMessage.AddMember("payload", build, buildMessage.GetAllocator());
+    auto buildMessageString = serialize(buildMessage);
+
+    auto options = std::make_shared<BenchmarkAplOptions>(packageDirectory);
+    AplClientBinding client(options);
+    options->setClient(&client);
+
+    auto deliver = [&client](const std::string& message) {
+        if (client.shouldHandleMessage(message)) {
+            client.handleMessage(message);
+        }
+    };
+
+    auto countMessages = [&options](const std::string& type) {
+        auto& stats = options->getMessageStats();
+        auto it = stats.find(type);
+        return it != stats.end() ? it->second.count : 0;
+    };
+
+    // Build
+    std::vector<double> buildSamples;
+    unsigned int firstBuildInflations = 0;
+    unsigned int lastBuildInflations = 0;
+    for (int i = 0; i < iterations; i++) {
+        options->resetStats();
+        auto start = std::chrono::steady_clock::now();
+        client.renderDocument(document, datasources, viewports, BENCHMARK_TOKEN);
+        deliver(buildMessageString);
+        buildSamples.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+        if (!options->getLastRenderResult()) {
+            std::cerr << "Failed to render: " << path << std::endl;
+            return false;
+        }
+        lastBuildInflations = countMessages(SCALING_MESSAGE_TYPE);
+        if (0 == i) {
+            firstBuildInflations = lastBuildInflations;
+        }
+    }
+    auto buildMessages = options->getMessageStats();
+
+    // Idle frames
+    std::vector<double> frameSamples;
+    for (int i = 0; i < frames; i++) {
+        auto start = std::chrono::steady_clock::now();
+        client.onUpdateTick();
+        frameSamples.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("document");
+    writer.String(path.substr(path.find_last_of('/') + 1));
+
+    writer.Key("buildMessages");
+    writer.StartObject();
+    for (auto& stats : buildMessages) {
+        writer.Key(stats.first);
+        writer.StartObject();
+        writer.Key("count");
+        writer.Uint(stats.second.count);
+        writer.Key("bytes");
+        writer.Uint64(stats.second.bytes);
+        writer.EndObject();
+    }
+    writer.EndObject();
+
+    writer.Key("firstBuildUs");
+    writer.Double(buildSamples.front());
+    auto buildSummary = summarize(buildSamples);
+    writeSummary(writer, "buildUs", buildSummary);
+    writer.Key("buildInflations");
+    writer.StartObject();
+    writer.Key("first");
+    writer.Uint(firstBuildInflations);
+    writer.Key("last");
+    writer.Uint(lastBuildInflations);
+    writer.EndObject();
+    auto frameSummary = summarize(frameSamples);
+    writeSummary(writer, "idleFrameUs", frameSummary);
+
+    // Update commands
+    if (corpus.HasMember("updateCommands")) {
+        rapidjson::Document commands(rapidjson::kObjectType);
+        rapidjson::Value commandArray;
+        commandArray.CopyFrom(corpus["updateCommands"], commands.GetAllocator());
+        commands.AddMember("commands", commandArray, commands.GetAllocator());
+        auto commandsString = serialize(commands);
+
+        options->resetStats();
+        std::vector<double> tickSamples;
+        auto start = std::chrono::steady_clock::now();
+        client.executeCommands(commandsString, BENCHMARK_TOKEN);
+        for (int i = 0; i < MAX_SETTLE_FRAMES && options->getCommandCompleteCount() == 0; i++) {
+            std::this_thread::sleep_for(FRAME_INTERVAL);
+            auto tickStart = std::chrono::steady_clock::now();
+            client.onUpdateTick();
+            tickSamples.push_back(Microseconds(std::chrono::steady_clock::now() - tickStart).count());
+        }
+        auto elapsed = Microseconds(std::chrono::steady_clock::now() - start).count();
+
+        auto& stats = options->getMessageStats();
+        auto dirty = stats.find(DIRTY_MESSAGE_TYPE);
+
+        writer.Key("update");
+        writer.StartObject();
+        writer.Key("completed");
+        writer.Bool(options->getCommandCompleteCount() > 0);
+        writer.Key("frames");
+        writer.Uint(static_cast<unsigned>(tickSamples.size()));
+        writer.Key("elapsedUs");
+        writer.Double(elapsed);
+        writer.Key("dirtyMessages");
+        writer.Uint(dirty != stats.end() ? dirty->second.count : 0);
+        writer.Key("dirtyBytes");
+        writer.Uint64(dirty != stats.end() ? dirty->second.bytes : 0);
+        auto tickSummary = summarize(tickSamples);
+        writeSummary(writer, "frameUs", tickSummary);
+        writer.EndObject();
+
+        // Command stream, every sequence interrupts the previous one before it settles
+        std::vector<double> startSamples;
+        long streamAllocations = 0;
+        for (int i = 0; i < iterations; i++) {
+            for (int j = 0; j < COMMAND_STREAM_LENGTH; j++) {
+                auto allocationsBefore = g_allocations.load();
+                auto commandStart = std::chrono::steady_clock::now();
+                client.executeCommands(commandsString, BENCHMARK_TOKEN);
+                startSamples.push_back(Microseconds(std::chrono::steady_clock::now() - commandStart).count());
+                streamAllocations += g_allocations.load() - allocationsBefore;
+                client.onUpdateTick();
+            }
+        }
+        client.interruptCommandSequence();
+
+        writer.Key("commandStream");
+        writer.StartObject();
+        writer.Key("sequences");
+        writer.Uint(static_cast<unsigned>(startSamples.size()));
+        writer.Key("allocationsPerSequence");
+        writer.Double(static_cast<double>(streamAllocations) / startSamples.size());
+        auto startSummary = summarize(startSamples);
+        writeSummary(writer, "startUs", startSummary);
+        writer.EndObject();
+    }
+
+    // Event round trip
+    if (corpus.HasMember("eventComponentId") && corpus["eventComponentId"].IsString()) {
+        rapidjson::Document pressMessage(rapidjson::kObjectType);
+        auto& alloc = pressMessage.GetAllocator();
+        rapidjson::Value payload(rapidjson::kObjectType);
+        payload.AddMember("id", rapidjson::Value(corpus["eventComponentId"].GetString(), alloc).Move(), alloc);
+        payload.AddMember("type", static_cast<int>(apl::kUpdatePressed), alloc);
+        payload.AddMember("value", 1, alloc);
+        pressMessage.AddMember("type", "update", alloc);
+        pressMessage.AddMember("payload", payload, alloc);
+        auto pressMessageString = serialize(pressMessage);
+
+        std::vector<double> eventSamples;
+        for (int i = 0; i < iterations; i++) {
+            options->resetStats();
+            auto start = std::chrono::steady_clock::now();
+            deliver(pressMessageString);
+            for (int frame = 0; frame < MAX_SETTLE_FRAMES && options->getSendEventCount() == 0; frame++) {
+                client.onUpdateTick();
+            }
+            if (options->getSendEventCount() > 0) {
+                eventSamples.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+            }
+        }
+
+        writer.Key("event");
+        writer.StartObject();
+        writer.Key("delivered");
+        writer.Uint(static_cast<unsigned>(eventSamples.size()));
+        auto eventSummary = summarize(eventSamples);
+        writeSummary(writer, "roundTripUs", eventSummary);
+        writer.EndObject();
+    }
+
+    // DynamicIndexList scroll
+    if (corpus.HasMember("dynamicScroll") && corpus["dynamicScroll"].IsObject()) {
+        benchmarkDynamicScroll(client, *options, corpus["dynamicScroll"], writer);
+    }
+
+    // DynamicIndexList page burst, on a fresh copy of the document
+    if (corpus.HasMember("dynamicBurst") && corpus["dynamicBurst"].IsObject()) {
+        client.renderDocument(document, datasources, viewports, BENCHMARK_TOKEN);
+        deliver(buildMessageString);
+        benchmarkDynamicBurst(client, *options, corpus["dynamicBurst"], writer);
+    }
+
+    writer.EndObject();
+
+    std::cerr << path << ": build p50 " << buildSummary.p50 << "us, idle frame p50 " << frameSummary.p50 << "us"
+              << std::endl;
+
+    client.clearDocument();
+    options->setClient(nullptr);
+    *result = sb.GetString();
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::string corpusDirectory = DEFAULT_CORPUS_DIRECTORY;
+    std::string outputPath;
+    int iterations = DEFAULT_ITERATIONS;
+    int frames = DEFAULT_FRAMES;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (!arg.empty() && arg[0] != '-') {
+            corpusDirectory = arg;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [corpusDirectory] [--iterations N] [--frames N] [--output file]"
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto corpus = listCorpus(corpusDirectory);
+    if (corpus.empty()) {
+        std::cerr << "No corpus documents found in " << corpusDirectory << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("iterations");
+    writer.Int(iterations);
+    writer.Key("frames");
+    writer.Int(frames);
+    writer.Key("results");
+    writer.StartArray();
+    bool success = true;
+    for (auto& path : corpus) {
+        std::string result;
+        if (benchmarkDocument(path, corpusDirectory + "/" + PACKAGES_DIRECTORY, iterations, frames, &result)) {
+            writer.RawValue(result.c_str(), result.size(), rapidjson::kObjectType);
+        } else {
+            success = false;
+        }
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    if (outputPath.empty()) {
+        std::cout << sb.GetString() << std::endl;
+    } else {
+        std::ofstream output(outputPath);
+        output << sb.GetString() << std::endl;
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "BenchmarkAplOptions.h"
+
+namespace APLClient {
+namespace benchmark {
+
+/// Prefix of every serialized viewhost message, the type is always the first member.
+static const std::string MESSAGE_TYPE_PREFIX = "{\"type\":\"";
+/// Package CDN path segment, everything after it is "<name>/<version>/document.json".
+static const std::string PACKAGES_PATH_SEGMENT = "/packages/";
+/// Scheme prefix for local file sources.
+static const std::string FILE_SCHEME = "file://";
+/// Measure request type.
+static const std::string MEASURE_TYPE = "measure";
+/// Baseline request type.
+static const std::string BASELINE_TYPE = "baseline";
+/// Font size used when the measured component does not specify one.
+static const float DEFAULT_FONT_SIZE = 40.0f;
+/// Approximate width of a character relative to the font size.
+static const float CHARACTER_WIDTH_RATIO = 0.5f;
+/// Approximate line height relative to the font size.
+static const float LINE_HEIGHT_RATIO = 1.25f;
+/// Baseline position relative to the measured height.
+static const float BASELINE_RATIO = 0.8f;
+/// Yoga measure mode for an undefined dimension.
+static const int MEASURE_MODE_UNDEFINED = 0;
+
+/**
+ * Reads a whole file.
+ *
+ * @param path The file path.
+ * @return The file content, or an empty string if the file could not be read.
+ */
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ifstream::binary);
+    if (!file.good()) {
+        return "";
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+BenchmarkAplOptions::BenchmarkAplOptions(const std::string& packageDirectory) :
+        m_packageDirectory{packageDirectory},
+        m_client{nullptr},
+        m_sendEventCount{0},
+        m_commandCompleteCount{0},
+        m_lastRenderResult{false} {
+}
+
+void BenchmarkAplOptions::setClient(AplClientBinding* client) {
+    m_client = client;
+}
+
+void BenchmarkAplOptions::resetStats() {
+    m_messageStats.clear();
+    m_sendEventCount = 0;
+    m_commandCompleteCount = 0;
+}
+
+const std::map<std::string, BenchmarkAplOptions::MessageStats>& BenchmarkAplOptions::getMessageStats() const {
+    return m_messageStats;
+}
+
+unsigned int BenchmarkAplOptions::getSendEventCount() const {
+    return m_sendEventCount;
+}
+
+unsigned int BenchmarkAplOptions::getCommandCompleteCount() const {
+    return m_commandCompleteCount;
+}
+
+bool BenchmarkAplOptions::getLastRenderResult() const {
+    return m_lastRenderResult;
+}
+
+std::vector<std::pair<std::string, std::string>> BenchmarkAplOptions::takeFetchRequests() {
+    std::vector<std::pair<std::string, std::string>> requests;
+    requests.swap(m_fetchRequests);
+    return requests;
+}
+
+void BenchmarkAplOptions::sendMessage(const std::string& payload) {
+    std::string type;
+    if (payload.compare(0, MESSAGE_TYPE_PREFIX.size(), MESSAGE_TYPE_PREFIX) == 0) {
+        auto typeEnd = payload.find('"', MESSAGE_TYPE_PREFIX.size());
+        type = payload.substr(MESSAGE_TYPE_PREFIX.size(), typeEnd - MESSAGE_TYPE_PREFIX.size());
+    }
+
+    auto& stats = m_messageStats[type];
+    stats.count++;
+    stats.bytes += payload.size();
+
+    if (type == MEASURE_TYPE || type == BASELINE_TYPE) {
+        replyToMeasurement(type, payload);
+    }
+}
+
+void BenchmarkAplOptions::replyToMeasurement(const std::string& type, const std::string& payload) {
+    if (!m_client) {
+        return;
+    }
+
+    rapidjson::Document request;
+    if (request.Parse(payload).HasParseError() || !request.HasMember("seqno") || !request.HasMember("payload")) {
+        return;
+    }
+    const auto& measure = request["payload"];
+
+    auto getNumber = [&measure](const char* key, float defaultValue) {
+        auto it = measure.FindMember(key);
+        return (it != measure.MemberEnd() && it->value.IsNumber()) ? it->value.GetFloat() : defaultValue;
+    };
+
+    float width = getNumber("width", 0);
+    float height = getNumber("height", 0);
+    float measuredHeight = height;
+
+    rapidjson::Document reply(rapidjson::kObjectType);
+    auto& alloc = reply.GetAllocator();
+    reply.AddMember("type", rapidjson::Value(type.c_str(), alloc).Move(), alloc);
+    reply.AddMember("seqno", request["seqno"].GetUint(), alloc);
+
+    if (type == MEASURE_TYPE) {
+        float fontSize = getNumber("fontSize", DEFAULT_FONT_SIZE);
+        // Styled text serializes either as a plain string or as an object carrying the raw text.
+        size_t characters = 0;
+        auto textIt = measure.FindMember("text");
+        if (textIt != measure.MemberEnd()) {
+            const rapidjson::Value* text = &textIt->value;
+            if (text->IsObject() && text->HasMember("text")) {
+                text = &(*text)["text"];
+            }
+            characters = text->IsString() ? text->GetStringLength() : 0;
+        }
+
+        float textWidth = characters * fontSize * CHARACTER_WIDTH_RATIO;
+        float lineWidth = textWidth;
+        if (getNumber("widthMode", MEASURE_MODE_UNDEFINED) != MEASURE_MODE_UNDEFINED && width > 0) {
+            lineWidth = std::min(textWidth, width);
+        }
+        float lines = lineWidth > 0 ? std::ceil(textWidth / lineWidth) : 1;
+        measuredHeight = lines * fontSize * LINE_HEIGHT_RATIO;
+
+        rapidjson::Value size(rapidjson::kObjectType);
+        size.AddMember("width", lineWidth, alloc);
+        size.AddMember("height", measuredHeight, alloc);
+        reply.AddMember("payload", size, alloc);
+    } else {
+        reply.AddMember("payload", measuredHeight * BASELINE_RATIO, alloc);
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    reply.Accept(writer);
+    m_client->shouldHandleMessage(sb.GetString());
+}
+
+void BenchmarkAplOptions::resetViewhost(const std::string& token) {
+}
+
+std::string BenchmarkAplOptions::downloadResource(const std::string& source) {
+    if (source.compare(0, FILE_SCHEME.size(), FILE_SCHEME) == 0) {
+        return readFile(source.substr(FILE_SCHEME.size()));
+    }
+
+    auto packagesPos = source.find(PACKAGES_PATH_SEGMENT);
+    if (packagesPos == std::string::npos) {
+        return "";
+    }
+    return readFile(m_packageDirectory + "/" + source.substr(packagesPos + PACKAGES_PATH_SEGMENT.size()));
+}
+
+std::chrono::milliseconds BenchmarkAplOptions::getTimezoneOffset() {
+    return std::chrono::milliseconds(0);
+}
+
+void BenchmarkAplOptions::onActivityStarted(const std::string& source) {
+}
+
+void BenchmarkAplOptions::onActivityEnded(const std::string& source) {
+}
+
+void BenchmarkAplOptions::onSendEvent(const std::string& event) {
+    m_sendEventCount++;
+}
+
+void BenchmarkAplOptions::onCommandExecutionComplete(const std::string& token, bool result) {
+    m_commandCompleteCount++;
+}
+
+void BenchmarkAplOptions::onRenderDocumentComplete(const std::string& token, bool result, const std::string& error) {
+    m_lastRenderResult = result;
+}
+
+void BenchmarkAplOptions::onVisualContextAvailable(unsigned int stateRequestToken, const std::string& context) {
+}
+
+void BenchmarkAplOptions::onSetDocumentIdleTimeout(const std::chrono::milliseconds& timeout) {
+}
+
+void BenchmarkAplOptions::onRenderingEvent(AplRenderingEvent event) {
+}
+
+void BenchmarkAplOptions::onFinish() {
+}
+
+void BenchmarkAplOptions::onDataSourceFetchRequestEvent(const std::string& type, const std::string& payload) {
+    m_fetchRequests.emplace_back(type, payload);
+}
+
+void BenchmarkAplOptions::onRuntimeErrorEvent(const std::string& payload) {
+}
+
+void BenchmarkAplOptions::logMessage(LogLevel level, const std::string& source, const std::string& message) {
+}
+
+int BenchmarkAplOptions::getMaxNumberOfConcurrentDownloads() {
+    return 1;
+}
+
+}  // namespace benchmark
+}  // namespace APLClient
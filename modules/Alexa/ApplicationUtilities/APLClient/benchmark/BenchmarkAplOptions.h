@@ -0,0 +1,139 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_BENCHMARK_BENCHMARKAPLOPTIONS_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_BENCHMARK_BENCHMARKAPLOPTIONS_H
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "APLClient/AplClientBinding.h"
+#include "APLClient/AplOptionsInterface.h"
+
+namespace APLClient {
+namespace benchmark {
+
+/**
+ * An in-process stand-in for the viewhost and the SDK side of @c AplOptionsInterface.  It answers measure and
+ * baseline requests synchronously, serves import packages from a local directory, collects data source fetch requests
+ * and swallows all other outgoing messages while recording their count and size.
+ */
+class BenchmarkAplOptions : public AplOptionsInterface {
+public:
+    /// Count and total size of the messages of one type sent to the viewhost.
+    struct MessageStats {
+        /// Number of messages.
+        unsigned int count = 0;
+        /// Total size of the messages in bytes.
+        size_t bytes = 0;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param packageDirectory Directory with import packages laid out as "<name>/<version>/document.json".
+     */
+    explicit BenchmarkAplOptions(const std::string& packageDirectory);
+
+    /**
+     * Sets the client binding which receives the replies to measure and baseline requests.
+     *
+     * @param client The client binding, must outlive its use by this object.
+     */
+    void setClient(AplClientBinding* client);
+
+    /**
+     * Clears all recorded statistics.
+     */
+    void resetStats();
+
+    /// @return The recorded statistics per message type.
+    const std::map<std::string, MessageStats>& getMessageStats() const;
+
+    /// @return The number of SendEvent user events received.
+    unsigned int getSendEventCount() const;
+
+    /// @return The number of completed command sequences.
+    unsigned int getCommandCompleteCount() const;
+
+    /// @return Whether the last document rendered successfully.
+    bool getLastRenderResult() const;
+
+    /**
+     * Takes the data source fetch requests received since the last call, for a stand-in skill to answer.
+     *
+     * @return The data source type and serialized payload of every request.
+     */
+    std::vector<std::pair<std::string, std::string>> takeFetchRequests();
+
+    /// @name AplOptionsInterface Functions
+    /// @{
+    void sendMessage(const std::string& payload) override;
+    void resetViewhost(const std::string& token) override;
+    std::string downloadResource(const std::string& source) override;
+    std::chrono::milliseconds getTimezoneOffset() override;
+    void onActivityStarted(const std::string& source) override;
+    void onActivityEnded(const std::string& source) override;
+    void onSendEvent(const std::string& event) override;
+    void onCommandExecutionComplete(const std::string& token, bool result) override;
+    void onRenderDocumentComplete(const std::string& token, bool result, const std::string& error) override;
+    void onVisualContextAvailable(unsigned int stateRequestToken, const std::string& context) override;
+    void onSetDocumentIdleTimeout(const std::chrono::milliseconds& timeout) override;
+    void onRenderingEvent(AplRenderingEvent event) override;
+    void onFinish() override;
+    void onDataSourceFetchRequestEvent(const std::string& type, const std::string& payload) override;
+    void onRuntimeErrorEvent(const std::string& payload) override;
+    void logMessage(LogLevel level, const std::string& source, const std::string& message) override;
+    int getMaxNumberOfConcurrentDownloads() override;
+    /// @}
+
+private:
+    /**
+     * Replies to a measure or baseline request.
+     *
+     * @param type The request type.
+     * @param payload The serialized request.
+     */
+    void replyToMeasurement(const std::string& type, const std::string& payload);
+
+    /// Directory with import packages.
+    std::string m_packageDirectory;
+
+    /// The client binding receiving replies.
+    AplClientBinding* m_client;
+
+    /// Statistics per message type.
+    std::map<std::string, MessageStats> m_messageStats;
+
+    /// Number of SendEvent user events received.
+    unsigned int m_sendEventCount;
+
+    /// Number of completed command sequences.
+    unsigned int m_commandCompleteCount;
+
+    /// Result of the last render.
+    bool m_lastRenderResult;
+
+    /// Data source fetch requests not taken yet.
+    std::vector<std::pair<std::string, std::string>> m_fetchRequests;
+};
+
+}  // namespace benchmark
+}  // namespace APLClient
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_BENCHMARK_BENCHMARKAPLOPTIONS_H
@@ -0,0 +1,63 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCLIENTLOG_H_
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCLIENTLOG_H_
+
+#include "AplOptionsInterface.h"
+
+/**
+ * The most verbose @c LogLevel compiled into the APL client binding.  Debug and trace messages are compiled out unless
+ * debug logs are enabled, as they are for the Alexa Client SDK logs.
+ */
+#ifndef APLCLIENT_LOG_MAX_LEVEL
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+#define APLCLIENT_LOG_MAX_LEVEL TRACE
+#else
+#define APLCLIENT_LOG_MAX_LEVEL INFO
+#endif
+#endif
+
+namespace APLClient {
+
+/**
+ * @param level The log level
+ * @return Whether messages at @c level are compiled in
+ */
+constexpr bool isLogLevelCompiledIn(LogLevel level) {
+    return level <= LogLevel::APLCLIENT_LOG_MAX_LEVEL;
+}
+
+}  // namespace APLClient
+
+/**
+ * Logs a message of the APL client binding through @c AplOptionsInterface::logMessage.  The message expression is only
+ * evaluated if the level is enabled.  If the level is compiled out the condition is a constant false, so the call is
+ * still compiled but removed as dead code.
+ *
+ * @param options The @c AplOptionsInterface
+ * @param level The @c LogLevel
+ * @param source The source of the message
+ * @param message The message
+ */
+#define APLCLIENT_LOG(options, level, source, message)                                                \
+    do {                                                                                              \
+        if (APLClient::isLogLevelCompiledIn(level) &&                                                 \
+            (options)->shouldLog(level, APLClient::LogSubsystem::CLIENT)) {                           \
+            (options)->logMessage(level, source, message);                                            \
+        }                                                                                             \
+    } while (false)
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCLIENTLOG_H_
@@ -0,0 +1,136 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOMMANDDOCUMENTPOOL_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOMMANDDOCUMENTPOOL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+namespace APLClient {
+
+/**
+ * Parses ExecuteCommands payloads into pooled documents.
+ *
+ * APL Core keeps referencing the parsed commands until the command sequence resolves, so every payload needs a
+ * document of its own.  Each pooled document owns a copy of the payload, parsed in place so strings are not copied,
+ * and a fixed arena its values are allocated from.  Parsing keeps only the @c commands array of the payload and fails
+ * as soon as the payload turns out not to have one.  Releasing the last reference to a parsed payload reclaims the
+ * arena in bulk and returns the document to the pool, so a stream of command sequences reuses the same memory.
+ */
+class AplCommandDocumentPool {
+public:
+    /// Default number of idle documents kept for reuse.
+    static const size_t DEFAULT_MAX_IDLE = 4;
+
+    /**
+     * Constructor
+     *
+     * @param maxIdle Maximum number of idle documents kept for reuse
+     */
+    explicit AplCommandDocumentPool(size_t maxIdle = DEFAULT_MAX_IDLE);
+
+    /**
+     * Parses the @c commands array of an ExecuteCommands payload.
+     *
+     * @param payload The payload, a JSON object with a @c commands array
+     * @return The @c commands array, valid as long as a reference is held, or @c nullptr if the payload is not valid
+     * JSON or has no @c commands array
+     */
+    std::shared_ptr<const rapidjson::Value> parseCommands(const std::string& payload);
+
+private:
+    /// Document type, with values and parse stack allocated from memory pools.
+    using Document = rapidjson::GenericDocument<
+        rapidjson::UTF8<>,
+        rapidjson::MemoryPoolAllocator<>,
+        rapidjson::MemoryPoolAllocator<>>;
+
+    /// A pooled document with the memory it is parsed into.
+    struct Entry {
+        /// Constructor
+        Entry();
+
+        /// Copy of the payload, parsed in place, string values point into it
+        std::vector<char> buffer;
+
+        /// Arena the values are allocated from first
+        std::unique_ptr<char[]> valueArena;
+
+        /// Arena the parse stack is allocated from first
+        std::unique_ptr<char[]> stackArena;
+
+        /// Allocator of the values
+        rapidjson::MemoryPoolAllocator<> valueAllocator;
+
+        /// Allocator of the parse stack
+        rapidjson::MemoryPoolAllocator<> stackAllocator;
+
+        /// The document, its root is the @c commands array once parsed
+        Document document;
+    };
+
+    /// Idle documents, shared with the parsed payloads so they can be returned after the pool is gone.
+    struct State {
+        /// Serializes access to @c idle
+        std::mutex mutex;
+
+        /// Documents ready for reuse
+        std::vector<std::unique_ptr<Entry>> idle;
+
+        /// Maximum size of @c idle
+        size_t maxIdle;
+    };
+
+    /**
+     * Returns a document to the pool once the last reference to its parsed payload is released.
+     */
+    class Recycler {
+    public:
+        /**
+         * Constructor
+         *
+         * @param state The pool state
+         */
+        explicit Recycler(std::weak_ptr<State> state);
+
+        /**
+         * Reclaims the memory of the document and returns it to the pool, or deletes it if the pool is full or gone.
+         *
+         * @param entry The document
+         */
+        void operator()(Entry* entry) const;
+
+    private:
+        /// The pool state
+        std::weak_ptr<State> m_state;
+    };
+
+    /**
+     * @return An idle document, or a new one if none is idle
+     */
+    std::unique_ptr<Entry> acquire();
+
+    /// The pool state
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace APLClient
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOMMANDDOCUMENTPOOL_H
@@ -16,7 +16,11 @@
 #ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCORECONNECTIONMANAGER_H
 #define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCORECONNECTIONMANAGER_H
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Timing/Timer.h>
@@ -35,8 +39,11 @@
 #pragma pop_macro("FALSE")
 #pragma GCC diagnostic pop
 
+#include "AplCommandDocumentPool.h"
 #include "AplCoreViewhostMessage.h"
 #include "AplCoreMetrics.h"
+#include "AplDataSourcePrefetcher.h"
+#include "AplGraphicCache.h"
 #include "AplOptionsInterface.h"
 
 namespace APLClient {
@@ -60,8 +67,9 @@ public:
      * Sets the APL Content to be rendered by the APL Core
      * @param content
      * @param token APL Presentation token for this content
+     * @param documentHash Hash of the document, its data and its supported viewports
      */
-    void setContent(const apl::ContentPtr content, const std::string& token);
+    void setContent(const apl::ContentPtr content, const std::string& token, size_t documentHash = 0);
 
     /**
      * Sets the APL ScalingOptions
@@ -91,7 +99,7 @@ public:
     void executeCommands(const std::string& command, const std::string& token);
 
     /**
-     * Execute DataSource updates.
+     * Execute DataSource updates.  Updates are queued and applied together at the start of the next frame.
      * @param sourceType DataSource type.
      * @param jsonPayload The payload of the directive in structured JSON format.
      * @param token Directive token used to bind result processing.
@@ -206,6 +214,50 @@ private:
      */
     void handleUpdateCursorPosition(const rapidjson::Value& payload);
 
+    /**
+     * Finds a component of the current document.  Components are looked up by unique id in @c m_componentIndex,
+     * falling back to a search of the component tree on a miss.
+     * @param id The unique id or id of the component
+     * @return The component, or nullptr if there is no such component
+     */
+    apl::ComponentPtr findComponent(const std::string& id);
+
+    /**
+     * Adds a component and its descendants to @c m_componentIndex.
+     * @param component The root of the subtree to add
+     */
+    void indexComponents(const apl::ComponentPtr& component);
+
+    /**
+     * Removes a component and its descendants from @c m_componentIndex.
+     * @param uid The unique id of the root of the subtree to remove
+     */
+    void unindexComponents(const std::string& uid);
+
+    /**
+     * Gets the key under which a view host message is coalesced with earlier messages of the same frame.  Scroll
+     * position, cursor position and media time updates are coalesced, discrete input such as presses and keyboard
+     * events is not.
+     * @param type The message type
+     * @param payload The message payload
+     * @return The coalescing key, or an empty string if the message must be handled in order
+     */
+    std::string getCoalescingKey(const std::string& type, const rapidjson::Value& payload);
+
+    /**
+     * Stages a view host message to be handled at the start of the next frame, replacing any message staged under
+     * the same key.
+     * @param key The coalescing key
+     * @param type The message type
+     * @param payload The message payload
+     */
+    void stageInput(const std::string& key, const std::string& type, const rapidjson::Value& payload);
+
+    /**
+     * Handles the staged view host messages in the order their keys were first staged.
+     */
+    void applyStagedInputs();
+
     /**
      * Process responses to events with action references.  The payload should be of the form:
      *
@@ -239,6 +291,8 @@ private:
      * APL Core relies on operations to be performed in particular way.
      * Order and set of operations in this method should be preserved.
      * Order is the following:
+     * * Apply input updates staged since the last frame.
+     * * Apply data source updates received since the last frame.
      * * Update time and adjust TimeZone if required.
      * * Call **clearPending** method on RootConfig to give Core possibility to execute all pending actions and updates.
      * * Process requested events.      * * Process dirty properties.
@@ -253,6 +307,13 @@ private:
      */
     unsigned int send(AplCoreViewhostMessage& message);
 
+    /**
+     * Send a message to the view host with a sequence number already taken from @c m_SequenceNumber
+     * @param message The message to send
+     * @param seqno The sequence number of this message
+     */
+    void send(AplCoreViewhostMessage& message, unsigned int seqno);
+
     /**
      * Sends an error message to the view host
      * @param message The message to send to the view hsot
@@ -315,19 +376,66 @@ private:
     apl::Rect convertJsonToScaledRect(const rapidjson::Value& jsonNode);
 
     /**
-     * Check if any errors returned from any of loaded datasources and report them.
+     * Queues a data source update for the next frame.
+     * @param key List id and correlation token of the update, empty if it carries no correlation token
+     * @param sourceType The data source type
+     * @param jsonPayload The update
+     */
+    void queueDataSourceUpdate(const std::string& key, const std::string& sourceType, const std::string& jsonPayload);
+
+    /**
+     * Queues read-ahead responses answering fetch requests of APL Core for the next frame.
+     * @param answers The answers
+     */
+    void queueDataSourceAnswers(const std::vector<AplDataSourcePrefetcher::Answer>& answers);
+
+    /**
+     * Applies the data source updates received since the last frame.
+     */
+    void applyDataSourceUpdates();
+
+    /**
+     * Sends data source fetch requests to the skill.
+     * @param requests The requests
+     */
+    void sendDataSourceFetchRequests(const std::vector<AplDataSourcePrefetcher::FetchRequest>& requests);
+
+    /**
+     * Check if any errors returned from any of loaded datasources and report them.  Called from @c onUpdateTick only
+     * after a data source update, or periodically while fetch requests may time out.
      */
     void checkAndSendDataSourceErrors();
 
     /// View host message type to handler map
     std::map<std::string, std::function<void(const rapidjson::Value&)>> m_messageHandlers;
 
+    /// A view host message waiting for the next frame.
+    struct StagedInput {
+        /// The message type
+        std::string type;
+
+        /// The message payload
+        std::unique_ptr<rapidjson::Document> payload;
+    };
+
+    /// Unique id to component of the current document, kept up to date with children changes
+    std::unordered_map<std::string, std::weak_ptr<apl::Component>> m_componentIndex;
+
+    /// Staged view host messages, in the order their keys were first staged
+    std::vector<StagedInput> m_stagedInputs;
+
+    /// Coalescing key to index in @c m_stagedInputs
+    std::map<std::string, size_t> m_stagedInputIndices;
+
     /// Shared pointer to the APL Content
     apl::ContentPtr m_Content;
 
     /// The APL presentation token for the currently rendered document
     std::string m_aplToken;
 
+    /// Hash of the currently rendered document, its data and its supported viewports
+    size_t m_documentHash;
+
     /// The APL Metrics object - received from the view host and used for generating the apl root context
     apl::Metrics m_Metrics;
 
@@ -342,6 +450,12 @@ private:
      */
     AplCoreMetricsPtr m_AplCoreMetrics;
 
+    /// The supported viewport specifications documents inflated with, by document and viewport
+    AplViewportSelectionCache m_viewportSelectionCache;
+
+    /// Documents ExecuteCommands payloads are parsed into
+    AplCommandDocumentPool m_commandDocumentPool;
+
     /// Pointer to the APL Root Context
     apl::RootContextPtr m_Root;
 
@@ -351,14 +465,20 @@ private:
     /// The start time used to calculate the update time used by APL Core
     std::chrono::milliseconds m_StartTime;
 
+    /// Parsed AVG graphics, kept across documents
+    AplGraphicCache m_graphicCache;
+
+    /// Reads ahead of scrolling DynamicIndexLists
+    AplDataSourcePrefetcher m_dataSourcePrefetcher;
+
     /// Pointer to APL Options
     AplOptionsInterfacePtr m_aplOptions;
 
     /// Screen lock flag
     bool m_ScreenLock;
 
-    /// Next packet sequence number
-    unsigned int m_SequenceNumber;
+    /// Last packet sequence number
+    std::atomic<unsigned int> m_SequenceNumber;
 
     /// The sequence number which a blockingSend is waiting for
     unsigned int m_replyExpectedSequenceNumber;
@@ -369,8 +489,35 @@ private:
     /// The pending promise from a call to blockingSend
     std::promise<std::string> m_replyPromise;
 
+    /// The mutex protecting the reply expectation of a blockingSend
+    std::mutex m_replyMutex;
+
     /// The mutex protecting blockingSend
     std::mutex m_blockingSendMutex;
+
+    /// A data source update waiting for the next frame.
+    struct PendingDataSourceUpdate {
+        /// List id and correlation token of the update, empty if it carries no correlation token
+        std::string key;
+
+        /// The data source type
+        std::string sourceType;
+
+        /// The serialized update
+        std::string payload;
+    };
+
+    /// Data source updates received since the last frame, in arrival order
+    std::vector<PendingDataSourceUpdate> m_pendingDataSourceUpdates;
+
+    /// Whether a data source update was handled since data source errors were last checked
+    bool m_dataSourceErrorsPending;
+
+    /// Until when data source errors are polled for timed out fetch requests
+    AplDataSourcePrefetcher::Clock::time_point m_fetchErrorWatchDeadline;
+
+    /// Time of the next data source error poll while fetch requests may time out
+    AplDataSourcePrefetcher::Clock::time_point m_nextFetchErrorCheck;
 };
 
 using AplCoreConnectionManagerPtr = std::shared_ptr<AplCoreConnectionManager>;
@@ -16,6 +16,12 @@
 #ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOREMETRICS_H
 #define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOREMETRICS_H
 
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <apl/scaling/metricstransform.h>
 
 namespace APLClient {
@@ -61,6 +67,69 @@ public:
 
 using AplCoreMetricsPtr = std::shared_ptr<AplCoreMetrics>;
 
+/**
+ * Remembers which supported viewport specification a document inflated with, so that building the document again for
+ * the same viewport inflates it once instead of retrying the specifications it does not inflate with.  Entries are
+ * keyed by the document, its data, its supported viewports and the viewport metrics, the least recently used entry is
+ * dropped when the cache is full.
+ */
+class AplViewportSelectionCache {
+public:
+    /**
+     * Constructor
+     * @param maxEntries Maximum number of entries
+     */
+    explicit AplViewportSelectionCache(size_t maxEntries = DEFAULT_MAX_ENTRIES);
+
+    /**
+     * Returns the specifications the scaling is chosen from.
+     * @param key The key of the document and viewport
+     * @param specifications The supported specifications of the document
+     * @return The specification the document inflated with, or else the specifications it is not known to fail
+     * with, empty if it fails with all of them
+     */
+    std::vector<apl::ViewportSpecification> getCandidates(
+        const std::string& key,
+        const std::vector<apl::ViewportSpecification>& specifications);
+
+    /**
+     * Records the result of inflating a document.
+     * @param key The key of the document and viewport
+     * @param specifications The supported specifications of the document
+     * @param chosen The specification the document was inflated with
+     * @param inflated Whether the document inflated
+     * @return @c false if @c chosen is not one of @c specifications
+     */
+    bool recordInflation(
+        const std::string& key,
+        const std::vector<apl::ViewportSpecification>& specifications,
+        const apl::ViewportSpecification& chosen,
+        bool inflated);
+
+private:
+    /// Default maximum number of entries
+    static const size_t DEFAULT_MAX_ENTRIES = 32;
+
+    /// What is known about a document on a viewport
+    struct Entry {
+        /// Index of the specification the document inflated with, -1 if none
+        int inflatedIndex = -1;
+        /// Whether the document failed to inflate with the specification at each index
+        std::vector<bool> failed;
+        /// Position of the key in @c m_recentKeys
+        std::list<std::string>::iterator recentPosition;
+    };
+
+    /// Maximum number of entries
+    const size_t m_maxEntries;
+
+    /// Keys from the most to the least recently used
+    std::list<std::string> m_recentKeys;
+
+    /// Entries by key
+    std::unordered_map<std::string, Entry> m_entries;
+};
+
 }  // namespace APLClient
 
 #endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLCOREMETRICS_H
\ No newline at end of file
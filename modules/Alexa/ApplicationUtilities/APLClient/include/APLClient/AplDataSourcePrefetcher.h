@@ -0,0 +1,212 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLDATASOURCEPREFETCHER_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLDATASOURCEPREFETCHER_H
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace APLClient {
+
+/**
+ * Reads ahead of scrolling DynamicIndexLists.
+ *
+ * APL Core asks for more items only when the loaded edge of a list comes close to the viewport, so a fast scroll
+ * waits a full skill round trip at every edge.  The prefetcher tracks how fast Core moves the edge of each list and,
+ * after each forward request of Core, asks the skill for the items the user is expected to scroll past within the
+ * prefetch horizon.  These read-ahead requests carry correlation tokens of the prefetcher, so Core never sees their
+ * responses directly: a response is held until Core asks for items it covers, and is then handed to Core as the
+ * answer to that request, trimmed to the items Core asked for and under the correlation token Core assigned.
+ *
+ * Requests raised by Core are always sent unchanged, unless a read-ahead request covers them.  Such a request is
+ * answered by the read-ahead response, or sent after all once the read-ahead request times out.
+ */
+class AplDataSourcePrefetcher {
+public:
+    /// Clock used for all timing.
+    using Clock = std::chrono::steady_clock;
+
+    /// A fetch request for a range of list items.
+    struct FetchRequest {
+        /// Data source type
+        std::string type;
+
+        /// The list the items belong to
+        std::string listId;
+
+        /// Correlation token assigned by APL Core, or by the prefetcher for a read-ahead request
+        std::string correlationToken;
+
+        /// Index of the first requested item
+        int startIndex;
+
+        /// Number of requested items
+        int count;
+    };
+
+    /// A read-ahead response answering a fetch request raised by APL Core.
+    struct Answer {
+        /// Data source type
+        std::string type;
+
+        /// The list the items belong to
+        std::string listId;
+
+        /// Correlation token of the answered request, assigned by APL Core
+        std::string correlationToken;
+
+        /// The read-ahead response trimmed to the requested items, under the correlation token of the answered request,
+        /// or empty if the read-ahead response is not a JSON object
+        std::string payload;
+    };
+
+    /**
+     * Constructor
+     *
+     * @param maxReadAhead Maximum number of read-ahead requests per list, unanswered or holding a response
+     * @param horizon How far ahead of the list edge items are fetched, in time scrolled at the current velocity
+     * @param maxReadAheadItems Maximum number of items of a single read-ahead request
+     * @param requestTimeout Time after which an unanswered read-ahead request is given up
+     */
+    AplDataSourcePrefetcher(
+        size_t maxReadAhead,
+        std::chrono::milliseconds horizon,
+        int maxReadAheadItems,
+        std::chrono::milliseconds requestTimeout);
+
+    /**
+     * @param correlationToken The correlation token of a fetch request or response
+     * @return Whether the token belongs to a read-ahead request
+     */
+    static bool isReadAheadToken(const std::string& correlationToken);
+
+    /**
+     * Handles a fetch request raised by APL Core.
+     *
+     * @param request The request
+     * @param now The current time
+     * @param[out] answers Receives the answer to the request if a read-ahead response covers it
+     * @return The requests to send now, the request itself unless it is answered or waits for a read-ahead response,
+     * followed by a read-ahead request if the list is scrolling forward
+     */
+    std::vector<FetchRequest> onFetchRequest(
+        const FetchRequest& request,
+        Clock::time_point now,
+        std::vector<Answer>* answers);
+
+    /**
+     * Handles a response to a read-ahead request.  The response is never meant for APL Core as it is.
+     *
+     * @param listId The list the response belongs to
+     * @param correlationToken The correlation token of the response
+     * @param payload The response
+     * @param[out] answers Receives the answer to the request of APL Core waiting for this response, if any
+     */
+    void onReadAheadResponse(
+        const std::string& listId,
+        const std::string& correlationToken,
+        const std::string& payload,
+        std::vector<Answer>* answers);
+
+    /**
+     * Gives up unanswered read-ahead requests.  Should be called regularly.
+     *
+     * @param now The current time
+     * @return Requests of APL Core which waited for a given up read-ahead request, to send now
+     */
+    std::vector<FetchRequest> onTick(Clock::time_point now);
+
+    /**
+     * Forgets all lists, called when the document changes.
+     */
+    void reset();
+
+private:
+    /// A read-ahead request sent to the skill.
+    struct ReadAhead {
+        /// Correlation token of the request
+        std::string correlationToken;
+
+        /// Index of the first requested item
+        int startIndex;
+
+        /// Index after the last requested item
+        int endIndex;
+
+        /// When the request was sent
+        Clock::time_point sent;
+
+        /// Whether the response was received
+        bool received;
+
+        /// The response once received
+        std::string payload;
+
+        /// Whether a request of APL Core waits for the response
+        bool hasWaiting;
+
+        /// The request of APL Core waiting for the response
+        FetchRequest waiting;
+    };
+
+    /// Fetch state of a list.
+    struct ListState {
+        /// Whether a forward request of APL Core was seen for this list
+        bool hasForwardRequest = false;
+
+        /// Start index of the previous forward request of APL Core, used to estimate the edge velocity
+        int lastForwardStartIndex = 0;
+
+        /// Time of the previous forward request of APL Core
+        Clock::time_point lastForwardTime;
+
+        /// Index after the last item requested by APL Core so far
+        int coreEdge = 0;
+
+        /// Index after the last item requested by APL Core or read ahead so far
+        int readAheadEdge = 0;
+
+        /// Smoothed velocity of the forward edge of the list in items per second
+        double velocity = 0;
+
+        /// Read-ahead requests, unanswered or holding a response
+        std::vector<ReadAhead> readAheads;
+    };
+
+    /// Maximum number of read-ahead requests per list
+    size_t m_maxReadAhead;
+
+    /// Prefetch horizon
+    std::chrono::milliseconds m_horizon;
+
+    /// Maximum number of items of a single read-ahead request
+    int m_maxReadAheadItems;
+
+    /// Time after which an unanswered read-ahead request is given up
+    std::chrono::milliseconds m_requestTimeout;
+
+    /// Sequence number of the last read-ahead request, part of its correlation token
+    unsigned int m_readAheadSequenceNumber;
+
+    /// List id to fetch state
+    std::map<std::string, ListState> m_lists;
+};
+
+}  // namespace APLClient
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLDATASOURCEPREFETCHER_H
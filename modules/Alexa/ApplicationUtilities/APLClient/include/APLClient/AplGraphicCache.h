@@ -0,0 +1,108 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLGRAPHICCACHE_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLGRAPHICCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+// TODO: Tidy up core to prevent this (ARC-917)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wreorder"
+#pragma push_macro("DEBUG")
+#pragma push_macro("TRUE")
+#pragma push_macro("FALSE")
+#undef DEBUG
+#undef TRUE
+#undef FALSE
+#include <apl/apl.h>
+#pragma pop_macro("DEBUG")
+#pragma pop_macro("TRUE")
+#pragma pop_macro("FALSE")
+#pragma GCC diagnostic pop
+
+namespace APLClient {
+
+/**
+ * Least recently used cache of parsed AVG graphics keyed by a hash of their JSON text.
+ *
+ * Parsed graphics are immutable and shared by every component showing the same AVG, in the current and in later
+ * documents.  Entries keep their AVG text so that a hash collision is a miss rather than the wrong graphic.  The
+ * cache is bounded by the total length of the cached AVG text.
+ */
+class AplGraphicCache {
+public:
+    /**
+     * Constructor
+     *
+     * @param maxBytes The maximum total length of the cached AVG text
+     */
+    explicit AplGraphicCache(size_t maxBytes);
+
+    /**
+     * Hashes an AVG.  This is the 64 bit FNV-1a hash of the UTF-8 JSON text.
+     *
+     * @param avg The AVG JSON text
+     * @param length The length of @c avg in bytes
+     * @return The hash
+     */
+    static uint64_t hash(const char* avg, size_t length);
+
+    /**
+     * Gets a graphic, parsing and caching it if it is not cached.
+     *
+     * @param avg The AVG JSON text
+     * @param length The length of @c avg in bytes
+     * @return The graphic, or nullptr if @c avg is not a valid AVG
+     */
+    apl::GraphicContentPtr getOrCreate(const char* avg, size_t length);
+
+    /**
+     * Removes all graphics.
+     */
+    void clear();
+
+private:
+    /// A cached graphic.
+    struct Entry {
+        /// Hash of the graphic
+        uint64_t hash;
+
+        /// The AVG JSON text
+        std::string avg;
+
+        /// The parsed graphic
+        apl::GraphicContentPtr content;
+    };
+
+    /// The maximum total length of the cached AVG text
+    size_t m_maxBytes;
+
+    /// The total length of the cached AVG text
+    size_t m_bytes;
+
+    /// Cached graphics, most recently used first
+    std::list<Entry> m_entries;
+
+    /// Hash to cached graphic
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+};
+
+}  // namespace APLClient
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLGRAPHICCACHE_H
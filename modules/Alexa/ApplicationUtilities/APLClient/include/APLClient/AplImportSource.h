@@ -0,0 +1,41 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLIMPORTSOURCE_H_
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLIMPORTSOURCE_H_
+
+#include <string>
+
+namespace APLClient {
+
+/// CDN for alexa import packages (styles/resources/etc)
+/// (https://developer.amazon.com/en-US/docs/alexa/alexa-presentation-language/apl-document.html#import)
+static const char ALEXA_IMPORT_BASE_URL[] = "https://d2na8397m465mh.cloudfront.net/packages/";
+
+/// File name of a package document on the CDN, below "<name>/<version>/".
+static const char ALEXA_IMPORT_DOCUMENT_NAME[] = "document.json";
+
+/**
+ * @param name The package name
+ * @param version The package version
+ * @return The source of an import without a source of its own
+ */
+inline std::string getAlexaImportSource(const std::string& name, const std::string& version) {
+    return ALEXA_IMPORT_BASE_URL + name + "/" + version + "/" + ALEXA_IMPORT_DOCUMENT_NAME;
+}
+
+}  // namespace APLClient
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLIMPORTSOURCE_H_
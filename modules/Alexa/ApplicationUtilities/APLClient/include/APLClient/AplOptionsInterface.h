@@ -23,6 +23,14 @@ namespace APLClient {
 /// Enumeration of log levels sent by the APL client binding (DBG used to avoid conflicts with compiler defined macros)
 enum class LogLevel { CRITICAL, ERROR, WARN, INFO, DBG, TRACE };
 
+/// Enumeration of the parts of the APL client binding whose log levels are configured separately
+enum class LogSubsystem {
+    /// The APL client binding itself
+    CLIENT,
+    /// The APL core engine
+    CORE_ENGINE
+};
+
 /**
  * The @c AplOptionsInterface defines the set of callbacks which users of the APL client library must provide, it will
  * be used to inform the consumer of certain state changes as well as requests for data or to pass messages to the
@@ -140,6 +148,17 @@ public:
      */
     virtual void logMessage(LogLevel level, const std::string& source, const std::string& message) = 0;
 
+    /**
+     * Called before a message is formatted, messages at disabled levels are neither formatted nor passed to
+     * @c logMessage.  All levels are enabled by default.
+     * @param level The log level
+     * @param subsystem The subsystem the message originates from
+     * @return Whether messages at @c level are logged
+     */
+    virtual bool shouldLog(LogLevel level, LogSubsystem subsystem) {
+        return true;
+    }
+
     /**
      * Returns the maximum number of concurrent downloads from the configs.
      */
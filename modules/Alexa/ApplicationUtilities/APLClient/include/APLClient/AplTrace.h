@@ -0,0 +1,194 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLTRACE_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLTRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace APLClient {
+
+/**
+ * Process wide recorder of trace spans for the APL pipeline.
+ *
+ * Spans are written into a fixed size ring buffer without locking and can be exported in the Chrome trace event
+ * format (chrome://tracing, Perfetto) at any time.  While disabled, a span costs a single atomic load, so
+ * instrumentation stays compiled in on production builds.
+ */
+class AplTraceRecorder {
+public:
+    /// @return The process wide recorder.
+    static AplTraceRecorder& getInstance();
+
+    /**
+     * Starts recording, discarding previously recorded spans.
+     *
+     * @param capacity Number of spans kept, older spans are overwritten.  The ring buffer is allocated by the first
+     * call and never released, so that spans racing with @c enable and @c disable never touch freed memory; the
+     * capacity of later calls is ignored.
+     */
+    void enable(size_t capacity);
+
+    /**
+     * Stops recording.  Recorded spans are kept until the next call to @c enable.
+     */
+    void disable();
+
+    /// @return Whether spans are being recorded.
+    bool isEnabled() const {
+        return m_enabled.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Records a completed span.
+     *
+     * @param name Span name, must be a string literal or otherwise outlive the recorder.
+     * @param category Span category, must be a string literal or otherwise outlive the recorder.
+     * @param start Start time of the span.
+     * @param end End time of the span.
+     */
+    void record(
+        const char* name,
+        const char* category,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end);
+
+    /**
+     * Serializes the recorded spans in the Chrome trace event format.
+     *
+     * @return The trace JSON.
+     */
+    std::string toChromeTrace();
+
+    /**
+     * Writes the recorded spans in the Chrome trace event format to a file.
+     *
+     * @param path The output file.
+     * @return Whether the file was written.
+     */
+    bool dumpChromeTrace(const std::string& path);
+
+    /**
+     * Asks for the trace to be dumped at the next call to @c dumpIfRequested.  Safe to call from a signal handler.
+     */
+    void requestDump();
+
+    /**
+     * Dumps the trace if a dump was requested since the last call.
+     *
+     * @param path The output file.
+     * @return Whether a dump was requested and the file was written.
+     */
+    bool dumpIfRequested(const std::string& path);
+
+private:
+    /// A recorded span.  Fields are relaxed atomics so that writers lapping the ring never race.
+    struct Span {
+        /// Even when the slot is stable, odd while it is being written.
+        std::atomic<uint64_t> sequence;
+        std::atomic<const char*> name;
+        std::atomic<const char*> category;
+        std::atomic<int64_t> startUs;
+        std::atomic<int64_t> durationUs;
+        std::atomic<uint32_t> threadId;
+    };
+
+    /// Constructor.
+    AplTraceRecorder();
+
+    /// Whether spans are being recorded.
+    std::atomic<bool> m_enabled;
+
+    /// Whether a dump was requested.
+    std::atomic<bool> m_dumpRequested;
+
+    /// Index of the next span to write.
+    std::atomic<uint64_t> m_writeIndex;
+
+    /// Index of the first span of the current recording.
+    uint64_t m_sessionStart;
+
+    /// The ring buffer.
+    std::unique_ptr<Span[]> m_spans;
+
+    /// Number of spans in the ring buffer.
+    size_t m_capacity;
+
+    /// Time origin of all timestamps.
+    std::chrono::steady_clock::time_point m_origin;
+
+    /// Serializes @c enable, @c disable and exports.
+    std::mutex m_mutex;
+};
+
+/**
+ * Records the lifetime of a scope as a span in @c AplTraceRecorder.
+ */
+class AplTraceSpan {
+public:
+    /**
+     * Constructor.
+     *
+     * @param name Span name, must be a string literal.
+     * @param category Span category, must be a string literal.
+     */
+    AplTraceSpan(const char* name, const char* category) :
+            m_name{AplTraceRecorder::getInstance().isEnabled() ? name : nullptr},
+            m_category{category} {
+        if (m_name) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * Destructor.
+     */
+    ~AplTraceSpan() {
+        if (m_name) {
+            AplTraceRecorder::getInstance().record(m_name, m_category, m_start, std::chrono::steady_clock::now());
+        }
+    }
+
+private:
+    /// Span name, null if recording was disabled when the scope was entered.
+    const char* m_name;
+
+    /// Span category.
+    const char* m_category;
+
+    /// Start time of the span.
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace APLClient
+
+#define APL_TRACE_CONCATENATE_INNER(a, b) a##b
+#define APL_TRACE_CONCATENATE(a, b) APL_TRACE_CONCATENATE_INNER(a, b)
+
+/**
+ * Records the enclosing scope as a trace span.
+ *
+ * @param name Span name, a string literal.
+ * @param category Span category, a string literal.
+ */
+#define APL_TRACE_SCOPE(name, category) \
+    APLClient::AplTraceSpan APL_TRACE_CONCATENATE(aplTraceSpan, __LINE__)(name, category)
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_APL_APLTRACE_H
@@ -0,0 +1,278 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include <rapidjson/reader.h>
+
+#include "APLClient/AplCommandDocumentPool.h"
+
+namespace APLClient {
+
+/// Size of the arena the values of a document are allocated from, enough for a typical command sequence.
+static const size_t VALUE_ARENA_SIZE = 16 * 1024;
+
+/// Size of the arena the parse stack of a document is allocated from.
+static const size_t STACK_ARENA_SIZE = 4 * 1024;
+
+/// Initial capacity of the parse stack of a document.
+static const size_t STACK_CAPACITY = 1024;
+
+/// Payload buffers larger than this are released rather than kept with an idle document.
+static const size_t MAX_RETAINED_BUFFER_SIZE = 64 * 1024;
+
+/// Name of the member holding the commands.
+static const char COMMANDS_KEY[] = "commands";
+
+/**
+ * Forwards the value of the top level @c commands member of a payload to a document and skips everything else.
+ * Rejects, and so stops the parse, as soon as the payload is not an object, its @c commands member is not an array or
+ * it has more than one @c commands member.
+ */
+template <typename Handler>
+class CommandsFilter {
+public:
+    /**
+     * Constructor
+     *
+     * @param handler The handler receiving the commands array
+     */
+    explicit CommandsFilter(Handler& handler) :
+            m_handler(handler),
+            m_depth{0},
+            m_expectCommands{false},
+            m_forwarding{false},
+            m_found{false} {
+    }
+
+    /**
+     * @return Whether a complete @c commands array was forwarded
+     */
+    bool isComplete() const {
+        return m_found && !m_forwarding;
+    }
+
+    bool Null() {
+        return beginScalar() && (!m_forwarding || m_handler.Null());
+    }
+
+    bool Bool(bool value) {
+        return beginScalar() && (!m_forwarding || m_handler.Bool(value));
+    }
+
+    bool Int(int value) {
+        return beginScalar() && (!m_forwarding || m_handler.Int(value));
+    }
+
+    bool Uint(unsigned value) {
+        return beginScalar() && (!m_forwarding || m_handler.Uint(value));
+    }
+
+    bool Int64(int64_t value) {
+        return beginScalar() && (!m_forwarding || m_handler.Int64(value));
+    }
+
+    bool Uint64(uint64_t value) {
+        return beginScalar() && (!m_forwarding || m_handler.Uint64(value));
+    }
+
+    bool Double(double value) {
+        return beginScalar() && (!m_forwarding || m_handler.Double(value));
+    }
+
+    bool RawNumber(const char* value, rapidjson::SizeType length, bool copy) {
+        return beginScalar() && (!m_forwarding || m_handler.RawNumber(value, length, copy));
+    }
+
+    bool String(const char* value, rapidjson::SizeType length, bool copy) {
+        return beginScalar() && (!m_forwarding || m_handler.String(value, length, copy));
+    }
+
+    bool StartObject() {
+        if (0 == m_depth) {
+            m_depth++;
+            return true;
+        }
+        if (!beginScalar()) {
+            return false;
+        }
+        m_depth++;
+        return !m_forwarding || m_handler.StartObject();
+    }
+
+    bool Key(const char* value, rapidjson::SizeType length, bool copy) {
+        if (1 == m_depth) {
+            if (length == sizeof(COMMANDS_KEY) - 1 && 0 == std::memcmp(value, COMMANDS_KEY, length)) {
+                if (m_found) {
+                    return false;
+                }
+                m_expectCommands = true;
+            }
+            return true;
+        }
+        return !m_forwarding || m_handler.Key(value, length, copy);
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount) {
+        m_depth--;
+        return !m_forwarding || m_handler.EndObject(memberCount);
+    }
+
+    bool StartArray() {
+        if (0 == m_depth) {
+            return false;
+        }
+        if (m_expectCommands) {
+            m_expectCommands = false;
+            m_forwarding = true;
+            m_found = true;
+        }
+        m_depth++;
+        return !m_forwarding || m_handler.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount) {
+        m_depth--;
+        if (!m_forwarding) {
+            return true;
+        }
+        if (1 == m_depth) {
+            m_forwarding = false;
+        }
+        return m_handler.EndArray(elementCount);
+    }
+
+private:
+    /**
+     * Checks a value other than an array.
+     *
+     * @return Whether the value may appear at this point
+     */
+    bool beginScalar() {
+        return m_depth > 0 && !m_expectCommands;
+    }
+
+    /// The handler receiving the commands array
+    Handler& m_handler;
+
+    /// Nesting depth of the parse, 1 within the top level object
+    int m_depth;
+
+    /// Whether the next value is the value of the @c commands member
+    bool m_expectCommands;
+
+    /// Whether the values parsed are part of the commands array
+    bool m_forwarding;
+
+    /// Whether a @c commands member was found
+    bool m_found;
+};
+
+/**
+ * Populates a document with the commands array of a payload parsed in place.
+ */
+class CommandsGenerator {
+public:
+    /**
+     * Constructor
+     *
+     * @param buffer The null terminated payload, modified by the parse
+     * @param stackAllocator Allocator of the parse stack
+     */
+    CommandsGenerator(char* buffer, rapidjson::MemoryPoolAllocator<>* stackAllocator) :
+            m_buffer{buffer},
+            m_stackAllocator{stackAllocator} {
+    }
+
+    template <typename Handler>
+    bool operator()(Handler& handler) {
+        CommandsFilter<Handler> filter(handler);
+        rapidjson::InsituStringStream stream(m_buffer);
+        rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>> reader(
+            m_stackAllocator);
+        return !reader.Parse<rapidjson::kParseInsituFlag>(stream, filter).IsError() && filter.isComplete();
+    }
+
+private:
+    /// The payload
+    char* m_buffer;
+
+    /// Allocator of the parse stack
+    rapidjson::MemoryPoolAllocator<>* m_stackAllocator;
+};
+
+AplCommandDocumentPool::Entry::Entry() :
+        valueArena{new char[VALUE_ARENA_SIZE]},
+        stackArena{new char[STACK_ARENA_SIZE]},
+        valueAllocator{valueArena.get(), VALUE_ARENA_SIZE},
+        stackAllocator{stackArena.get(), STACK_ARENA_SIZE},
+        document{&valueAllocator, STACK_CAPACITY, &stackAllocator} {
+}
+
+AplCommandDocumentPool::Recycler::Recycler(std::weak_ptr<State> state) : m_state{std::move(state)} {
+}
+
+void AplCommandDocumentPool::Recycler::operator()(Entry* entry) const {
+    std::unique_ptr<Entry> owned{entry};
+    auto state = m_state.lock();
+    if (!state) {
+        return;
+    }
+
+    // Values allocated from a memory pool need no destruction, clearing the pools reclaims them all at once.
+    owned->document.SetNull();
+    owned->valueAllocator.Clear();
+    owned->stackAllocator.Clear();
+    if (owned->buffer.capacity() > MAX_RETAINED_BUFFER_SIZE) {
+        std::vector<char>().swap(owned->buffer);
+    }
+
+    std::lock_guard<std::mutex> lock{state->mutex};
+    if (state->idle.size() < state->maxIdle) {
+        state->idle.push_back(std::move(owned));
+    }
+}
+
+AplCommandDocumentPool::AplCommandDocumentPool(size_t maxIdle) : m_state{std::make_shared<State>()} {
+    m_state->maxIdle = maxIdle;
+}
+
+std::unique_ptr<AplCommandDocumentPool::Entry> AplCommandDocumentPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock{m_state->mutex};
+        if (!m_state->idle.empty()) {
+            auto entry = std::move(m_state->idle.back());
+            m_state->idle.pop_back();
+            return entry;
+        }
+    }
+    return std::unique_ptr<Entry>(new Entry());
+}
+
+std::shared_ptr<const rapidjson::Value> AplCommandDocumentPool::parseCommands(const std::string& payload) {
+    std::shared_ptr<Entry> entry{acquire().release(), Recycler{m_state}};
+
+    entry->buffer.assign(payload.begin(), payload.end());
+    entry->buffer.push_back('\0');
+    CommandsGenerator generator{entry->buffer.data(), &entry->stackAllocator};
+    entry->document.Populate(generator);
+    if (!entry->document.IsArray()) {
+        return nullptr;
+    }
+
+    return std::shared_ptr<const rapidjson::Value>(entry, &entry->document);
+}
+
+}  // namespace APLClient
@@ -13,9 +13,16 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <cstring>
+
+#include <rapidjson/reader.h>
+
 #include "APLClient/AplCoreTextMeasurement.h"
+#include "APLClient/AplClientLog.h"
 #include "APLClient/AplCoreConnectionManager.h"
 #include "APLClient/AplCoreViewhostMessage.h"
+#include "APLClient/AplTrace.h"
 
 #include <apl/datasource/dynamicindexlistdatasourceprovider.h>
 
@@ -74,6 +81,30 @@ static const char SOURCE_KEY[] = "source";
 static const char ARGUMENTS_KEY[] = "arguments";
 static const char COMPONENTS_KEY[] = "components";
 
+/// DynamicIndexList fetch request keys
+static const char LIST_ID_KEY[] = "listId";
+static const char CORRELATION_TOKEN_KEY[] = "correlationToken";
+static const char START_INDEX_KEY[] = "startIndex";
+static const char COUNT_KEY[] = "count";
+
+/// Maximum number of read-ahead requests per DynamicIndexList, unanswered or holding a response
+static const size_t MAX_READ_AHEAD_REQUESTS = 2;
+
+/// How far ahead of a scrolling DynamicIndexList items are read
+static const std::chrono::milliseconds PREFETCH_HORIZON{2000};
+
+/// Maximum number of items of a single read-ahead request
+static const int MAX_READ_AHEAD_ITEMS = 50;
+
+/// Time after which an unanswered read-ahead request is given up, matching the APL Core fetch timeout
+static const std::chrono::milliseconds FETCH_REQUEST_TIMEOUT{5000};
+
+/// How long after a fetch request data source errors are polled for, covering the APL Core fetch timeout and retries
+static const std::chrono::milliseconds FETCH_ERROR_WATCH_PERIOD{16000};
+
+/// Interval of data source error checks while fetch requests may time out
+static const std::chrono::milliseconds FETCH_ERROR_CHECK_INTERVAL{500};
+
 /// RuntimeError keys
 static const char ERRORS_KEY[] = "errors";
 
@@ -87,6 +118,17 @@ static const char DURATION_KEY[] = "duration";
 static const char PAUSED_KEY[] = "paused";
 static const char ENDED_KEY[] = "ended";
 
+/// View host messages which may be coalesced per frame
+static const std::string UPDATE_MESSAGE{"update"};
+static const std::string UPDATE_MEDIA_MESSAGE{"updateMedia"};
+static const std::string UPDATE_CURSOR_POSITION_MESSAGE{"updateCursorPosition"};
+
+/// Graphic update keys
+static const char AVG_KEY[] = "avg";
+
+/// Maximum total length of the AVG text of parsed graphics kept across documents
+static const size_t GRAPHIC_CACHE_MAX_BYTES = 2 * 1024 * 1024;
+
 /// Activity tracking sources
 static const std::string APL_COMMAND_EXECUTION{"APLCommandExecution"};
 static const std::string APL_SCREEN_LOCK{"APLScreenLock"};
@@ -107,12 +149,146 @@ static apl::Bimap<std::string, apl::ScreenShape> AVS_VIEWPORT_SHAPE_MAP = {
     {"RECTANGLE", apl::ScreenShape::RECTANGLE},
 };
 
+/**
+ * Reads the top level @c listId and @c correlationToken strings of a data source update, which route it.  Rejects, and
+ * so stops the parse, once both are read, so the items following them are not parsed.  The first of duplicate members
+ * is read.
+ */
+class DataSourceUpdateRoutingHandler
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, DataSourceUpdateRoutingHandler> {
+public:
+    /// Constructor
+    DataSourceUpdateRoutingHandler() :
+            m_depth{0},
+            m_target{nullptr},
+            m_hasListId{false},
+            m_hasCorrelationToken{false},
+            m_stringsRead{0} {
+    }
+
+    /**
+     * @return Whether both members were read
+     */
+    bool isComplete() const {
+        return ROUTING_MEMBER_COUNT == m_stringsRead;
+    }
+
+    /**
+     * @return The list id
+     */
+    const std::string& listId() const {
+        return m_listId;
+    }
+
+    /**
+     * @return The correlation token
+     */
+    const std::string& correlationToken() const {
+        return m_correlationToken;
+    }
+
+    bool Default() {
+        m_target = nullptr;
+        return m_depth > 0;
+    }
+
+    bool String(const char* value, rapidjson::SizeType length, bool) {
+        if (!m_target) {
+            return m_depth > 0;
+        }
+        m_target->assign(value, length);
+        m_target = nullptr;
+        m_stringsRead++;
+        return !isComplete();
+    }
+
+    bool StartObject() {
+        m_target = nullptr;
+        m_depth++;
+        return true;
+    }
+
+    bool Key(const char* value, rapidjson::SizeType length, bool) {
+        if (1 != m_depth) {
+            return true;
+        }
+        m_target = nullptr;
+        if (!m_hasListId && isKey(LIST_ID_KEY, value, length)) {
+            m_hasListId = true;
+            m_target = &m_listId;
+        } else if (!m_hasCorrelationToken && isKey(CORRELATION_TOKEN_KEY, value, length)) {
+            m_hasCorrelationToken = true;
+            m_target = &m_correlationToken;
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        m_depth--;
+        return true;
+    }
+
+    bool StartArray() {
+        m_target = nullptr;
+        m_depth++;
+        return m_depth > 1;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        m_depth--;
+        return true;
+    }
+
+private:
+    /// Number of members routing an update
+    static const int ROUTING_MEMBER_COUNT = 2;
+
+    /**
+     * @param key The key to match
+     * @param value The parsed key
+     * @param length The length of @c value
+     * @return Whether @c value is @c key
+     */
+    template <size_t N>
+    static bool isKey(const char (&key)[N], const char* value, rapidjson::SizeType length) {
+        return length == N - 1 && 0 == std::memcmp(value, key, length);
+    }
+
+    /// Nesting depth of the parse, 1 within the top level object
+    int m_depth;
+
+    /// Where the next string is read to, if it is the value of a routing member
+    std::string* m_target;
+
+    /// Whether the list id member was found
+    bool m_hasListId;
+
+    /// Whether the correlation token member was found
+    bool m_hasCorrelationToken;
+
+    /// Number of routing members read as strings
+    int m_stringsRead;
+
+    /// The list id
+    std::string m_listId;
+
+    /// The correlation token
+    std::string m_correlationToken;
+};
+
 AplCoreConnectionManager::AplCoreConnectionManager(const AplOptionsInterfacePtr aplOptions) :
+        m_documentHash{0},
+        m_graphicCache{GRAPHIC_CACHE_MAX_BYTES},
+        m_dataSourcePrefetcher{MAX_READ_AHEAD_REQUESTS,
+                               PREFETCH_HORIZON,
+                               MAX_READ_AHEAD_ITEMS,
+                               FETCH_REQUEST_TIMEOUT},
         m_aplOptions{aplOptions},
         m_ScreenLock{false},
         m_SequenceNumber{0},
         m_replyExpectedSequenceNumber{0},
-        m_blockingSendReplyExpected{false} {
+        m_blockingSendReplyExpected{false},
+        m_dataSourceErrorsPending{false} {
     m_StartTime = getCurrentTime();
     m_messageHandlers.emplace("build", [this](const rapidjson::Value& payload) { handleBuild(payload); });
     m_messageHandlers.emplace("update", [this](const rapidjson::Value& payload) { handleUpdate(payload); });
@@ -129,21 +305,25 @@ AplCoreConnectionManager::AplCoreConnectionManager(const AplOptionsInterfacePtr
         "updateCursorPosition", [this](const rapidjson::Value& payload) { handleUpdateCursorPosition(payload); });
 }
 
-void AplCoreConnectionManager::setContent(const apl::ContentPtr content, const std::string& token) {
+void AplCoreConnectionManager::setContent(
+    const apl::ContentPtr content,
+    const std::string& token,
+    size_t documentHash) {
     m_Content = content;
     m_aplToken = token;
+    m_documentHash = documentHash;
     m_aplOptions->resetViewhost(token);
 }
 
 void AplCoreConnectionManager::setSupportedViewports(const std::string& jsonPayload) {
     rapidjson::Document doc;
     if (doc.Parse(jsonPayload.c_str()).HasParseError()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "setSupportedViewportsFailed", "Failed to parse json payload");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "setSupportedViewportsFailed", "Failed to parse json payload");
         return;
     }
 
     if (doc.GetType() != rapidjson::Type::kArrayType) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "setSupportedViewportsFailed", "Unexpected json document type");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "setSupportedViewportsFailed", "Unexpected json document type");
         return;
     }
 
@@ -217,20 +397,26 @@ int AplCoreConnectionManager::getOptionalInt(
 }
 
 bool AplCoreConnectionManager::shouldHandleMessage(const std::string& message) {
-    if (m_blockingSendReplyExpected) {
-        rapidjson::Document doc;
-        if (doc.Parse(message.c_str()).HasParseError()) {
-            m_aplOptions->logMessage(LogLevel::ERROR, "shouldHandleMessageFailed", "Error whilst parsing message");
-            return false;
+    {
+        std::lock_guard<std::mutex> lock{m_replyMutex};
+        if (!m_blockingSendReplyExpected) {
+            return true;
         }
+    }
 
-        if (doc.HasMember(SEQNO_KEY) && doc[SEQNO_KEY].IsNumber()) {
-            unsigned int seqno = doc[SEQNO_KEY].GetUint();
-            if (seqno == m_replyExpectedSequenceNumber) {
-                m_blockingSendReplyExpected = false;
-                m_replyPromise.set_value(message);
-                return false;
-            }
+    rapidjson::Document doc;
+    if (doc.Parse(message.c_str()).HasParseError()) {
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "shouldHandleMessageFailed", "Error whilst parsing message");
+        return false;
+    }
+
+    if (doc.HasMember(SEQNO_KEY) && doc[SEQNO_KEY].IsNumber()) {
+        unsigned int seqno = doc[SEQNO_KEY].GetUint();
+        std::lock_guard<std::mutex> lock{m_replyMutex};
+        if (m_blockingSendReplyExpected && seqno == m_replyExpectedSequenceNumber) {
+            m_blockingSendReplyExpected = false;
+            m_replyPromise.set_value(message);
+            return false;
         }
     }
 
@@ -238,77 +424,178 @@ bool AplCoreConnectionManager::shouldHandleMessage(const std::string& message) {
 }
 
 void AplCoreConnectionManager::handleMessage(const std::string& message) {
+    APL_TRACE_SCOPE("handleMessage", "viewhost");
     rapidjson::Document doc;
     if (doc.Parse(message.c_str()).HasParseError()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleMessageFailed", "Error whilst parsing message");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleMessageFailed", "Error whilst parsing message");
         return;
     }
 
     if (!doc.HasMember("type")) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleMessageFailed", "Unable to find type in message");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleMessageFailed", "Unable to find type in message");
         return;
     }
     std::string type = doc["type"].GetString();
 
     auto payload = doc.FindMember("payload");
     if (payload == doc.MemberEnd()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleMessageFailed", "Unable to find payload in message");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleMessageFailed", "Unable to find payload in message");
         return;
     }
 
     auto fit = m_messageHandlers.find(type);
     if (fit != m_messageHandlers.end()) {
+        auto key = getCoalescingKey(type, payload->value);
+        if (!key.empty()) {
+            stageInput(key, type, payload->value);
+            return;
+        }
+        // Anything else must observe the input received before it.
+        applyStagedInputs();
         fit->second(payload->value);
     } else {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleMessageFailed", "Unrecognized message type: " + type);
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleMessageFailed", "Unrecognized message type: " + type);
     }
 }
 
-void AplCoreConnectionManager::executeCommands(const std::string& command, const std::string& token) {
-    if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "executeCommandsFailed", "Root context is missing");
+apl::ComponentPtr AplCoreConnectionManager::findComponent(const std::string& id) {
+    auto it = m_componentIndex.find(id);
+    if (it != m_componentIndex.end()) {
+        auto component = it->second.lock();
+        if (component) {
+            return component;
+        }
+        m_componentIndex.erase(it);
+    }
+
+    // Components referenced by their document id, or missed by the index, need a tree search.
+    auto component = m_Root->context().findComponentById(id);
+    if (component && component->getUniqueId() == id) {
+        m_componentIndex.emplace(id, component);
+    }
+    return component;
+}
+
+void AplCoreConnectionManager::indexComponents(const apl::ComponentPtr& component) {
+    if (!component) {
+        return;
+    }
+    m_componentIndex[component->getUniqueId()] = component;
+    for (size_t i = 0; i < component->getChildCount(); i++) {
+        indexComponents(component->getChildAt(i));
+    }
+}
+
+void AplCoreConnectionManager::unindexComponents(const std::string& uid) {
+    auto it = m_componentIndex.find(uid);
+    if (it == m_componentIndex.end()) {
+        return;
+    }
+    auto component = it->second.lock();
+    m_componentIndex.erase(it);
+    if (component) {
+        for (size_t i = 0; i < component->getChildCount(); i++) {
+            unindexComponents(component->getChildAt(i)->getUniqueId());
+        }
+    }
+}
+
+std::string AplCoreConnectionManager::getCoalescingKey(const std::string& type, const rapidjson::Value& payload) {
+    if (!payload.IsObject()) {
+        return "";
+    }
+
+    auto id = payload.FindMember("id");
+    if (type == UPDATE_MESSAGE) {
+        auto updateType = payload.FindMember("type");
+        if (id != payload.MemberEnd() && id->value.IsString() && updateType != payload.MemberEnd() &&
+            updateType->value.IsInt() && updateType->value.GetInt() == apl::UpdateType::kUpdateScrollPosition) {
+            return type + ":" + id->value.GetString() + ":" + std::to_string(updateType->value.GetInt());
+        }
+    } else if (type == UPDATE_MEDIA_MESSAGE) {
+        // Media state changes raised by media events trigger handlers and are kept in order.
+        auto fromEvent = payload.FindMember(FROM_EVENT_KEY);
+        if (id != payload.MemberEnd() && id->value.IsString() && fromEvent != payload.MemberEnd() &&
+            fromEvent->value.IsBool() && !fromEvent->value.GetBool()) {
+            return type + ":" + id->value.GetString();
+        }
+    } else if (type == UPDATE_CURSOR_POSITION_MESSAGE) {
+        return type;
+    }
+    return "";
+}
+
+void AplCoreConnectionManager::stageInput(
+    const std::string& key,
+    const std::string& type,
+    const rapidjson::Value& payload) {
+    // A fresh document per message, re-using one would grow its allocator until the next frame.
+    std::unique_ptr<rapidjson::Document> copy(new rapidjson::Document());
+    copy->CopyFrom(payload, copy->GetAllocator());
+
+    auto it = m_stagedInputIndices.find(key);
+    if (it != m_stagedInputIndices.end()) {
+        m_stagedInputs[it->second].payload = std::move(copy);
         return;
     }
+    m_stagedInputIndices.emplace(key, m_stagedInputs.size());
+    m_stagedInputs.push_back({type, std::move(copy)});
+}
 
-    rapidjson::Document* document = new rapidjson::Document();
-    if (document->Parse(command).HasParseError()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "executeCommandsFailed", "Parse commands failed");
+void AplCoreConnectionManager::applyStagedInputs() {
+    if (m_stagedInputs.empty()) {
         return;
     }
+    APL_TRACE_SCOPE("applyStagedInputs", "apl");
+
+    auto stagedInputs = std::move(m_stagedInputs);
+    m_stagedInputs.clear();
+    m_stagedInputIndices.clear();
+    for (auto& input : stagedInputs) {
+        auto fit = m_messageHandlers.find(input.type);
+        if (fit != m_messageHandlers.end()) {
+            fit->second(*input.payload);
+        }
+    }
+}
 
-    auto it = document->FindMember("commands");
-    if (it == document->MemberEnd() || it->value.GetType() != rapidjson::Type::kArrayType) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "executeCommandsFailed", "Missing commands, or is not array");
+void AplCoreConnectionManager::executeCommands(const std::string& command, const std::string& token) {
+    if (!m_Root) {
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "executeCommandsFailed", "Root context is missing");
         return;
     }
 
-    apl::Object object{it->value};
+    applyStagedInputs();
+
+    auto commands = m_commandDocumentPool.parseCommands(command);
+    if (!commands) {
+        APLCLIENT_LOG(
+            m_aplOptions, LogLevel::ERROR, "executeCommandsFailed", "Parse commands failed, or commands is not array");
+        return;
+    }
+
+    apl::Object object{*commands};
     auto action = m_Root->executeCommands(object, false);
     if (!action) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "executeCommandsFailed", "Execute commands failed");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "executeCommandsFailed", "Execute commands failed");
         return;
     }
 
     m_aplOptions->onActivityStarted(APL_COMMAND_EXECUTION);
 
-    action->setUserData(document);
+    // APL Core references the parsed commands until the sequence resolves, the document returns to the pool then.
+    auto lease = std::make_shared<std::shared_ptr<const rapidjson::Value>>(std::move(commands));
 
-    action->then([this, document, token](const apl::ActionPtr& action) {
-        m_aplOptions->logMessage(LogLevel::DBG, "executeCommands", "Command sequence complete");
-        if (action->getUserData()) {
-            delete document;
-            action->setUserData(nullptr);
-        }
+    action->then([this, lease, token](const apl::ActionPtr&) {
+        APLCLIENT_LOG(m_aplOptions, LogLevel::DBG, "executeCommands", "Command sequence complete");
+        lease->reset();
         m_aplOptions->onCommandExecutionComplete(token, true);
 
         m_aplOptions->onActivityEnded(APL_COMMAND_EXECUTION);
     });
-    action->addTerminateCallback([this, action, document, token](const apl::TimersPtr&) {
-        m_aplOptions->logMessage(LogLevel::DBG, "executeCommandsFailed", "Command sequence failed");
-        if (action->getUserData()) {
-            delete document;
-            action->setUserData(nullptr);
-        }
+    action->addTerminateCallback([this, lease, token](const apl::TimersPtr&) {
+        APLCLIENT_LOG(m_aplOptions, LogLevel::DBG, "executeCommandsFailed", "Command sequence failed");
+        lease->reset();
         m_aplOptions->onCommandExecutionComplete(token, false);
 
         m_aplOptions->onActivityEnded(APL_COMMAND_EXECUTION);
@@ -320,26 +607,89 @@ void AplCoreConnectionManager::dataSourceUpdate(
     const std::string& jsonPayload,
     const std::string& token) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "dataSourceUpdateFailed", "Root context is missing");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "dataSourceUpdateFailed", "Root context is missing");
         return;
     }
 
     auto provider = m_Root->context().getRootConfig().getDataSourceProvider(sourceType);
     if (!provider) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "dataSourceUpdateFailed", "Unknown provider requested.");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "dataSourceUpdateFailed", "Unknown provider requested.");
         return;
     }
 
-    bool result = provider->processUpdate(jsonPayload);
-    if (!result) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "dataSourceUpdateFailed", "Update is not processed.");
-        checkAndSendDataSourceErrors();
+    std::string key;
+    DataSourceUpdateRoutingHandler routing;
+    rapidjson::StringStream stream(jsonPayload.c_str());
+    rapidjson::Reader().Parse(stream, routing);
+    if (routing.isComplete()) {
+        // Responses to read-ahead requests are held until APL Core asks for their items.
+        if (AplDataSourcePrefetcher::isReadAheadToken(routing.correlationToken())) {
+            std::vector<AplDataSourcePrefetcher::Answer> answers;
+            m_dataSourcePrefetcher.onReadAheadResponse(
+                routing.listId(), routing.correlationToken(), jsonPayload, &answers);
+            queueDataSourceAnswers(answers);
+            return;
+        }
+        key = routing.listId() + ":" + routing.correlationToken();
     }
+    queueDataSourceUpdate(key, sourceType, jsonPayload);
+}
+
+void AplCoreConnectionManager::queueDataSourceUpdate(
+    const std::string& key,
+    const std::string& sourceType,
+    const std::string& jsonPayload) {
+    // Updates are applied together at the start of the next frame, so that a burst of pages is laid out and
+    // serialized once.  A repeated response to the same request replaces the earlier one, and takes its place after
+    // the updates received in between so updates are applied in arrival order.
+    if (!key.empty()) {
+        m_pendingDataSourceUpdates.erase(
+            std::remove_if(
+                m_pendingDataSourceUpdates.begin(),
+                m_pendingDataSourceUpdates.end(),
+                [&key](const PendingDataSourceUpdate& pending) { return pending.key == key; }),
+            m_pendingDataSourceUpdates.end());
+    }
+    m_pendingDataSourceUpdates.push_back({key, sourceType, jsonPayload});
+}
+
+void AplCoreConnectionManager::queueDataSourceAnswers(const std::vector<AplDataSourcePrefetcher::Answer>& answers) {
+    for (auto& answer : answers) {
+        if (answer.payload.empty()) {
+            APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "dataSourceUpdateFailed", "Invalid read-ahead response");
+            continue;
+        }
+        queueDataSourceUpdate(answer.listId + ":" + answer.correlationToken, answer.type, answer.payload);
+    }
+}
+
+void AplCoreConnectionManager::applyDataSourceUpdates() {
+    if (m_pendingDataSourceUpdates.empty()) {
+        return;
+    }
+    APL_TRACE_SCOPE("applyDataSourceUpdates", "apl");
+
+    auto updates = std::move(m_pendingDataSourceUpdates);
+    m_pendingDataSourceUpdates.clear();
+    for (auto& update : updates) {
+        auto provider = m_Root->context().getRootConfig().getDataSourceProvider(update.sourceType);
+        if (!provider) {
+            APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "dataSourceUpdateFailed", "Unknown provider requested.");
+            continue;
+        }
+
+        bool result = provider->processUpdate(update.payload);
+        if (!result) {
+            APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "dataSourceUpdateFailed", "Update is not processed.");
+        }
+    }
+    // Errors of all updates of this frame are reported together.
+    m_dataSourceErrorsPending = true;
 }
 
 void AplCoreConnectionManager::provideState(unsigned int stateRequestToken) {
     if (!m_Content) {
-        m_aplOptions->logMessage(LogLevel::WARN, "provideStateFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, "provideStateFailed", "Root context is null");
         sendError("Root context is null");
         return;
     }
@@ -357,7 +707,7 @@ void AplCoreConnectionManager::provideState(unsigned int stateRequestToken) {
         auto context = m_Root->topComponent()->serializeVisualContext(allocator);
         arr.PushBack(context, allocator);
     } else {
-        m_aplOptions->logMessage(LogLevel::ERROR, "provideStateFailed", "Unable to get visual context");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "provideStateFailed", "Unable to get visual context");
         rapidjson::Value emptyObj(rapidjson::kObjectType);
         // add an empty visual context
         arr.PushBack(emptyObj, allocator);
@@ -375,6 +725,7 @@ void AplCoreConnectionManager::interruptCommandSequence() {
 }
 
 void AplCoreConnectionManager::handleBuild(const rapidjson::Value& message) {
+    APL_TRACE_SCOPE("handleBuild", "apl");
     /* APL Document Inflation started */
     m_aplOptions->onRenderingEvent(AplRenderingEvent::INFLATE_BEGIN);
 
@@ -384,7 +735,7 @@ void AplCoreConnectionManager::handleBuild(const rapidjson::Value& message) {
     send(renderingOptionsMsg.setPayload(std::move(renderingOptions)));
 
     if (!m_Content) {
-        m_aplOptions->logMessage(LogLevel::WARN, "handleBuildFailed", "No content to build");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, "handleBuildFailed", "No content to build");
         sendError("No content to build");
         return;
     }
@@ -428,9 +779,16 @@ void AplCoreConnectionManager::handleBuild(const rapidjson::Value& message) {
         .shape(AVS_VIEWPORT_SHAPE_MAP.at(message[SHAPE_KEY].GetString()))
         .mode(AVS_VIEWPORT_MODE_MAP.at(message[MODE_KEY].GetString()));
 
-    do {
-        apl::ScalingOptions scalingOptions = {
-            m_ViewportSizeSpecifications, SCALING_BIAS_CONSTANT, SCALING_SHAPE_OVERRIDES_COST};
+    // Specifications the document is known not to inflate with are left out, so it is usually inflated once.
+    auto selectionKey = std::to_string(m_documentHash) + '/' + std::to_string(message[WIDTH_KEY].GetInt()) + 'x' +
+                        std::to_string(message[HEIGHT_KEY].GetInt()) + '@' +
+                        std::to_string(message[DPI_KEY].GetInt()) + '/' + message[SHAPE_KEY].GetString() + '/' +
+                        message[MODE_KEY].GetString();
+    auto candidates = m_viewportSelectionCache.getCandidates(selectionKey, m_ViewportSizeSpecifications);
+    m_Root = nullptr;
+
+    while (m_ViewportSizeSpecifications.empty() || !candidates.empty()) {
+        apl::ScalingOptions scalingOptions = {candidates, SCALING_BIAS_CONSTANT, SCALING_SHAPE_OVERRIDES_COST};
         if (!scalingOptions.getSpecifications().empty()) {
             m_AplCoreMetrics = std::make_shared<AplCoreMetrics>(m_Metrics, scalingOptions);
         } else {
@@ -446,26 +804,24 @@ void AplCoreConnectionManager::handleBuild(const rapidjson::Value& message) {
         send(reply.setPayload(std::move(scaling)));
 
         m_StartTime = getCurrentTime();
+        APL_TRACE_SCOPE("inflate", "apl");
         m_Root = apl::RootContext::create(m_AplCoreMetrics->getMetrics(), m_Content, config);
-        if (m_Root) {
+        if (m_ViewportSizeSpecifications.empty()) {
             break;
-        } else if (!m_ViewportSizeSpecifications.empty()) {
-            m_aplOptions->logMessage(
-                LogLevel::WARN, __func__, "Unable to inflate document with current chosen scaling.");
         }
 
-        auto it = m_ViewportSizeSpecifications.begin();
-        for (; it != m_ViewportSizeSpecifications.end(); it++) {
-            if (*it == m_AplCoreMetrics->getChosenSpec()) {
-                m_ViewportSizeSpecifications.erase(it);
-                break;
-            }
-        }
-        if (it == m_ViewportSizeSpecifications.end()) {
+        if (!m_viewportSelectionCache.recordInflation(
+                selectionKey, m_ViewportSizeSpecifications, m_AplCoreMetrics->getChosenSpec(), m_Root != nullptr)) {
             // Core returned specification that is not in list. Something went wrong. Prevent infinite loop.
             break;
         }
-    } while (!m_ViewportSizeSpecifications.empty());
+        if (m_Root) {
+            break;
+        }
+        APLCLIENT_LOG(
+            m_aplOptions, LogLevel::WARN, __func__, "Unable to inflate document with current chosen scaling.");
+        candidates = m_viewportSelectionCache.getCandidates(selectionKey, m_ViewportSizeSpecifications);
+    }
 
     /* APL Core Inflation ended */
     m_aplOptions->onRenderingEvent(AplRenderingEvent::INFLATE_END);
@@ -478,11 +834,18 @@ void AplCoreConnectionManager::handleBuild(const rapidjson::Value& message) {
         auto reply = AplCoreViewhostMessage(HIERARCHY_KEY);
         send(reply.setPayload(m_Root->topComponent()->serialize(reply.alloc())));
 
+        m_componentIndex.clear();
+        indexComponents(m_Root->topComponent());
+        m_dataSourcePrefetcher.reset();
+        m_pendingDataSourceUpdates.clear();
+        m_dataSourceErrorsPending = false;
+        m_fetchErrorWatchDeadline = AplDataSourcePrefetcher::Clock::time_point();
+
         auto idleTimeout = std::chrono::milliseconds(m_Root->settings().idleTimeout());
         m_aplOptions->onSetDocumentIdleTimeout(idleTimeout);
         m_aplOptions->onRenderDocumentComplete(m_aplToken, true, "");
     } else {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleBuildFailed", "Unable to inflate document");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleBuildFailed", "Unable to inflate document");
         sendError("Unable to inflate document");
         m_aplOptions->onRenderDocumentComplete(m_aplToken, false, "Unable to inflate document");
         // Send DataSource errors if any
@@ -533,15 +896,18 @@ void AplCoreConnectionManager::sendScreenLockMessage(bool screenLock) {
 
 void AplCoreConnectionManager::handleUpdate(const rapidjson::Value& update) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleUpdateFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleUpdateFailed", "Root context is null");
         return;
     }
 
     auto id = update["id"].GetString();
-    auto component = m_Root->context().findComponentById(id);
+    auto component = findComponent(id);
     if (!component) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleUpdateFailed", std::string("Unable to find component with id: ") + id);
+        APLCLIENT_LOG(
+            m_aplOptions,
+            LogLevel::ERROR,
+            "handleUpdateFailed",
+            std::string("Unable to find component with id: ") + id);
         sendError("Unable to find component");
         return;
     }
@@ -557,22 +923,25 @@ void AplCoreConnectionManager::handleUpdate(const rapidjson::Value& update) {
 
 void AplCoreConnectionManager::handleMediaUpdate(const rapidjson::Value& update) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleMediaUpdateFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleMediaUpdateFailed", "Root context is null");
         return;
     }
 
     auto id = update["id"].GetString();
-    auto component = m_Root->context().findComponentById(id);
+    auto component = findComponent(id);
     if (!component) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleMediaUpdateFailed", std::string("Unable to find component with id: ") + id);
+        APLCLIENT_LOG(
+            m_aplOptions,
+            LogLevel::ERROR,
+            "handleMediaUpdateFailed",
+            std::string("Unable to find component with id: ") + id);
         sendError("Unable to find component");
         return;
     }
 
     if (!update.HasMember(MEDIA_STATE_KEY) || !update.HasMember(FROM_EVENT_KEY)) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleMediaUpdateFailed", "State update object is missing parameters");
+        APLCLIENT_LOG(
+            m_aplOptions, LogLevel::ERROR, "handleMediaUpdateFailed", "State update object is missing parameters");
         sendError("Can't update media state.");
         return;
     }
@@ -581,8 +950,11 @@ void AplCoreConnectionManager::handleMediaUpdate(const rapidjson::Value& update)
 
     if (!state.HasMember(TRACK_INDEX_KEY) || !state.HasMember(TRACK_COUNT_KEY) || !state.HasMember(CURRENT_TIME_KEY) ||
         !state.HasMember(DURATION_KEY) || !state.HasMember(PAUSED_KEY) || !state.HasMember(ENDED_KEY)) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleMediaUpdateFailed", "Can't update media state. MediaStatus structure is wrong");
+        APLCLIENT_LOG(
+            m_aplOptions,
+            LogLevel::ERROR,
+            "handleMediaUpdateFailed",
+            "Can't update media state. MediaStatus structure is wrong");
         sendError("Can't update media state.");
         return;
     }
@@ -600,34 +972,46 @@ void AplCoreConnectionManager::handleMediaUpdate(const rapidjson::Value& update)
 
 void AplCoreConnectionManager::handleGraphicUpdate(const rapidjson::Value& update) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleGraphicUpdateFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleGraphicUpdateFailed", "Root context is null");
         return;
     }
 
     auto id = update["id"].GetString();
-    auto component = m_Root->context().findComponentById(id);
+    auto component = findComponent(id);
     if (!component) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleGraphicUpdateFailed", std::string("Unable to find component with id:") + id);
+        APLCLIENT_LOG(
+            m_aplOptions,
+            LogLevel::ERROR,
+            "handleGraphicUpdateFailed",
+            std::string("Unable to find component with id:") + id);
         sendError("Unable to find component");
         return;
     }
 
-    auto json = apl::GraphicContent::create(update["avg"].GetString());
+    auto avg = update.FindMember(AVG_KEY);
+    if (avg == update.MemberEnd() || !avg->value.IsString()) {
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleGraphicUpdateFailed", "Missing avg");
+        sendError("Can't update graphic.");
+        return;
+    }
+    auto json = m_graphicCache.getOrCreate(avg->value.GetString(), avg->value.GetStringLength());
     component->updateGraphic(json);
 }
 
 void AplCoreConnectionManager::handleEnsureLayout(const rapidjson::Value& payload) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleEnsureLayoutFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleEnsureLayoutFailed", "Root context is null");
         return;
     }
 
     auto id = payload["id"].GetString();
-    auto component = m_Root->context().findComponentById(id);
+    auto component = findComponent(id);
     if (!component) {
-        m_aplOptions->logMessage(
-            LogLevel::ERROR, "handleEnsureLayoutFailed", std::string("Unable to find component with id:") + id);
+        APLCLIENT_LOG(
+            m_aplOptions,
+            LogLevel::ERROR,
+            "handleEnsureLayoutFailed",
+            std::string("Unable to find component with id:") + id);
         sendError("Unable to find component");
         return;
     }
@@ -639,14 +1023,15 @@ void AplCoreConnectionManager::handleEnsureLayout(const rapidjson::Value& payloa
 
 void AplCoreConnectionManager::handleScrollToRectInComponent(const rapidjson::Value& payload) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleScrollToRectInComponentFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleScrollToRectInComponentFailed", "Root context is null");
         return;
     }
 
     auto id = payload["id"].GetString();
-    auto component = m_Root->context().findComponentById(id);
+    auto component = findComponent(id);
     if (!component) {
-        m_aplOptions->logMessage(
+        APLCLIENT_LOG(
+            m_aplOptions,
             LogLevel::ERROR,
             "handleScrollToRectInComponentFailed",
             std::string("Unable to find component with id:") + id);
@@ -660,7 +1045,7 @@ void AplCoreConnectionManager::handleScrollToRectInComponent(const rapidjson::Va
 
 void AplCoreConnectionManager::handleHandleKeyboard(const rapidjson::Value& payload) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleHandleKeyboardFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleHandleKeyboardFailed", "Root context is null");
         return;
     }
 
@@ -683,7 +1068,7 @@ void AplCoreConnectionManager::handleHandleKeyboard(const rapidjson::Value& payl
 
 void AplCoreConnectionManager::handleUpdateCursorPosition(const rapidjson::Value& payload) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleUpdateCursorPositionFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleUpdateCursorPositionFailed", "Root context is null");
         return;
     }
 
@@ -695,12 +1080,12 @@ void AplCoreConnectionManager::handleUpdateCursorPosition(const rapidjson::Value
 
 void AplCoreConnectionManager::handleEventResponse(const rapidjson::Value& response) {
     if (!m_Root) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleEventResponseFailed", "Root context is null");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleEventResponseFailed", "Root context is null");
         return;
     }
 
     if (!response["event"].IsInt()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "handleEventResponseFailed", "Invalid event response");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "handleEventResponseFailed", "Invalid event response");
         sendError("Invalid event response");
         return;
     }
@@ -725,30 +1110,51 @@ void AplCoreConnectionManager::handleEventResponse(const rapidjson::Value& respo
 
 unsigned int AplCoreConnectionManager::send(AplCoreViewhostMessage& message) {
     unsigned int seqno = ++m_SequenceNumber;
-    m_aplOptions->sendMessage(message.setSequenceNumber(seqno).get());
+    send(message, seqno);
     return seqno;
 }
 
+void AplCoreConnectionManager::send(AplCoreViewhostMessage& message, unsigned int seqno) {
+    std::string payload;
+    {
+        APL_TRACE_SCOPE("serializeMessage", "viewhost");
+        payload = message.setSequenceNumber(seqno).get();
+    }
+    APL_TRACE_SCOPE("sendMessage", "viewhost");
+    m_aplOptions->sendMessage(payload);
+}
+
 rapidjson::Document AplCoreConnectionManager::blockingSend(
     AplCoreViewhostMessage& message,
     const std::chrono::milliseconds& timeout) {
     std::lock_guard<std::mutex> lock{m_blockingSendMutex};
-    m_replyPromise = std::promise<std::string>();
-    m_replyExpectedSequenceNumber = send(message);
-    m_blockingSendReplyExpected = true;
+    std::future<std::string> future;
+    unsigned int seqno;
+    {
+        // Arm the reply expectation before sending, the reply may be delivered before send() returns.
+        std::lock_guard<std::mutex> replyLock{m_replyMutex};
+        seqno = ++m_SequenceNumber;
+        m_replyPromise = std::promise<std::string>();
+        future = m_replyPromise.get_future();
+        m_replyExpectedSequenceNumber = seqno;
+        m_blockingSendReplyExpected = true;
+    }
+    send(message, seqno);
 
-    auto future = m_replyPromise.get_future();
     auto status = future.wait_for(timeout);
     if (status != std::future_status::ready) {
-        m_blockingSendReplyExpected = false;
+        {
+            std::lock_guard<std::mutex> replyLock{m_replyMutex};
+            m_blockingSendReplyExpected = false;
+        }
         // Under the situation that finish command destroys the renderer, there is no response.
-        m_aplOptions->logMessage(LogLevel::WARN, "blockingSendFailed", "Did not receive response");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, "blockingSendFailed", "Did not receive response");
         return rapidjson::Document(rapidjson::kNullType);
     }
 
     rapidjson::Document doc;
     if (doc.Parse(future.get()).HasParseError()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "blockingSendFailed", "parsingFailed");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "blockingSendFailed", "parsingFailed");
         return rapidjson::Document(rapidjson::kNullType);
     }
 
@@ -801,20 +1207,20 @@ void AplCoreConnectionManager::processEvent(const apl::Event& event) {
     }
 
     if (apl::EventType::kEventTypeDataSourceFetchRequest == event.getType()) {
-        rapidjson::Document fetchRequestPayloadJson(rapidjson::kObjectType);
-        auto& allocator = fetchRequestPayloadJson.GetAllocator();
         auto type = event.getValue(apl::EventProperty::kEventPropertyName);
         auto payload = event.getValue(apl::EventProperty::kEventPropertyValue);
 
-        apl::ObjectMap fetchRequest(payload.getMap());
-        fetchRequest.emplace(PRESENTATION_TOKEN_KEY, m_aplToken);
-
-        auto fetch = apl::Object(std::make_shared<apl::ObjectMap>(fetchRequest)).serialize(allocator);
-        rapidjson::StringBuffer sb;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-        fetch.Accept(writer);
-
-        m_aplOptions->onDataSourceFetchRequestEvent(type.asString(), sb.GetString());
+        AplDataSourcePrefetcher::FetchRequest request{type.asString(),
+                                                      payload.get(LIST_ID_KEY).asString(),
+                                                      payload.get(CORRELATION_TOKEN_KEY).asString(),
+                                                      payload.get(START_INDEX_KEY).asInt(),
+                                                      payload.get(COUNT_KEY).asInt()};
+        auto now = AplDataSourcePrefetcher::Clock::now();
+        std::vector<AplDataSourcePrefetcher::Answer> answers;
+        sendDataSourceFetchRequests(m_dataSourcePrefetcher.onFetchRequest(request, now, &answers));
+        queueDataSourceAnswers(answers);
+        // Core reports a fetch which is not answered after its retries as an error.
+        m_fetchErrorWatchDeadline = std::max(m_fetchErrorWatchDeadline, now + FETCH_ERROR_WATCH_PERIOD);
         return;
     }
 
@@ -835,13 +1241,14 @@ void AplCoreConnectionManager::processEvent(const apl::Event& event) {
                 payload.AddMember("token", token, msg.alloc());
                 send(msg.setPayload(std::move(payload)));
             } else {
-                m_aplOptions->logMessage(LogLevel::WARN, __func__, "Event was not pending");
+                APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, __func__, "Event was not pending");
             }
         });
     }
 }
 
 void AplCoreConnectionManager::processDirty(const std::set<apl::ComponentPtr>& dirty) {
+    APL_TRACE_SCOPE("processDirty", "apl");
     std::map<std::string, rapidjson::Value> tempDirty;
     auto msg = AplCoreViewhostMessage(DIRTY_KEY);
 
@@ -858,7 +1265,11 @@ void AplCoreConnectionManager::processDirty(const std::set<apl::ComponentPtr>& d
                 auto newChildIndex = changed.at(i).get("index").asInt();
                 auto action = changed.at(i).get("action").asString();
                 if (action == "insert") {
-                    tempDirty[newChildId] = component->getChildAt(newChildIndex)->serialize(msg.alloc());
+                    auto child = component->getChildAt(newChildIndex);
+                    tempDirty[newChildId] = child->serialize(msg.alloc());
+                    indexComponents(child);
+                } else {
+                    unindexComponents(newChildId);
                 }
             }
         }
@@ -878,6 +1289,10 @@ void AplCoreConnectionManager::processDirty(const std::set<apl::ComponentPtr>& d
 }
 
 void AplCoreConnectionManager::coreFrameUpdate() {
+    APL_TRACE_SCOPE("coreFrameUpdate", "apl");
+    applyStagedInputs();
+    applyDataSourceUpdates();
+
     auto now = getCurrentTime() - m_StartTime;
     m_Root->updateTime(now.count(), getCurrentTime().count());
     m_Root->setLocalTimeAdjustment(m_aplOptions->getTimezoneOffset().count());
@@ -899,8 +1314,14 @@ void AplCoreConnectionManager::coreFrameUpdate() {
 void AplCoreConnectionManager::onUpdateTick() {
     if (m_Root) {
         coreFrameUpdate();
-        // Check regularly as something like timed-out fetch requests could come up.
-        checkAndSendDataSourceErrors();
+        auto now = AplDataSourcePrefetcher::Clock::now();
+        sendDataSourceFetchRequests(m_dataSourcePrefetcher.onTick(now));
+        // Data source errors only come up after an update, or while fetch requests may time out.
+        if (m_dataSourceErrorsPending || (now < m_fetchErrorWatchDeadline && now >= m_nextFetchErrorCheck)) {
+            m_dataSourceErrorsPending = false;
+            m_nextFetchErrorCheck = now + FETCH_ERROR_CHECK_INTERVAL;
+            checkAndSendDataSourceErrors();
+        }
     }
 }
 
@@ -914,6 +1335,28 @@ apl::Rect AplCoreConnectionManager::convertJsonToScaledRect(const rapidjson::Val
     return apl::Rect(x * scale, y * scale, width * scale, height * scale);
 }
 
+void AplCoreConnectionManager::sendDataSourceFetchRequests(
+    const std::vector<AplDataSourcePrefetcher::FetchRequest>& requests) {
+    for (auto& request : requests) {
+        rapidjson::Document fetchRequestPayloadJson(rapidjson::kObjectType);
+        auto& allocator = fetchRequestPayloadJson.GetAllocator();
+        fetchRequestPayloadJson.AddMember(
+            LIST_ID_KEY, rapidjson::Value(request.listId.c_str(), allocator).Move(), allocator);
+        fetchRequestPayloadJson.AddMember(
+            CORRELATION_TOKEN_KEY, rapidjson::Value(request.correlationToken.c_str(), allocator).Move(), allocator);
+        fetchRequestPayloadJson.AddMember(START_INDEX_KEY, request.startIndex, allocator);
+        fetchRequestPayloadJson.AddMember(COUNT_KEY, request.count, allocator);
+        fetchRequestPayloadJson.AddMember(
+            PRESENTATION_TOKEN_KEY, rapidjson::Value(m_aplToken.c_str(), allocator).Move(), allocator);
+
+        rapidjson::StringBuffer sb;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+        fetchRequestPayloadJson.Accept(writer);
+
+        m_aplOptions->onDataSourceFetchRequestEvent(request.type, sb.GetString());
+    }
+}
+
 void AplCoreConnectionManager::checkAndSendDataSourceErrors() {
     // TODO: Single provider supported as of now.
     auto provider =
@@ -939,6 +1382,13 @@ void AplCoreConnectionManager::checkAndSendDataSourceErrors() {
 }
 
 void AplCoreConnectionManager::reset() {
+    m_stagedInputs.clear();
+    m_stagedInputIndices.clear();
+    m_componentIndex.clear();
+    m_dataSourcePrefetcher.reset();
+    m_pendingDataSourceUpdates.clear();
+    m_dataSourceErrorsPending = false;
+    m_fetchErrorWatchDeadline = AplDataSourcePrefetcher::Clock::time_point();
     m_aplToken = "";
     m_Root.reset();
     m_Content.reset();
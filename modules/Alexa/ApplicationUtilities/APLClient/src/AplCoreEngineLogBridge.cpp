@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include "APLClient/AplClientLog.h"
 #include "APLClient/AplCoreEngineLogBridge.h"
 
 static const std::string TAG("AplCoreEngine");
@@ -23,29 +24,33 @@ AplCoreEngineLogBridge::AplCoreEngineLogBridge(AplOptionsInterfacePtr aplOptions
 }
 
 void AplCoreEngineLogBridge::transport(apl::LogLevel level, const std::string& log) {
+    LogLevel clientLevel;
     switch (level) {
         case apl::LogLevel::TRACE:
-            m_aplOptions->logMessage(LogLevel::TRACE, TAG, log);
+            clientLevel = LogLevel::TRACE;
             break;
             // TODO: Same problem as in AplCoreGuiRenderer.h but not solved by undef by some reason.
         case static_cast<apl::LogLevel>(1):
-            m_aplOptions->logMessage(LogLevel::DBG, TAG, log);
+            clientLevel = LogLevel::DBG;
             break;
         case apl::LogLevel::INFO:
-            m_aplOptions->logMessage(LogLevel::INFO, TAG, log);
+            clientLevel = LogLevel::INFO;
             break;
         case apl::LogLevel::WARN:
-            m_aplOptions->logMessage(LogLevel::WARN, TAG, log);
+            clientLevel = LogLevel::WARN;
             break;
         case apl::LogLevel::ERROR:
-            m_aplOptions->logMessage(LogLevel::ERROR, TAG, log);
+            clientLevel = LogLevel::ERROR;
             break;
         case apl::LogLevel::CRITICAL:
-            m_aplOptions->logMessage(LogLevel::CRITICAL, TAG, log);
+            clientLevel = LogLevel::CRITICAL;
             break;
         default:
             m_aplOptions->logMessage(LogLevel::ERROR, "AplCoreEngineUnknownLogLevel", log);
             return;
     }
+    if (isLogLevelCompiledIn(clientLevel) && m_aplOptions->shouldLog(clientLevel, LogSubsystem::CORE_ENGINE)) {
+        m_aplOptions->logMessage(clientLevel, TAG, log);
+    }
 }
 }  // namespace APLClient
\ No newline at end of file
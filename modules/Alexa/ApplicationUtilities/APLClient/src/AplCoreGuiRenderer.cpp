@@ -13,23 +13,41 @@
  * permissions and limitations under the License.
  */
 #include <fstream>
+#include <functional>
 
 #include <rapidjson/document.h>
 
+#include "APLClient/AplClientLog.h"
 #include "APLClient/AplCoreGuiRenderer.h"
+#include "APLClient/AplImportSource.h"
+#include "APLClient/AplTrace.h"
 
 namespace APLClient {
 
-/// CDN for alexa import packages (styles/resources/etc)
-/// (https://developer.amazon.com/en-US/docs/alexa/alexa-presentation-language/apl-document.html#import)
-static const char* ALEXA_IMPORT_PATH = "https://d2na8397m465mh.cloudfront.net/packages/%s/%s/document.json";
-/// The number of bytes read from the attachment with each read in the read loop.
-static const size_t CHUNK_SIZE(1024);
 /// Name of the mainTemplate parameter to which avs datasources binds to.
 static const std::string DEFAULT_PARAM_BINDING = "payload";
 /// Default string to attach to mainTemplate parameters.
 static const std::string DEFAULT_PARAM_VALUE = "{}";
 
+/**
+ * Hashes the parts of a RenderDocument directive which determine how the document inflates.
+ * @param document The APL document
+ * @param data The data sources
+ * @param supportedViewports The supported viewports
+ * @return The hash
+ */
+static size_t hashDocument(
+    const std::string& document,
+    const std::string& data,
+    const std::string& supportedViewports) {
+    std::hash<std::string> hash;
+    size_t seed = hash(document);
+    for (auto part : {&data, &supportedViewports}) {
+        seed ^= hash(*part) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
 AplCoreGuiRenderer::AplCoreGuiRenderer(
     AplOptionsInterfacePtr aplOptions,
     AplCoreConnectionManagerPtr aplCoreConnectionManager) :
@@ -58,11 +76,12 @@ void AplCoreGuiRenderer::renderDocument(
     const std::string& data,
     const std::string& supportedViewports,
     const std::string& token) {
+    APL_TRACE_SCOPE("renderDocument", "apl");
     m_isDocumentCleared = false;
 
     auto content = apl::Content::create(std::move(document));
     if (!content) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "renderByAplCoreFailed", "Unable to create content");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "renderByAplCoreFailed", "Unable to create content");
 
         m_aplOptions->onRenderDocumentComplete(token, false, "Unable to create content");
         return;
@@ -90,6 +109,7 @@ void AplCoreGuiRenderer::renderDocument(
     std::unordered_map<uint32_t, std::future<std::string>> packageContentByRequestId;
     std::unordered_map<uint32_t, apl::ImportRequest> packageRequestByRequestId;
     while (content->isWaiting() && !content->isError()) {
+        APL_TRACE_SCOPE("resolveImports", "apl");
         auto packages = content->getRequestedPackages();
         unsigned int count = 0;
         for (auto& package : packages) {
@@ -98,9 +118,7 @@ void AplCoreGuiRenderer::renderDocument(
             auto source = package.source();
 
             if (source.empty()) {
-                char sourceBuffer[CHUNK_SIZE];
-                snprintf(sourceBuffer, CHUNK_SIZE, ALEXA_IMPORT_PATH, name.c_str(), version.c_str());
-                source = sourceBuffer;
+                source = getAlexaImportSource(name, version);
             }
 
             auto packageContentPromise = async(std::launch::async, &AplOptionsInterface::downloadResource, m_aplOptions, source);
@@ -113,8 +131,11 @@ void AplCoreGuiRenderer::renderDocument(
                 for (auto& kvp : packageContentByRequestId) {
                     auto packageContent = kvp.second.get();
                     if (packageContent.empty()) {
-                        m_aplOptions->logMessage(
-                            LogLevel::ERROR, "renderByAplCoreFailed", "Could not be retrieve requested import");
+                        APLCLIENT_LOG(
+                            m_aplOptions,
+                            LogLevel::ERROR,
+                            "renderByAplCoreFailed",
+                            "Could not be retrieve requested import");
 
                         m_aplOptions->onRenderDocumentComplete(token, false, "Unresolved import");
                         return;
@@ -128,7 +149,7 @@ void AplCoreGuiRenderer::renderDocument(
     }
 
     if (!content->isReady()) {
-        m_aplOptions->logMessage(LogLevel::ERROR, "renderByAplCoreFailed", "Content is not ready");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::ERROR, "renderByAplCoreFailed", "Content is not ready");
 
         m_aplOptions->onRenderDocumentComplete(token, false, "Content is not ready");
         return;
@@ -139,7 +160,7 @@ void AplCoreGuiRenderer::renderDocument(
          *  Only set the content if we haven't been cleared while building.
          */
         m_aplCoreConnectionManager->setSupportedViewports(supportedViewports);
-        m_aplCoreConnectionManager->setContent(content, token);
+        m_aplCoreConnectionManager->setContent(content, token, hashDocument(document, data, supportedViewports));
     }
 }
 
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "APLClient/AplCoreMetrics.h"
 
 namespace APLClient {
@@ -35,4 +37,69 @@ float AplCoreMetrics::getViewhostHeight() const {
     return toViewhost(getHeight());
 }
 
+AplViewportSelectionCache::AplViewportSelectionCache(size_t maxEntries) :
+        m_maxEntries{std::max<size_t>(1, maxEntries)} {
+}
+
+std::vector<apl::ViewportSpecification> AplViewportSelectionCache::getCandidates(
+    const std::string& key,
+    const std::vector<apl::ViewportSpecification>& specifications) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end() || it->second.failed.size() != specifications.size()) {
+        return specifications;
+    }
+    auto& entry = it->second;
+    m_recentKeys.splice(m_recentKeys.begin(), m_recentKeys, entry.recentPosition);
+    if (entry.inflatedIndex >= 0) {
+        return {specifications[entry.inflatedIndex]};
+    }
+    std::vector<apl::ViewportSpecification> candidates;
+    for (size_t i = 0; i < specifications.size(); i++) {
+        if (!entry.failed[i]) {
+            candidates.push_back(specifications[i]);
+        }
+    }
+    return candidates;
+}
+
+bool AplViewportSelectionCache::recordInflation(
+    const std::string& key,
+    const std::vector<apl::ViewportSpecification>& specifications,
+    const apl::ViewportSpecification& chosen,
+    bool inflated) {
+    auto chosenIt = std::find(specifications.begin(), specifications.end(), chosen);
+    if (chosenIt == specifications.end()) {
+        return false;
+    }
+    auto chosenIndex = static_cast<int>(chosenIt - specifications.begin());
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        if (m_entries.size() >= m_maxEntries) {
+            m_entries.erase(m_recentKeys.back());
+            m_recentKeys.pop_back();
+        }
+        m_recentKeys.push_front(key);
+        it = m_entries.emplace(key, Entry()).first;
+        it->second.recentPosition = m_recentKeys.begin();
+    } else {
+        m_recentKeys.splice(m_recentKeys.begin(), m_recentKeys, it->second.recentPosition);
+    }
+
+    auto& entry = it->second;
+    if (entry.failed.size() != specifications.size()) {
+        entry.failed.assign(specifications.size(), false);
+        entry.inflatedIndex = -1;
+    }
+    if (inflated) {
+        entry.inflatedIndex = chosenIndex;
+    } else {
+        entry.failed[chosenIndex] = true;
+        if (entry.inflatedIndex == chosenIndex) {
+            entry.inflatedIndex = -1;
+        }
+    }
+    return true;
+}
+
 }  // namespace APLClient
\ No newline at end of file
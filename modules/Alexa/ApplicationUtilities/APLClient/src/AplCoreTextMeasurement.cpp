@@ -13,8 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include "APLClient/AplClientLog.h"
 #include "APLClient/AplCoreViewhostMessage.h"
 #include "APLClient/AplCoreTextMeasurement.h"
+#include "APLClient/AplTrace.h"
 
 namespace APLClient {
 
@@ -56,6 +58,7 @@ YGSize AplCoreTextMeasurement::measure(
     YGMeasureMode widthMode,
     float height,
     YGMeasureMode heightMode) {
+    APL_TRACE_SCOPE("measure", "apl");
     /* Notify about the text measurement event */
     m_aplOptions->onRenderingEvent(AplRenderingEvent::TEXT_MEASURE);
 
@@ -81,10 +84,11 @@ YGSize AplCoreTextMeasurement::measure(
             return {measuredWidth, measuredHeight};
         }
 
-        m_aplOptions->logMessage(LogLevel::WARN, __func__, "Didn't get a valid reply.  Returning generic size.");
+        APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, __func__, "Didn't get a valid reply.  Returning generic size.");
         return {aplCoreMetrics->toCore(100), aplCoreMetrics->toCore(100)};
     } else {
-        m_aplOptions->logMessage(LogLevel::WARN, __func__, "ConnectionManager does not exist. Returning generic size.");
+        APLCLIENT_LOG(
+            m_aplOptions, LogLevel::WARN, __func__, "ConnectionManager does not exist. Returning generic size.");
         return {0, 0};
     }
 }
@@ -109,6 +113,7 @@ YGSize AplCoreTextMeasurement::measure(
  * @return
  */
 float AplCoreTextMeasurement::baseline(apl::TextComponent* component, float width, float height) {
+    APL_TRACE_SCOPE("baseline", "apl");
     if (auto aplCoreConnectionManager = m_aplCoreConnectionManager.lock()) {
         auto msg = AplCoreViewhostMessage(BASELINE_KEY);
         auto& alloc = msg.alloc();
@@ -128,7 +133,7 @@ float AplCoreTextMeasurement::baseline(apl::TextComponent* component, float widt
             if (it != result.MemberEnd()) return aplCoreMetrics->toCore(it->value.GetFloat());
         }
     }
-    m_aplOptions->logMessage(LogLevel::WARN, __func__, "Got invalid result from baseline calculation. Returning 0.");
+    APLCLIENT_LOG(m_aplOptions, LogLevel::WARN, __func__, "Got invalid result from baseline calculation. Returning 0.");
     return 0;
 }
 
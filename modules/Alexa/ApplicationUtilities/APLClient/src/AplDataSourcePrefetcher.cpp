@@ -0,0 +1,221 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "APLClient/AplDataSourcePrefetcher.h"
+
+namespace APLClient {
+
+/// Weight of the latest sample in the smoothed edge velocity.
+static const double VELOCITY_SMOOTHING = 0.5;
+
+/// Requests closer together than this do not update the edge velocity.
+static const std::chrono::milliseconds MIN_VELOCITY_INTERVAL{1};
+
+/// Prefix of the correlation tokens of read-ahead requests, which APL Core never assigns.
+static const std::string READ_AHEAD_TOKEN_PREFIX = "readAhead-";
+
+/// Data source update keys
+static const char CORRELATION_TOKEN_KEY[] = "correlationToken";
+static const char START_INDEX_KEY[] = "startIndex";
+static const char ITEMS_KEY[] = "items";
+
+/**
+ * Turns a read-ahead response into the answer to a request of APL Core.  A read-ahead request may cover more items
+ * than Core asked for, so the items outside the request are dropped.
+ *
+ * @param payload The read-ahead response
+ * @param request The answered request
+ * @return The answer, under the correlation token of @c request, or an empty string if @c payload is not a JSON object
+ */
+static std::string createAnswerPayload(
+    const std::string& payload,
+    const AplDataSourcePrefetcher::FetchRequest& request) {
+    rapidjson::Document update;
+    if (update.Parse(payload).HasParseError() || !update.IsObject()) {
+        return "";
+    }
+    auto& allocator = update.GetAllocator();
+
+    rapidjson::Value correlationToken(request.correlationToken.c_str(), allocator);
+    auto token = update.FindMember(CORRELATION_TOKEN_KEY);
+    if (token != update.MemberEnd()) {
+        token->value = correlationToken;
+    } else {
+        update.AddMember(CORRELATION_TOKEN_KEY, correlationToken, allocator);
+    }
+
+    auto startIndex = update.FindMember(START_INDEX_KEY);
+    auto items = update.FindMember(ITEMS_KEY);
+    if (startIndex != update.MemberEnd() && startIndex->value.IsInt() && items != update.MemberEnd() &&
+        items->value.IsArray()) {
+        int first = startIndex->value.GetInt();
+        int last = first + static_cast<int>(items->value.Size());
+        int keepStart = std::min(std::max(first, request.startIndex), last);
+        int keepEnd = std::max(keepStart, std::min(last, request.startIndex + request.count));
+        items->value.Erase(items->value.Begin() + (keepEnd - first), items->value.End());
+        items->value.Erase(items->value.Begin(), items->value.Begin() + (keepStart - first));
+        startIndex->value.SetInt(keepStart);
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    update.Accept(writer);
+    return sb.GetString();
+}
+
+AplDataSourcePrefetcher::AplDataSourcePrefetcher(
+    size_t maxReadAhead,
+    std::chrono::milliseconds horizon,
+    int maxReadAheadItems,
+    std::chrono::milliseconds requestTimeout) :
+        m_maxReadAhead{maxReadAhead},
+        m_horizon{horizon},
+        m_maxReadAheadItems{maxReadAheadItems},
+        m_requestTimeout{requestTimeout},
+        m_readAheadSequenceNumber{0} {
+}
+
+bool AplDataSourcePrefetcher::isReadAheadToken(const std::string& correlationToken) {
+    return correlationToken.compare(0, READ_AHEAD_TOKEN_PREFIX.size(), READ_AHEAD_TOKEN_PREFIX) == 0;
+}
+
+std::vector<AplDataSourcePrefetcher::FetchRequest> AplDataSourcePrefetcher::onFetchRequest(
+    const FetchRequest& request,
+    Clock::time_point now,
+    std::vector<Answer>* answers) {
+    std::vector<FetchRequest> toSend;
+    auto& state = m_lists[request.listId];
+    int endIndex = request.startIndex + request.count;
+
+    // Only requests past everything Core requested before move the edge of the list forward.
+    bool forward = !state.hasForwardRequest || request.startIndex >= state.coreEdge;
+    if (forward && state.hasForwardRequest) {
+        auto interval = now - state.lastForwardTime;
+        if (interval >= MIN_VELOCITY_INTERVAL) {
+            double seconds = std::chrono::duration<double>(interval).count();
+            double sample = (request.startIndex - state.lastForwardStartIndex) / seconds;
+            state.velocity = VELOCITY_SMOOTHING * sample + (1 - VELOCITY_SMOOTHING) * state.velocity;
+        }
+    }
+    if (forward) {
+        state.hasForwardRequest = true;
+        state.lastForwardStartIndex = request.startIndex;
+        state.lastForwardTime = now;
+    }
+    state.coreEdge = std::max(state.coreEdge, endIndex);
+    state.readAheadEdge = std::max(state.readAheadEdge, endIndex);
+
+    // A read-ahead request covering the whole request answers it, right away if its response is held.  Core retries
+    // an unanswered request with the same correlation token, which keeps waiting for the same response.
+    auto covering = std::find_if(
+        state.readAheads.begin(), state.readAheads.end(), [&request, endIndex](const ReadAhead& readAhead) {
+            return readAhead.startIndex <= request.startIndex && readAhead.endIndex >= endIndex &&
+                   (!readAhead.hasWaiting || readAhead.waiting.correlationToken == request.correlationToken);
+        });
+    if (covering == state.readAheads.end()) {
+        toSend.push_back(request);
+    } else if (covering->received) {
+        answers->push_back(
+            {request.type, request.listId, request.correlationToken, createAnswerPayload(covering->payload, request)});
+        state.readAheads.erase(covering);
+    } else {
+        covering->hasWaiting = true;
+        covering->waiting = request;
+    }
+
+    if (!forward || state.readAheads.size() >= m_maxReadAhead) {
+        return toSend;
+    }
+    double horizonSeconds = std::chrono::duration<double>(m_horizon).count();
+    auto extra = std::min(m_maxReadAheadItems, static_cast<int>(std::ceil(state.velocity * horizonSeconds)));
+    int readAheadStart = state.readAheadEdge;
+    int readAheadEnd = endIndex + extra;
+    if (readAheadStart >= readAheadEnd) {
+        return toSend;
+    }
+
+    ReadAhead readAhead;
+    readAhead.correlationToken = READ_AHEAD_TOKEN_PREFIX + std::to_string(++m_readAheadSequenceNumber);
+    readAhead.startIndex = readAheadStart;
+    readAhead.endIndex = readAheadEnd;
+    readAhead.sent = now;
+    readAhead.received = false;
+    readAhead.hasWaiting = false;
+    state.readAheads.push_back(readAhead);
+    state.readAheadEdge = readAheadEnd;
+    toSend.push_back(
+        {request.type, request.listId, readAhead.correlationToken, readAheadStart, readAheadEnd - readAheadStart});
+    return toSend;
+}
+
+void AplDataSourcePrefetcher::onReadAheadResponse(
+    const std::string& listId,
+    const std::string& correlationToken,
+    const std::string& payload,
+    std::vector<Answer>* answers) {
+    auto list = m_lists.find(listId);
+    if (list == m_lists.end()) {
+        return;
+    }
+    auto& readAheads = list->second.readAheads;
+    auto it = std::find_if(readAheads.begin(), readAheads.end(), [&correlationToken](const ReadAhead& readAhead) {
+        return readAhead.correlationToken == correlationToken;
+    });
+    if (it == readAheads.end() || it->received) {
+        // Given up, or a repeated response.
+        return;
+    }
+    if (it->hasWaiting) {
+        answers->push_back(
+            {it->waiting.type, listId, it->waiting.correlationToken, createAnswerPayload(payload, it->waiting)});
+        readAheads.erase(it);
+        return;
+    }
+    it->received = true;
+    it->payload = payload;
+}
+
+std::vector<AplDataSourcePrefetcher::FetchRequest> AplDataSourcePrefetcher::onTick(Clock::time_point now) {
+    std::vector<FetchRequest> toSend;
+    for (auto& list : m_lists) {
+        auto& state = list.second;
+        for (auto it = state.readAheads.begin(); it != state.readAheads.end();) {
+            if (it->received || now - it->sent < m_requestTimeout) {
+                ++it;
+                continue;
+            }
+            if (it->hasWaiting) {
+                toSend.push_back(it->waiting);
+            }
+            // Items of a given up request are read ahead again on the next forward request.
+            state.readAheadEdge = std::min(state.readAheadEdge, std::max(state.coreEdge, it->startIndex));
+            it = state.readAheads.erase(it);
+        }
+    }
+    return toSend;
+}
+
+void AplDataSourcePrefetcher::reset() {
+    m_lists.clear();
+}
+
+}  // namespace APLClient
@@ -0,0 +1,75 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "APLClient/AplGraphicCache.h"
+
+namespace APLClient {
+
+/// FNV-1a 64 bit offset basis.
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/// FNV-1a 64 bit prime.
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+AplGraphicCache::AplGraphicCache(size_t maxBytes) : m_maxBytes{maxBytes}, m_bytes{0} {
+}
+
+uint64_t AplGraphicCache::hash(const char* avg, size_t length) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(avg[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+apl::GraphicContentPtr AplGraphicCache::getOrCreate(const char* avg, size_t length) {
+    auto key = hash(avg, length);
+    auto it = m_index.find(key);
+    if (it != m_index.end() && 0 == it->second->avg.compare(0, std::string::npos, avg, length)) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->content;
+    }
+
+    auto content = apl::GraphicContent::create(avg);
+    if (!content || length > m_maxBytes) {
+        return content;
+    }
+
+    if (it != m_index.end()) {
+        // A different graphic with the same hash, replaced by the most recent one.
+        m_bytes -= it->second->avg.size();
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+    while (m_bytes + length > m_maxBytes && !m_entries.empty()) {
+        auto& oldest = m_entries.back();
+        m_bytes -= oldest.avg.size();
+        m_index.erase(oldest.hash);
+        m_entries.pop_back();
+    }
+    m_entries.push_front({key, std::string(avg, length), content});
+    m_index.emplace(key, m_entries.begin());
+    m_bytes += length;
+    return content;
+}
+
+void AplGraphicCache::clear() {
+    m_index.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+}  // namespace APLClient
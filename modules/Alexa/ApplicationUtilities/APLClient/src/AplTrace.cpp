@@ -0,0 +1,179 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <unistd.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "APLClient/AplTrace.h"
+
+namespace APLClient {
+
+/// Chrome trace phase of a complete event.
+static const char COMPLETE_EVENT_PHASE[] = "X";
+
+/**
+ * @return A small identifier of the calling thread, stable for the thread's lifetime.
+ */
+static uint32_t currentThreadId() {
+    static thread_local uint32_t threadId =
+        static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return threadId;
+}
+
+AplTraceRecorder& AplTraceRecorder::getInstance() {
+    static AplTraceRecorder instance;
+    return instance;
+}
+
+AplTraceRecorder::AplTraceRecorder() :
+        m_enabled{false},
+        m_dumpRequested{false},
+        m_writeIndex{0},
+        m_sessionStart{0},
+        m_capacity{0},
+        m_origin{std::chrono::steady_clock::now()} {
+}
+
+void AplTraceRecorder::enable(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_spans) {
+        if (capacity == 0) {
+            return;
+        }
+        m_spans.reset(new Span[capacity]);
+        for (size_t i = 0; i < capacity; i++) {
+            m_spans[i].sequence.store(0, std::memory_order_relaxed);
+        }
+        m_capacity = capacity;
+    }
+    m_sessionStart = m_writeIndex.load();
+    m_enabled.store(true);
+}
+
+void AplTraceRecorder::disable() {
+    m_enabled.store(false);
+}
+
+void AplTraceRecorder::record(
+    const char* name,
+    const char* category,
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point end) {
+    if (!m_spans) {
+        return;
+    }
+
+    uint64_t index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+    auto& span = m_spans[index % m_capacity];
+
+    // Seqlock: readers discard spans whose sequence is odd or changes while they are copied.
+    span.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    span.name.store(name, std::memory_order_relaxed);
+    span.category.store(category, std::memory_order_relaxed);
+    span.startUs.store(
+        std::chrono::duration_cast<std::chrono::microseconds>(start - m_origin).count(), std::memory_order_relaxed);
+    span.durationUs.store(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), std::memory_order_relaxed);
+    span.threadId.store(currentThreadId(), std::memory_order_relaxed);
+    span.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+std::string AplTraceRecorder::toChromeTrace() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.Key("traceEvents");
+    writer.StartArray();
+
+    auto processId = static_cast<int>(getpid());
+    uint64_t end = m_writeIndex.load();
+    uint64_t begin = m_sessionStart;
+    if (m_spans && end - begin > m_capacity) {
+        begin = end - m_capacity;
+    }
+
+    for (uint64_t index = begin; m_spans && index < end; index++) {
+        auto& span = m_spans[index % m_capacity];
+        uint64_t sequence = span.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2) {
+            // Still being written or already overwritten.
+            continue;
+        }
+        auto name = span.name.load(std::memory_order_relaxed);
+        auto category = span.category.load(std::memory_order_relaxed);
+        auto startUs = span.startUs.load(std::memory_order_relaxed);
+        auto durationUs = span.durationUs.load(std::memory_order_relaxed);
+        auto threadId = span.threadId.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (span.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name);
+        writer.Key("cat");
+        writer.String(category);
+        writer.Key("ph");
+        writer.String(COMPLETE_EVENT_PHASE);
+        writer.Key("ts");
+        writer.Int64(startUs);
+        writer.Key("dur");
+        writer.Int64(durationUs);
+        writer.Key("pid");
+        writer.Int(processId);
+        writer.Key("tid");
+        writer.Uint(threadId);
+        writer.EndObject();
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+    return sb.GetString();
+}
+
+bool AplTraceRecorder::dumpChromeTrace(const std::string& path) {
+    auto trace = toChromeTrace();
+    std::ofstream output(path, std::ofstream::trunc);
+    if (!output.good()) {
+        return false;
+    }
+    output << trace;
+    return output.good();
+}
+
+void AplTraceRecorder::requestDump() {
+    m_dumpRequested.store(true, std::memory_order_relaxed);
+}
+
+bool AplTraceRecorder::dumpIfRequested(const std::string& path) {
+    if (!m_dumpRequested.load(std::memory_order_relaxed) || !m_dumpRequested.exchange(false)) {
+        return false;
+    }
+    return dumpChromeTrace(path);
+}
+
+}  // namespace APLClient
@@ -0,0 +1,121 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "APLClient/AplCommandDocumentPool.h"
+
+namespace APLClient {
+namespace test {
+
+/// An ExecuteCommands payload with its commands after another member.
+static const std::string PAYLOAD =
+    R"({"token":"token","commands":[{"type":"SendEvent","arguments":["first",{"nested":true}]},{"type":"Idle"}]})";
+
+/**
+ * Test that the commands array of a payload is parsed, and the other members are left out.
+ */
+TEST(AplCommandDocumentPoolTest, test_parseCommandsReturnsCommandsArray) {
+    AplCommandDocumentPool pool;
+    auto commands = pool.parseCommands(PAYLOAD);
+
+    ASSERT_TRUE(commands);
+    ASSERT_TRUE(commands->IsArray());
+    ASSERT_EQ(2u, commands->Size());
+    EXPECT_EQ(std::string("SendEvent"), (*commands)[0]["type"].GetString());
+    EXPECT_EQ(std::string("first"), (*commands)[0]["arguments"][0].GetString());
+    EXPECT_TRUE((*commands)[0]["arguments"][1]["nested"].GetBool());
+    EXPECT_EQ(std::string("Idle"), (*commands)[1]["type"].GetString());
+
+    auto empty = pool.parseCommands(R"({"commands":[]})");
+    ASSERT_TRUE(empty);
+    EXPECT_TRUE(empty->IsArray());
+    EXPECT_EQ(0u, empty->Size());
+}
+
+/**
+ * Test that payloads which are not valid JSON, not an object, or without a single commands array are rejected.
+ */
+TEST(AplCommandDocumentPoolTest, test_parseCommandsRejectsInvalidPayloads) {
+    AplCommandDocumentPool pool;
+
+    EXPECT_FALSE(pool.parseCommands(""));
+    EXPECT_FALSE(pool.parseCommands(R"({"commands":[{"type":"Idle"})"));
+    EXPECT_FALSE(pool.parseCommands(R"({"commands":[{"type":"Idle"}],})"));
+    EXPECT_FALSE(pool.parseCommands(R"([{"commands":[]}])"));
+    EXPECT_FALSE(pool.parseCommands(R"({"token":"token"})"));
+    EXPECT_FALSE(pool.parseCommands(R"({"commands":{"type":"Idle"}})"));
+    EXPECT_FALSE(pool.parseCommands(R"({"commands":[],"commands":[]})"));
+    EXPECT_FALSE(pool.parseCommands(R"({"nested":{"commands":[]}})"));
+}
+
+/**
+ * Test that the document of a released payload is reused for the next one, while a held payload keeps its own.
+ */
+TEST(AplCommandDocumentPoolTest, test_releasedDocumentIsReused) {
+    AplCommandDocumentPool pool;
+    auto first = pool.parseCommands(PAYLOAD);
+    ASSERT_TRUE(first);
+    auto firstDocument = first.get();
+
+    auto second = pool.parseCommands(PAYLOAD);
+    ASSERT_TRUE(second);
+    EXPECT_NE(firstDocument, second.get());
+
+    first.reset();
+    auto third = pool.parseCommands(R"({"commands":[{"type":"Idle"}]})");
+    ASSERT_TRUE(third);
+    EXPECT_EQ(firstDocument, third.get());
+    ASSERT_EQ(1u, third->Size());
+    EXPECT_EQ(std::string("Idle"), (*third)[0]["type"].GetString());
+}
+
+/**
+ * Test that the document of a rejected payload is reused for the next one.
+ */
+TEST(AplCommandDocumentPoolTest, test_documentOfRejectedPayloadIsReused) {
+    AplCommandDocumentPool pool;
+    auto first = pool.parseCommands(PAYLOAD);
+    ASSERT_TRUE(first);
+    auto firstDocument = first.get();
+    first.reset();
+
+    ASSERT_FALSE(pool.parseCommands("{"));
+
+    auto second = pool.parseCommands(PAYLOAD);
+    EXPECT_EQ(firstDocument, second.get());
+}
+
+/**
+ * Test that parsed commands stay valid after the payload and the pool are gone.
+ */
+TEST(AplCommandDocumentPoolTest, test_commandsOutliveThePool) {
+    std::shared_ptr<const rapidjson::Value> commands;
+    {
+        AplCommandDocumentPool pool;
+        std::string payload = PAYLOAD;
+        commands = pool.parseCommands(payload);
+    }
+
+    ASSERT_TRUE(commands);
+    ASSERT_EQ(2u, commands->Size());
+    EXPECT_EQ(std::string("SendEvent"), (*commands)[0]["type"].GetString());
+}
+
+}  // namespace test
+}  // namespace APLClient
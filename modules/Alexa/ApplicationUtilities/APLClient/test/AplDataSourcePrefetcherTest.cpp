@@ -0,0 +1,257 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "APLClient/AplDataSourcePrefetcher.h"
+
+namespace APLClient {
+namespace test {
+
+using FetchRequest = AplDataSourcePrefetcher::FetchRequest;
+using Answer = AplDataSourcePrefetcher::Answer;
+
+/// Maximum number of read-ahead requests per list.
+static const size_t MAX_READ_AHEAD = 2;
+
+/// Prefetch horizon.
+static const std::chrono::milliseconds HORIZON{2000};
+
+/// Maximum number of items of a read-ahead request.
+static const int MAX_READ_AHEAD_ITEMS = 50;
+
+/// Time after which an unanswered read-ahead request is given up.
+static const std::chrono::milliseconds REQUEST_TIMEOUT{5000};
+
+/// Interval between the fetch requests of the scroll.
+static const std::chrono::milliseconds REQUEST_INTERVAL{500};
+
+/// Data source type of the requests.
+static const std::string TYPE = "dynamicIndexList";
+
+/// List the requests are for.
+static const std::string LIST_ID = "list";
+
+/// Start of the read-ahead request sent by @c startScrolling.
+static const int READ_AHEAD_START = 40;
+
+/// Number of items of the read-ahead request sent by @c startScrolling.
+static const int READ_AHEAD_COUNT = 20;
+
+class AplDataSourcePrefetcherTest : public ::testing::Test {
+protected:
+    /// Constructor
+    AplDataSourcePrefetcherTest();
+
+    /**
+     * Raises two forward fetch requests of APL Core, 10 items apart, so the list scrolls at 10 items per second and
+     * a read-ahead request for the items 40 to 60 is sent after the second.
+     */
+    void startScrolling();
+
+    /**
+     * Creates a fetch request of APL Core.
+     *
+     * @param correlationToken Correlation token of the request
+     * @param startIndex Index of the first requested item
+     * @param count Number of requested items
+     * @return The request
+     */
+    static FetchRequest createRequest(const std::string& correlationToken, int startIndex, int count);
+
+    /**
+     * Creates a data source update whose items are their own index.
+     *
+     * @param correlationToken Correlation token of the update
+     * @param startIndex Index of the first item
+     * @param count Number of items
+     * @return The update
+     */
+    static std::string createUpdate(const std::string& correlationToken, int startIndex, int count);
+
+    /// The prefetcher under test.
+    AplDataSourcePrefetcher m_prefetcher;
+
+    /// Time of the last request raised.
+    AplDataSourcePrefetcher::Clock::time_point m_now;
+
+    /// Correlation token of the read-ahead request sent by @c startScrolling.
+    std::string m_readAheadToken;
+};
+
+AplDataSourcePrefetcherTest::AplDataSourcePrefetcherTest() :
+        m_prefetcher{MAX_READ_AHEAD, HORIZON, MAX_READ_AHEAD_ITEMS, REQUEST_TIMEOUT},
+        m_now{AplDataSourcePrefetcher::Clock::now()} {
+}
+
+void AplDataSourcePrefetcherTest::startScrolling() {
+    std::vector<Answer> answers;
+    auto toSend = m_prefetcher.onFetchRequest(createRequest("1", 20, 10), m_now, &answers);
+    ASSERT_EQ(1u, toSend.size());
+    EXPECT_EQ("1", toSend[0].correlationToken);
+
+    m_now += REQUEST_INTERVAL;
+    toSend = m_prefetcher.onFetchRequest(createRequest("2", 30, 10), m_now, &answers);
+    ASSERT_EQ(2u, toSend.size());
+    EXPECT_EQ("2", toSend[0].correlationToken);
+    EXPECT_TRUE(AplDataSourcePrefetcher::isReadAheadToken(toSend[1].correlationToken));
+    EXPECT_EQ(LIST_ID, toSend[1].listId);
+    EXPECT_EQ(READ_AHEAD_START, toSend[1].startIndex);
+    EXPECT_EQ(READ_AHEAD_COUNT, toSend[1].count);
+    EXPECT_TRUE(answers.empty());
+    m_readAheadToken = toSend[1].correlationToken;
+}
+
+FetchRequest AplDataSourcePrefetcherTest::createRequest(
+    const std::string& correlationToken,
+    int startIndex,
+    int count) {
+    return {TYPE, LIST_ID, correlationToken, startIndex, count};
+}
+
+std::string AplDataSourcePrefetcherTest::createUpdate(const std::string& correlationToken, int startIndex, int count) {
+    std::string items;
+    for (int i = startIndex; i < startIndex + count; i++) {
+        items += (items.empty() ? "" : ",") + std::to_string(i);
+    }
+    return R"({"listId":")" + LIST_ID + R"(","correlationToken":")" + correlationToken +
+           R"(","startIndex":)" + std::to_string(startIndex) + R"(,"items":[)" + items + "]}";
+}
+
+/**
+ * Test that requests of APL Core which no read-ahead request covers are sent unchanged, and that tokens of the
+ * prefetcher are told apart from those of APL Core.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_uncoveredRequestIsSent) {
+    startScrolling();
+
+    std::vector<Answer> answers;
+    auto toSend = m_prefetcher.onFetchRequest(createRequest("3", 55, 10), m_now, &answers);
+    ASSERT_FALSE(toSend.empty());
+    EXPECT_EQ("3", toSend[0].correlationToken);
+    EXPECT_EQ(55, toSend[0].startIndex);
+    EXPECT_EQ(10, toSend[0].count);
+
+    toSend = m_prefetcher.onFetchRequest(createRequest("4", 0, 10), m_now, &answers);
+    ASSERT_EQ(1u, toSend.size());
+    EXPECT_EQ("4", toSend[0].correlationToken);
+    EXPECT_TRUE(answers.empty());
+    EXPECT_FALSE(AplDataSourcePrefetcher::isReadAheadToken("4"));
+}
+
+/**
+ * Test that a held read-ahead response answers a covered request of APL Core under its correlation token, trimmed to
+ * the items it asked for, and that the request is not sent.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_heldResponseAnswersCoveredRequest) {
+    startScrolling();
+    std::vector<Answer> answers;
+    m_prefetcher.onReadAheadResponse(
+        LIST_ID, m_readAheadToken, createUpdate(m_readAheadToken, READ_AHEAD_START, READ_AHEAD_COUNT), &answers);
+    ASSERT_TRUE(answers.empty());
+
+    m_now += REQUEST_INTERVAL;
+    auto toSend = m_prefetcher.onFetchRequest(createRequest("3", 40, 10), m_now, &answers);
+
+    for (auto& request : toSend) {
+        EXPECT_NE("3", request.correlationToken);
+    }
+    ASSERT_EQ(1u, answers.size());
+    EXPECT_EQ(TYPE, answers[0].type);
+    EXPECT_EQ(LIST_ID, answers[0].listId);
+    EXPECT_EQ("3", answers[0].correlationToken);
+    EXPECT_EQ(createUpdate("3", 40, 10), answers[0].payload);
+}
+
+/**
+ * Test that the items of a wider read-ahead response before and after the request of APL Core are dropped.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_widerResponseIsTrimmedToRequest) {
+    startScrolling();
+    std::vector<Answer> answers;
+    m_prefetcher.onReadAheadResponse(
+        LIST_ID, m_readAheadToken, createUpdate(m_readAheadToken, READ_AHEAD_START, READ_AHEAD_COUNT), &answers);
+
+    m_prefetcher.onFetchRequest(createRequest("3", 45, 5), m_now, &answers);
+
+    ASSERT_EQ(1u, answers.size());
+    EXPECT_EQ(createUpdate("3", 45, 5), answers[0].payload);
+}
+
+/**
+ * Test that a covered request of APL Core waits for the read-ahead response, and is answered by it on arrival.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_coveredRequestWaitsForResponse) {
+    startScrolling();
+
+    std::vector<Answer> answers;
+    auto toSend = m_prefetcher.onFetchRequest(createRequest("3", 50, 10), m_now, &answers);
+    for (auto& request : toSend) {
+        EXPECT_NE("3", request.correlationToken);
+    }
+    ASSERT_TRUE(answers.empty());
+
+    m_prefetcher.onReadAheadResponse(
+        LIST_ID, m_readAheadToken, createUpdate(m_readAheadToken, READ_AHEAD_START, READ_AHEAD_COUNT), &answers);
+
+    ASSERT_EQ(1u, answers.size());
+    EXPECT_EQ("3", answers[0].correlationToken);
+    EXPECT_EQ(createUpdate("3", 50, 10), answers[0].payload);
+}
+
+/**
+ * Test that a request of APL Core waiting for a read-ahead request is sent once the read-ahead request times out,
+ * and that a late response is then ignored.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_waitingRequestSentOnTimeout) {
+    startScrolling();
+    auto readAheadSent = m_now;
+
+    std::vector<Answer> answers;
+    m_prefetcher.onFetchRequest(createRequest("3", 40, 10), m_now, &answers);
+
+    EXPECT_TRUE(m_prefetcher.onTick(readAheadSent + REQUEST_TIMEOUT - std::chrono::milliseconds(1)).empty());
+
+    auto toSend = m_prefetcher.onTick(readAheadSent + REQUEST_TIMEOUT);
+    ASSERT_EQ(1u, toSend.size());
+    EXPECT_EQ("3", toSend[0].correlationToken);
+    EXPECT_EQ(40, toSend[0].startIndex);
+    EXPECT_EQ(10, toSend[0].count);
+
+    m_prefetcher.onReadAheadResponse(
+        LIST_ID, m_readAheadToken, createUpdate(m_readAheadToken, READ_AHEAD_START, READ_AHEAD_COUNT), &answers);
+    EXPECT_TRUE(answers.empty());
+}
+
+/**
+ * Test that a read-ahead response which is not a JSON object answers with an empty payload.
+ */
+TEST_F(AplDataSourcePrefetcherTest, test_invalidResponseAnswersEmpty) {
+    startScrolling();
+    std::vector<Answer> answers;
+    m_prefetcher.onFetchRequest(createRequest("3", 40, 10), m_now, &answers);
+
+    m_prefetcher.onReadAheadResponse(LIST_ID, m_readAheadToken, "[]", &answers);
+
+    ASSERT_EQ(1u, answers.size());
+    EXPECT_EQ("3", answers[0].correlationToken);
+    EXPECT_TRUE(answers[0].payload.empty());
+}
+
+}  // namespace test
+}  // namespace APLClient
@@ -0,0 +1,115 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "APLClient/AplGraphicCache.h"
+
+namespace APLClient {
+namespace test {
+
+/// The bound of the cache, as used by the connection manager.
+static const size_t MAX_BYTES = 2 * 1024 * 1024;
+
+/**
+ * Creates the text of an AVG, padded with a description.
+ *
+ * @param fill The character the description is made of
+ * @param descriptionLength The length of the description
+ * @return The AVG JSON text
+ */
+static std::string createAvg(char fill, size_t descriptionLength = 1) {
+    return R"({"type":"AVG","version":"1.0","height":10,"width":10,"description":")" +
+           std::string(descriptionLength, fill) + R"(","items":[]})";
+}
+
+/**
+ * Gets a graphic from the cache.
+ *
+ * @param cache The cache
+ * @param avg The AVG JSON text
+ * @return The graphic
+ */
+static apl::GraphicContentPtr getOrCreate(AplGraphicCache& cache, const std::string& avg) {
+    return cache.getOrCreate(avg.c_str(), avg.length());
+}
+
+/**
+ * Test that the same text gets the cached graphic.
+ */
+TEST(AplGraphicCacheTest, test_sameTextIsHit) {
+    AplGraphicCache cache(MAX_BYTES);
+    auto avg = createAvg('a');
+
+    auto graphic = getOrCreate(cache, avg);
+    ASSERT_TRUE(graphic);
+    EXPECT_EQ(graphic, getOrCreate(cache, std::string(avg)));
+}
+
+/**
+ * Test that a different text gets a different graphic, and that both stay cached.
+ */
+TEST(AplGraphicCacheTest, test_differentTextIsMiss) {
+    AplGraphicCache cache(MAX_BYTES);
+    auto first = createAvg('a');
+    auto second = createAvg('b');
+
+    auto firstGraphic = getOrCreate(cache, first);
+    auto secondGraphic = getOrCreate(cache, second);
+    ASSERT_TRUE(firstGraphic);
+    ASSERT_TRUE(secondGraphic);
+    EXPECT_NE(firstGraphic, secondGraphic);
+
+    EXPECT_EQ(firstGraphic, getOrCreate(cache, first));
+    EXPECT_EQ(secondGraphic, getOrCreate(cache, second));
+}
+
+/**
+ * Test that the least recently used graphic is evicted once the total text length would exceed the bound.
+ */
+TEST(AplGraphicCacheTest, test_leastRecentlyUsedEvictedAtBound) {
+    AplGraphicCache cache(MAX_BYTES);
+    // Two of these fit within the bound, three do not.
+    auto first = createAvg('a', MAX_BYTES * 2 / 5);
+    auto second = createAvg('b', MAX_BYTES * 2 / 5);
+    auto third = createAvg('c', MAX_BYTES * 2 / 5);
+
+    auto firstGraphic = getOrCreate(cache, first);
+    auto secondGraphic = getOrCreate(cache, second);
+    ASSERT_EQ(firstGraphic, getOrCreate(cache, first));
+
+    auto thirdGraphic = getOrCreate(cache, third);
+
+    EXPECT_EQ(firstGraphic, getOrCreate(cache, first));
+    EXPECT_EQ(thirdGraphic, getOrCreate(cache, third));
+    EXPECT_NE(secondGraphic, getOrCreate(cache, second));
+}
+
+/**
+ * Test that a graphic whose text is longer than the bound is returned but not cached.
+ */
+TEST(AplGraphicCacheTest, test_graphicLargerThanBoundIsNotCached) {
+    AplGraphicCache cache(MAX_BYTES);
+    auto avg = createAvg('a', MAX_BYTES);
+
+    auto graphic = getOrCreate(cache, avg);
+    ASSERT_TRUE(graphic);
+    EXPECT_NE(graphic, getOrCreate(cache, avg));
+}
+
+}  // namespace test
+}  // namespace APLClient
@@ -0,0 +1,288 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "HeadlessViewhost.h"
+
+namespace alexaSmartScreenSDK {
+namespace communication {
+namespace benchmark {
+
+using namespace websocketpp::lib::placeholders;
+
+/// SDK-GUI message types.
+static const std::string MESSAGE_TYPE_INIT_REQUEST = "initRequest";
+static const std::string MESSAGE_TYPE_INIT_RESPONSE = "initResponse";
+static const std::string MESSAGE_TYPE_APL_RENDER = "aplRender";
+static const std::string MESSAGE_TYPE_APL_CORE = "aplCore";
+static const std::string MESSAGE_TYPE_APL_EVENT = "aplEvent";
+
+/// aplCore message types answered by the viewhost.
+static const std::string APL_MEASURE = "measure";
+static const std::string APL_BASELINE = "baseline";
+static const std::string APL_BUILD = "build";
+
+/// Message keys.
+static const char TYPE_KEY[] = "type";
+static const char PAYLOAD_KEY[] = "payload";
+static const char SEQNO_KEY[] = "seqno";
+
+/// Font size used when the measured component does not specify one.
+static const float DEFAULT_FONT_SIZE = 40.0f;
+/// Approximate width of a character relative to the font size.
+static const float CHARACTER_WIDTH_RATIO = 0.5f;
+/// Approximate line height relative to the font size.
+static const float LINE_HEIGHT_RATIO = 1.25f;
+/// Baseline position relative to the measured height.
+static const float BASELINE_RATIO = 0.8f;
+/// Yoga measure mode for an undefined dimension.
+static const int MEASURE_MODE_UNDEFINED = 0;
+
+/**
+ * Serializes a JSON value.
+ *
+ * @param value The value.
+ * @return The serialized value.
+ */
+static std::string serialize(const rapidjson::Value& value) {
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    value.Accept(writer);
+    return sb.GetString();
+}
+
+HeadlessViewhost::HeadlessViewhost(const std::string& viewport, const std::string& aplMaxVersion) :
+        m_viewport{viewport},
+        m_aplMaxVersion{aplMaxVersion},
+        m_initialized{false} {
+    m_client.clear_access_channels(websocketpp::log::alevel::all);
+    m_client.clear_error_channels(websocketpp::log::elevel::all);
+    m_client.set_error_channels(websocketpp::log::elevel::fatal);
+    m_client.init_asio();
+    m_client.set_message_handler(
+        [this](websocketpp::connection_hdl, Client::message_ptr message) { onMessage(message->get_payload()); });
+#ifdef ENABLE_WEBSOCKET_SSL
+    // The SDK serves a locally generated certificate, the stand-in does not verify it.
+    m_client.set_tls_init_handler([](websocketpp::connection_hdl) {
+        auto context = websocketpp::lib::make_shared<asio::ssl::context>(asio::ssl::context::tlsv12_client);
+        context->set_verify_mode(asio::ssl::verify_none);
+        return context;
+    });
+#endif
+}
+
+HeadlessViewhost::~HeadlessViewhost() {
+    disconnect();
+}
+
+bool HeadlessViewhost::connect(const std::string& uri, std::chrono::milliseconds timeout) {
+    websocketpp::lib::error_code errorCode;
+    auto connection = m_client.get_connection(uri, errorCode);
+    if (errorCode) {
+        std::cerr << "Unable to create connection to " << uri << ": " << errorCode.message() << std::endl;
+        return false;
+    }
+    m_connection = connection->get_handle();
+    m_client.connect(connection);
+    m_thread = std::thread([this]() { m_client.run(); });
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_condition.wait_for(lock, timeout, [this]() { return m_initialized; });
+}
+
+void HeadlessViewhost::disconnect() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    websocketpp::lib::error_code errorCode;
+    m_client.close(m_connection, websocketpp::close::status::going_away, "done", errorCode);
+    m_client.stop_perpetual();
+    m_thread.join();
+}
+
+void HeadlessViewhost::send(const std::string& message) {
+    websocketpp::lib::error_code errorCode;
+    m_client.send(m_connection, message, websocketpp::frame::opcode::text, errorCode);
+    if (errorCode) {
+        std::cerr << "Send failed: " << errorCode.message() << std::endl;
+    }
+}
+
+void HeadlessViewhost::sendAplEvent(const std::string& message) {
+    rapidjson::Document wrapped(rapidjson::kObjectType);
+    auto& alloc = wrapped.GetAllocator();
+    rapidjson::Document payload(&alloc);
+    payload.Parse(message);
+    wrapped.AddMember(TYPE_KEY, rapidjson::Value(MESSAGE_TYPE_APL_EVENT.c_str(), alloc).Move(), alloc);
+    wrapped.AddMember(PAYLOAD_KEY, payload, alloc);
+    send(serialize(wrapped));
+}
+
+void HeadlessViewhost::clearCoreMessages() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_coreMessages.clear();
+}
+
+bool HeadlessViewhost::waitForCoreMessage(
+    const std::string& type,
+    std::chrono::milliseconds timeout,
+    CoreMessage* message) {
+    auto deadline = Clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        while (!m_coreMessages.empty()) {
+            auto front = m_coreMessages.front();
+            m_coreMessages.pop_front();
+            if (front.type == type) {
+                *message = front;
+                return true;
+            }
+        }
+        if (m_condition.wait_until(lock, deadline) == std::cv_status::timeout && m_coreMessages.empty()) {
+            return false;
+        }
+    }
+}
+
+std::deque<HeadlessViewhost::CoreMessage> HeadlessViewhost::collectCoreMessages(
+    const std::string& type,
+    std::chrono::milliseconds quietPeriod,
+    std::chrono::milliseconds maxDuration) {
+    std::deque<CoreMessage> collected;
+    auto deadline = Clock::now() + maxDuration;
+    CoreMessage message;
+    while (Clock::now() < deadline) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+        if (!waitForCoreMessage(type, std::min(quietPeriod, remaining), &message)) {
+            break;
+        }
+        collected.push_back(message);
+    }
+    return collected;
+}
+
+void HeadlessViewhost::onMessage(const std::string& payload) {
+    auto arrival = Clock::now();
+    rapidjson::Document message;
+    if (message.Parse(payload).HasParseError() || !message.HasMember(TYPE_KEY) || !message[TYPE_KEY].IsString()) {
+        std::cerr << "Ignoring malformed message" << std::endl;
+        return;
+    }
+    std::string type = message[TYPE_KEY].GetString();
+
+    if (type == MESSAGE_TYPE_INIT_REQUEST) {
+        rapidjson::Document response(rapidjson::kObjectType);
+        auto& alloc = response.GetAllocator();
+        response.AddMember(TYPE_KEY, rapidjson::Value(MESSAGE_TYPE_INIT_RESPONSE.c_str(), alloc).Move(), alloc);
+        response.AddMember("isSupported", true, alloc);
+        response.AddMember("APLMaxVersion", rapidjson::Value(m_aplMaxVersion.c_str(), alloc).Move(), alloc);
+        send(serialize(response));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_initialized = true;
+        m_condition.notify_all();
+    } else if (type == MESSAGE_TYPE_APL_RENDER) {
+        rapidjson::Document build(rapidjson::kObjectType);
+        auto& alloc = build.GetAllocator();
+        rapidjson::Document viewport(&alloc);
+        viewport.Parse(m_viewport);
+        build.AddMember(TYPE_KEY, rapidjson::Value(APL_BUILD.c_str(), alloc).Move(), alloc);
+        build.AddMember(PAYLOAD_KEY, viewport, alloc);
+        sendAplEvent(serialize(build));
+    } else if (type == MESSAGE_TYPE_APL_CORE && message.HasMember(PAYLOAD_KEY)) {
+        auto& core = message[PAYLOAD_KEY];
+        if (core.IsObject() && core.HasMember(TYPE_KEY) && core[TYPE_KEY].IsString()) {
+            onCoreMessage(core, payload.size());
+        }
+    }
+
+    // Record the arrival of every SDK message so callers can also wait on non-APL traffic.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_coreMessages.push_back({"sdk:" + type, payload.size(), arrival});
+    m_condition.notify_all();
+}
+
+void HeadlessViewhost::onCoreMessage(const rapidjson::Value& message, size_t bytes) {
+    std::string type = message[TYPE_KEY].GetString();
+    if (type == APL_MEASURE || type == APL_BASELINE) {
+        replyToMeasurement(type, message);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_coreMessages.push_back({type, bytes, Clock::now()});
+    m_condition.notify_all();
+}
+
+void HeadlessViewhost::replyToMeasurement(const std::string& type, const rapidjson::Value& request) {
+    if (!request.HasMember(SEQNO_KEY) || !request.HasMember(PAYLOAD_KEY) || !request[PAYLOAD_KEY].IsObject()) {
+        return;
+    }
+    const auto& measure = request[PAYLOAD_KEY];
+
+    auto getNumber = [&measure](const char* key, float defaultValue) {
+        auto it = measure.FindMember(key);
+        return (it != measure.MemberEnd() && it->value.IsNumber()) ? it->value.GetFloat() : defaultValue;
+    };
+
+    float width = getNumber("width", 0);
+    float measuredHeight = getNumber("height", 0);
+
+    rapidjson::Document reply(rapidjson::kObjectType);
+    auto& alloc = reply.GetAllocator();
+    reply.AddMember(TYPE_KEY, rapidjson::Value(type.c_str(), alloc).Move(), alloc);
+    reply.AddMember(SEQNO_KEY, request[SEQNO_KEY].GetUint(), alloc);
+
+    if (type == APL_MEASURE) {
+        float fontSize = getNumber("fontSize", DEFAULT_FONT_SIZE);
+        // Styled text serializes either as a plain string or as an object carrying the raw text.
+        size_t characters = 0;
+        auto textIt = measure.FindMember("text");
+        if (textIt != measure.MemberEnd()) {
+            const rapidjson::Value* text = &textIt->value;
+            if (text->IsObject() && text->HasMember("text")) {
+                text = &(*text)["text"];
+            }
+            characters = text->IsString() ? text->GetStringLength() : 0;
+        }
+
+        float textWidth = characters * fontSize * CHARACTER_WIDTH_RATIO;
+        float lineWidth = textWidth;
+        if (getNumber("widthMode", MEASURE_MODE_UNDEFINED) != MEASURE_MODE_UNDEFINED && width > 0) {
+            lineWidth = std::min(textWidth, width);
+        }
+        float lines = lineWidth > 0 ? std::ceil(textWidth / lineWidth) : 1;
+        measuredHeight = lines * fontSize * LINE_HEIGHT_RATIO;
+
+        rapidjson::Value size(rapidjson::kObjectType);
+        size.AddMember("width", lineWidth, alloc);
+        size.AddMember("height", measuredHeight, alloc);
+        reply.AddMember(PAYLOAD_KEY, size, alloc);
+    } else {
+        reply.AddMember(PAYLOAD_KEY, measuredHeight * BASELINE_RATIO, alloc);
+    }
+
+    sendAplEvent(serialize(reply));
+}
+
+}  // namespace benchmark
+}  // namespace communication
+}  // namespace alexaSmartScreenSDK
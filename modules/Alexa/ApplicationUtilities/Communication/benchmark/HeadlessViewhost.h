@@ -0,0 +1,194 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_COMMUNICATION_BENCHMARK_HEADLESSVIEWHOST_H
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_COMMUNICATION_BENCHMARK_HEADLESSVIEWHOST_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <rapidjson/document.h>
+
+#ifdef ENABLE_WEBSOCKET_SSL
+#include <websocketpp/config/asio_client.hpp>
+#else
+#include <websocketpp/config/asio_no_tls_client.hpp>
+#endif
+#include <websocketpp/client.hpp>
+
+namespace alexaSmartScreenSDK {
+namespace communication {
+namespace benchmark {
+
+/**
+ * A headless stand-in for the GUI client which speaks the SDK-GUI protocol over the SDK's @c WebSocketServer.
+ *
+ * It completes the initRequest/initResponse handshake, answers aplRender with a build request for a fixed viewport,
+ * replies to measure and baseline requests with a font-size heuristic and records the arrival time of every other
+ * aplCore message, so that callers can time the SDK's APL path end to end without a browser.
+ */
+class HeadlessViewhost {
+public:
+    /// Clock used for all timestamps.
+    using Clock = std::chrono::steady_clock;
+
+    /// An aplCore message received from the SDK.
+    struct CoreMessage {
+        /// The aplCore message type, e.g. "hierarchy" or "dirty".
+        std::string type;
+        /// Size of the serialized aplCore payload in bytes.
+        size_t bytes;
+        /// Arrival time.
+        Clock::time_point time;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param viewport The build payload sent in response to aplRender, holding width, height, dpi, shape and mode.
+     * @param aplMaxVersion The maximum APL version reported in the initResponse.
+     */
+    HeadlessViewhost(const std::string& viewport, const std::string& aplMaxVersion);
+
+    /**
+     * Destructor.
+     */
+    ~HeadlessViewhost();
+
+    /**
+     * Connects to the SDK and waits for the init handshake to complete.
+     *
+     * @param uri The WebSocket URI of the SDK, e.g. "ws://127.0.0.1:8933".
+     * @param timeout How long to wait for the handshake.
+     * @return Whether the handshake completed.
+     */
+    bool connect(const std::string& uri, std::chrono::milliseconds timeout);
+
+    /**
+     * Closes the connection.
+     */
+    void disconnect();
+
+    /**
+     * Sends a message to the SDK.
+     *
+     * @param message The serialized message.
+     */
+    void send(const std::string& message);
+
+    /**
+     * Sends an APL message to the SDK wrapped in an aplEvent, as the GUI's APL renderer does.
+     *
+     * @param message The serialized APL message.
+     */
+    void sendAplEvent(const std::string& message);
+
+    /**
+     * Discards all recorded aplCore messages.
+     */
+    void clearCoreMessages();
+
+    /**
+     * Waits for an aplCore message of the given type to arrive, consuming all messages received before it.
+     *
+     * @param type The aplCore message type.
+     * @param timeout How long to wait.
+     * @param[out] message The matching message.
+     * @return Whether a matching message arrived in time.
+     */
+    bool waitForCoreMessage(const std::string& type, std::chrono::milliseconds timeout, CoreMessage* message);
+
+    /**
+     * Collects aplCore messages of the given type until none has arrived for the given quiet period.
+     *
+     * @param type The aplCore message type.
+     * @param quietPeriod How long without a matching message ends the collection.
+     * @param maxDuration Upper bound on the collection time.
+     * @return The matching messages in arrival order.
+     */
+    std::deque<CoreMessage> collectCoreMessages(
+        const std::string& type,
+        std::chrono::milliseconds quietPeriod,
+        std::chrono::milliseconds maxDuration);
+
+private:
+#ifdef ENABLE_WEBSOCKET_SSL
+    /// The websocketpp client type.
+    using Client = websocketpp::client<websocketpp::config::asio_tls_client>;
+#else
+    /// The websocketpp client type.
+    using Client = websocketpp::client<websocketpp::config::asio_client>;
+#endif
+
+    /**
+     * Handles a message from the SDK, called on the client thread.
+     *
+     * @param payload The serialized message.
+     */
+    void onMessage(const std::string& payload);
+
+    /**
+     * Handles an aplCore message, called on the client thread.
+     *
+     * @param message The parsed aplCore payload.
+     * @param bytes Size of the serialized aplCore payload.
+     */
+    void onCoreMessage(const rapidjson::Value& message, size_t bytes);
+
+    /**
+     * Replies to a measure or baseline request.
+     *
+     * @param type The request type.
+     * @param request The parsed request.
+     */
+    void replyToMeasurement(const std::string& type, const rapidjson::Value& request);
+
+    /// The build payload sent in response to aplRender.
+    std::string m_viewport;
+
+    /// The maximum APL version reported in the initResponse.
+    std::string m_aplMaxVersion;
+
+    /// The websocketpp client.
+    Client m_client;
+
+    /// The connection to the SDK.
+    websocketpp::connection_hdl m_connection;
+
+    /// Thread running the client's event loop.
+    std::thread m_thread;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Signalled when the handshake completes or an aplCore message arrives.
+    std::condition_variable m_condition;
+
+    /// Whether the init handshake completed.
+    bool m_initialized;
+
+    /// Received aplCore messages which have not been consumed yet.
+    std::deque<CoreMessage> m_coreMessages;
+};
+
+}  // namespace benchmark
+}  // namespace communication
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_COMMUNICATION_BENCHMARK_HEADLESSVIEWHOST_H
@@ -0,0 +1,295 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Measures GUI path latencies of a running Smart Screen SDK sample app by acting as its GUI client.
+ *
+ * Documents are rendered with renderStaticDocument, so no cloud connectivity is needed.  For every iteration of the
+ * scenario the tool reports:
+ *
+ * - directive-to-hierarchy: renderStaticDocument sent until the APL hierarchy arrives,
+ * - command-to-update: executeCommands sent until the first dirty update arrives,
+ * - update-to-update: interval between consecutive dirty updates while the commands run,
+ * - event-to-UserEvent: a press on the scenario's event component until the SDK reports the resulting update.  The
+ *   UserEvent itself is sent to AVS and is not visible on the GUI connection, so the scenario pairs its SendEvent
+ *   with a SetValue and the dirty update produced by the same command sequence marks the dispatch.
+ *
+ * A scenario file is a JSON object of the form:
+ * @code
+ * {
+ *   "viewport": { "width": 1280, "height": 800, "dpi": 160, "shape": "RECTANGLE", "mode": "HUB" },
+ *   "windowId": "headless",
+ *   "document": { "document": { ... }, "datasources": { ... }, "supportedViewports": [ ... ] },
+ *   "updateCommands": [ ... ],
+ *   "eventComponentId": "button"
+ * }
+ * @endcode
+ *
+ * Usage: HeadlessViewhost <scenario> [--uri ws://127.0.0.1:8933] [--iterations N] [--output file]
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "HeadlessViewhost.h"
+
+using namespace alexaSmartScreenSDK::communication::benchmark;
+
+/// Default SDK WebSocket URI.
+#ifdef ENABLE_WEBSOCKET_SSL
+static const std::string DEFAULT_URI = "wss://127.0.0.1:8933";
+#else
+static const std::string DEFAULT_URI = "ws://127.0.0.1:8933";
+#endif
+/// Default number of scenario iterations.
+static const int DEFAULT_ITERATIONS = 10;
+/// Default viewport when the scenario does not specify one.
+static const char DEFAULT_VIEWPORT[] = R"({"width":1280,"height":800,"dpi":160,"shape":"RECTANGLE","mode":"HUB"})";
+/// Default window id when the scenario does not specify one.
+static const std::string DEFAULT_WINDOW_ID = "headless";
+/// Token used for executeCommands.
+static const std::string HEADLESS_TOKEN = "headless";
+/// APL version reported to the SDK.
+static const std::string APL_MAX_VERSION = "1.4";
+/// How long to wait for the init handshake.
+static const std::chrono::milliseconds CONNECT_TIMEOUT{30000};
+/// How long to wait for any single response.
+static const std::chrono::milliseconds RESPONSE_TIMEOUT{10000};
+/// Quiet period which ends a command sequence.
+static const std::chrono::milliseconds UPDATE_QUIET_PERIOD{500};
+/// Upper bound on a command sequence.
+static const std::chrono::milliseconds UPDATE_MAX_DURATION{30000};
+/// aplCore type of the document hierarchy.
+static const std::string HIERARCHY_TYPE = "hierarchy";
+/// aplCore type of dirty property updates.
+static const std::string DIRTY_TYPE = "dirty";
+/// Value of apl::UpdateType::kUpdatePressed.
+static const int UPDATE_PRESSED = 0;
+
+/// Duration type used for all measurements.
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+/**
+ * Serializes a JSON value.
+ *
+ * @param value The value.
+ * @return The serialized value.
+ */
+static std::string serialize(const rapidjson::Value& value) {
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    value.Accept(writer);
+    return sb.GetString();
+}
+
+/**
+ * Writes summary statistics of a series of samples as a JSON object.
+ *
+ * @param writer The writer.
+ * @param name The member name.
+ * @param samples The samples, reordered by this call.
+ */
+static void writeSummary(
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer,
+    const char* name,
+    std::vector<double>& samples) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("samples");
+    writer.Uint(static_cast<unsigned>(samples.size()));
+    if (!samples.empty()) {
+        std::sort(samples.begin(), samples.end());
+        double total = 0;
+        for (auto sample : samples) {
+            total += sample;
+        }
+        writer.Key("mean");
+        writer.Double(total / samples.size());
+        writer.Key("p50");
+        writer.Double(samples[samples.size() / 2]);
+        writer.Key("p95");
+        writer.Double(samples[std::min(samples.size() - 1, samples.size() * 95 / 100)]);
+        writer.Key("max");
+        writer.Double(samples.back());
+    }
+    writer.EndObject();
+}
+
+int main(int argc, char** argv) {
+    std::string scenarioPath;
+    std::string uri = DEFAULT_URI;
+    std::string outputPath;
+    int iterations = DEFAULT_ITERATIONS;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--uri" && i + 1 < argc) {
+            uri = argv[++i];
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (!arg.empty() && arg[0] != '-' && scenarioPath.empty()) {
+            scenarioPath = arg;
+        } else {
+            scenarioPath.clear();
+            break;
+        }
+    }
+    if (scenarioPath.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <scenario> [--uri " << DEFAULT_URI
+                  << "] [--iterations N] [--output file]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream scenarioFile(scenarioPath);
+    std::stringstream scenarioContent;
+    scenarioContent << scenarioFile.rdbuf();
+    rapidjson::Document scenario;
+    if (scenario.Parse(scenarioContent.str()).HasParseError() || !scenario.IsObject() ||
+        !scenario.HasMember("document") || !scenario["document"].IsObject()) {
+        std::cerr << "Invalid scenario: " << scenarioPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto viewport = scenario.HasMember("viewport") ? serialize(scenario["viewport"]) : DEFAULT_VIEWPORT;
+    auto windowId = scenario.HasMember("windowId") && scenario["windowId"].IsString()
+                        ? std::string(scenario["windowId"].GetString())
+                        : DEFAULT_WINDOW_ID;
+
+    // renderStaticDocument
+    rapidjson::Document render(rapidjson::kObjectType);
+    {
+        auto& alloc = render.GetAllocator();
+        rapidjson::Value payload;
+        payload.CopyFrom(scenario["document"], alloc);
+        render.AddMember("type", "renderStaticDocument", alloc);
+        render.AddMember("token", rapidjson::Value(HEADLESS_TOKEN.c_str(), alloc).Move(), alloc);
+        render.AddMember("windowId", rapidjson::Value(windowId.c_str(), alloc).Move(), alloc);
+        render.AddMember("payload", payload, alloc);
+    }
+    auto renderMessage = serialize(render);
+
+    // executeCommands
+    std::string commandsMessage;
+    if (scenario.HasMember("updateCommands") && scenario["updateCommands"].IsArray()) {
+        rapidjson::Document commands(rapidjson::kObjectType);
+        auto& alloc = commands.GetAllocator();
+        rapidjson::Value commandArray;
+        commandArray.CopyFrom(scenario["updateCommands"], alloc);
+        rapidjson::Value payload(rapidjson::kObjectType);
+        payload.AddMember("commands", commandArray, alloc);
+        commands.AddMember("type", "executeCommands", alloc);
+        commands.AddMember("token", rapidjson::Value(HEADLESS_TOKEN.c_str(), alloc).Move(), alloc);
+        commands.AddMember("payload", payload, alloc);
+        commandsMessage = serialize(commands);
+    }
+
+    // Press, sent as an APL update like the GUI's TouchWrapper does.
+    std::string pressMessage;
+    if (scenario.HasMember("eventComponentId") && scenario["eventComponentId"].IsString()) {
+        rapidjson::Document press(rapidjson::kObjectType);
+        auto& alloc = press.GetAllocator();
+        rapidjson::Value payload(rapidjson::kObjectType);
+        payload.AddMember("id", rapidjson::Value(scenario["eventComponentId"].GetString(), alloc).Move(), alloc);
+        payload.AddMember("type", UPDATE_PRESSED, alloc);
+        payload.AddMember("value", 0, alloc);
+        press.AddMember("type", "update", alloc);
+        press.AddMember("payload", payload, alloc);
+        pressMessage = serialize(press);
+    }
+
+    HeadlessViewhost viewhost(viewport, APL_MAX_VERSION);
+    if (!viewhost.connect(uri, CONNECT_TIMEOUT)) {
+        std::cerr << "Init handshake with " << uri << " did not complete" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<double> renderSamples;
+    std::vector<double> hierarchyBytes;
+    std::vector<double> commandSamples;
+    std::vector<double> updateIntervals;
+    std::vector<double> eventSamples;
+    HeadlessViewhost::CoreMessage message;
+
+    for (int i = 0; i < iterations; i++) {
+        viewhost.clearCoreMessages();
+        auto start = HeadlessViewhost::Clock::now();
+        viewhost.send(renderMessage);
+        if (!viewhost.waitForCoreMessage(HIERARCHY_TYPE, RESPONSE_TIMEOUT, &message)) {
+            std::cerr << "Iteration " << i << ": no hierarchy received" << std::endl;
+            continue;
+        }
+        renderSamples.push_back(Milliseconds(message.time - start).count());
+        hierarchyBytes.push_back(message.bytes);
+
+        if (!commandsMessage.empty()) {
+            viewhost.clearCoreMessages();
+            start = HeadlessViewhost::Clock::now();
+            viewhost.send(commandsMessage);
+            auto updates = viewhost.collectCoreMessages(DIRTY_TYPE, UPDATE_QUIET_PERIOD, UPDATE_MAX_DURATION);
+            if (!updates.empty()) {
+                commandSamples.push_back(Milliseconds(updates.front().time - start).count());
+                for (size_t update = 1; update < updates.size(); update++) {
+                    updateIntervals.push_back(Milliseconds(updates[update].time - updates[update - 1].time).count());
+                }
+            }
+        }
+
+        if (!pressMessage.empty()) {
+            viewhost.clearCoreMessages();
+            start = HeadlessViewhost::Clock::now();
+            viewhost.sendAplEvent(pressMessage);
+            if (viewhost.waitForCoreMessage(DIRTY_TYPE, RESPONSE_TIMEOUT, &message)) {
+                eventSamples.push_back(Milliseconds(message.time - start).count());
+            }
+        }
+    }
+
+    viewhost.disconnect();
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("scenario");
+    writer.String(scenarioPath);
+    writer.Key("iterations");
+    writer.Int(iterations);
+    writeSummary(writer, "directiveToHierarchyMs", renderSamples);
+    writeSummary(writer, "hierarchyBytes", hierarchyBytes);
+    writeSummary(writer, "commandToUpdateMs", commandSamples);
+    writeSummary(writer, "updateToUpdateMs", updateIntervals);
+    writeSummary(writer, "eventToUserEventMs", eventSamples);
+    writer.EndObject();
+
+    if (outputPath.empty()) {
+        std::cout << sb.GetString() << std::endl;
+    } else {
+        std::ofstream output(outputPath);
+        output << sb.GetString() << std::endl;
+    }
+
+    return renderSamples.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -32,56 +32,58 @@ public:
      * @param hint A channel type specific hint for how to construct the logger
      */
     WebSocketSDKLogger(websocketpp::log::channel_type_hint::value hint = websocketpp::log::channel_type_hint::access) :
-            m_channelTypeHint{hint} {
+            WebSocketSDKLogger{ALL_CHANNELS, hint} {
     }
 
     /// Construct the logger
     /**
-     * @param channels
+     * @param channels The channels which are statically enabled, they are also dynamically enabled initially
      * @param hint The type of messages this logger will process, access or error
      */
-    WebSocketSDKLogger(level channels, websocketpp::log::channel_type_hint::value hint) : m_channelTypeHint{hint} {
+    WebSocketSDKLogger(level channels, websocketpp::log::channel_type_hint::value hint) :
+            m_channelTypeHint{hint},
+            m_staticChannels{channels},
+            m_dynamicChannels{channels} {
     }
 
     /// Dynamically enable the given list of channels
     /**
-     *  This logger depends on the SDK logger for log level selection, channel selection is ignored
-     *
      * @param channels
      */
     void set_channels(level channels) {
+        m_dynamicChannels |= (channels & m_staticChannels);
     }
 
     /// Dynamically disable the given list of channels
     /**
-     *  This logger depends on the SDK logger for log level selection, channel selection is ignored
-     *
      * @param channels
      */
     void clear_channels(level channels) {
+        m_dynamicChannels &= ~channels;
     }
 
     /// Tests whether a log level is statically enabled.
     /**
-     *  This logger depends on the SDK logger for log level selection
-     *  so always return true and ignore arguments
+     *  Channels logged at SDK debug levels are disabled when SDK debug logs are compiled out, so that websocketpp does
+     *  not format their messages.
      *
      *  @param channel
      */
     bool static_test(level channel) const {
-        return true;
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+        return (channel & m_staticChannels) != 0;
+#else
+        return (channel & m_staticChannels) != 0 && !isDebugChannel(channel);
+#endif
     }
 
     /// Tests whether a log level is dynamically enabled.
     /**
-     *  This logger depends on the SDK logger for log level selection
-     *  so always return true and ignore arguments
+     *  A channel is enabled if it is statically and dynamically enabled and the SDK logger logs its level.
      *
      *  @param channel
      */
-    bool dynamic_test(level channel) const {
-        return true;
-    }
+    bool dynamic_test(level channel) const;
 
     /// Write a string message to the given channel
     /**
@@ -98,6 +100,19 @@ public:
     void write(level channel, char const* msg);
 
 private:
+    /// All channels
+    static const level ALL_CHANNELS = 0xffffffff;
+
+    /// Tests whether a channel is logged at an SDK debug level
+    /**
+     * @param channel The channel
+     * @return Whether messages of @c channel are logged at a debug level
+     */
+    bool isDebugChannel(level channel) const {
+        return m_channelTypeHint == websocketpp::log::channel_type_hint::access ||
+               (channel & (websocketpp::log::elevel::devel | websocketpp::log::elevel::library)) != 0;
+    }
+
     /// retrieve the syslog priority code given a WebSocket++ error channel
     /**
      * @param channel The level to look up
@@ -113,6 +128,12 @@ private:
     void logAccessMessage(level, char const* msg) const;
 
     websocketpp::log::channel_type_hint::value m_channelTypeHint;
+
+    /// The channels which may be enabled
+    const level m_staticChannels;
+
+    /// The channels which are enabled
+    level m_dynamicChannels;
 };
 }  // namespace communication
 }  // namespace alexaSmartScreenSDK
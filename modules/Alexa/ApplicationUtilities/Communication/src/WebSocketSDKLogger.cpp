@@ -29,11 +29,47 @@ static const std::string TAG("WebSocket");
 namespace alexaSmartScreenSDK {
 namespace communication {
 
+using alexaClientSDK::avsCommon::utils::logger::Level;
+
+/**
+ * Retrieve the SDK log level a WebSocket++ error channel is logged at.
+ *
+ * @param channel The channel
+ * @return The SDK log level
+ */
+static Level getErrorLevel(websocketpp::log::level channel) {
+    switch (channel) {
+        case websocketpp::log::elevel::devel:
+        case websocketpp::log::elevel::library:
+            return Level::DEBUG5;
+        case websocketpp::log::elevel::warn:
+            return Level::WARN;
+        case websocketpp::log::elevel::rerror:
+            return Level::ERROR;
+        case websocketpp::log::elevel::fatal:
+            return Level::CRITICAL;
+        default:
+            return Level::INFO;
+    }
+}
+
+bool WebSocketSDKLogger::dynamic_test(websocketpp::log::level channel) const {
+    if (!static_test(channel) || (channel & m_dynamicChannels) == 0) {
+        return false;
+    }
+    auto level =
+        m_channelTypeHint == websocketpp::log::channel_type_hint::access ? Level::DEBUG9 : getErrorLevel(channel);
+    return alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION().shouldLog(level);
+}
+
 void WebSocketSDKLogger::write(websocketpp::log::level channel, std::string const& msg) {
     write(channel, msg.c_str());
 }
 
 void WebSocketSDKLogger::write(websocketpp::log::level channel, char const* msg) {
+    if (!dynamic_test(channel)) {
+        return;
+    }
     if (m_channelTypeHint == websocketpp::log::channel_type_hint::access) {
         logAccessMessage(channel, msg);
     } else {
@@ -0,0 +1,94 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Communication/WebSocketSDKLogger.h"
+
+namespace alexaSmartScreenSDK {
+namespace communication {
+namespace test {
+
+using websocketpp::log::alevel;
+using websocketpp::log::channel_type_hint;
+using websocketpp::log::elevel;
+
+/// Whether channels logged at SDK debug levels are statically enabled in this build.
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+static const bool DEBUG_CHANNELS_ENABLED = true;
+#else
+static const bool DEBUG_CHANNELS_ENABLED = false;
+#endif
+
+/**
+ * Test that only the channels the logger is constructed with are statically enabled.
+ */
+TEST(WebSocketSDKLoggerTest, test_staticTestHonoursStaticChannels) {
+    WebSocketSDKLogger logger(elevel::rerror | elevel::warn, channel_type_hint::error);
+
+    EXPECT_TRUE(logger.static_test(elevel::rerror));
+    EXPECT_TRUE(logger.static_test(elevel::warn));
+    EXPECT_FALSE(logger.static_test(elevel::fatal));
+    EXPECT_FALSE(logger.static_test(elevel::info));
+}
+
+/**
+ * Test that the error channels logged at SDK debug levels, and every access channel, are statically enabled only when
+ * SDK debug logs are compiled in.
+ */
+TEST(WebSocketSDKLoggerTest, test_staticTestOfDebugChannels) {
+    WebSocketSDKLogger errorLogger(channel_type_hint::error);
+    EXPECT_EQ(DEBUG_CHANNELS_ENABLED, errorLogger.static_test(elevel::devel));
+    EXPECT_EQ(DEBUG_CHANNELS_ENABLED, errorLogger.static_test(elevel::library));
+    EXPECT_TRUE(errorLogger.static_test(elevel::info));
+    EXPECT_TRUE(errorLogger.static_test(elevel::fatal));
+
+    WebSocketSDKLogger accessLogger(channel_type_hint::access);
+    EXPECT_EQ(DEBUG_CHANNELS_ENABLED, accessLogger.static_test(alevel::connect));
+    EXPECT_EQ(DEBUG_CHANNELS_ENABLED, accessLogger.static_test(alevel::http));
+}
+
+/**
+ * Test that cleared channels are dynamically disabled, while the other channels stay enabled.
+ */
+TEST(WebSocketSDKLoggerTest, test_clearChannelsDisablesThem) {
+    WebSocketSDKLogger logger(channel_type_hint::error);
+    ASSERT_TRUE(logger.dynamic_test(elevel::rerror));
+    ASSERT_TRUE(logger.dynamic_test(elevel::fatal));
+
+    logger.clear_channels(elevel::fatal);
+
+    EXPECT_FALSE(logger.dynamic_test(elevel::fatal));
+    EXPECT_TRUE(logger.dynamic_test(elevel::rerror));
+    EXPECT_TRUE(logger.static_test(elevel::fatal));
+}
+
+/**
+ * Test that setting channels enables them again, except those which are not statically enabled.
+ */
+TEST(WebSocketSDKLoggerTest, test_setChannelsEnablesOnlyStaticChannels) {
+    WebSocketSDKLogger logger(elevel::rerror, channel_type_hint::error);
+    logger.clear_channels(elevel::rerror);
+    ASSERT_FALSE(logger.dynamic_test(elevel::rerror));
+
+    logger.set_channels(elevel::rerror | elevel::fatal);
+
+    EXPECT_TRUE(logger.dynamic_test(elevel::rerror));
+    EXPECT_FALSE(logger.dynamic_test(elevel::fatal));
+}
+
+}  // namespace test
+}  // namespace communication
+}  // namespace alexaSmartScreenSDK
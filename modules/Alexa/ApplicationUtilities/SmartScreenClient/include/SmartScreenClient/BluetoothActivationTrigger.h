@@ -0,0 +1,61 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_BLUETOOTHACTIVATIONTRIGGER_H_
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_BLUETOOTHACTIVATIONTRIGGER_H_
+
+#include <memory>
+#include <vector>
+
+#include <AVSCommon/Utils/Bluetooth/BluetoothEventBus.h>
+
+#include "SmartScreenClient/LazyCapabilityAgent.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+
+/**
+ * Constructs a lazily created Bluetooth capability agent when the Bluetooth stack reports activity, e.g. when a paired
+ * phone connects or starts streaming without any Bluetooth directive from AVS.  The agent synchronizes with the device
+ * manager when it is constructed, and receives the event which constructed it.
+ */
+class BluetoothActivationTrigger : public alexaClientSDK::avsCommon::utils::bluetooth::BluetoothEventListenerInterface {
+public:
+    /**
+     * Constructor
+     *
+     * @param agent The lazily created Bluetooth capability agent
+     */
+    explicit BluetoothActivationTrigger(std::weak_ptr<LazyCapabilityAgent> agent);
+
+    /**
+     * @return The events which construct the agent
+     */
+    static std::vector<alexaClientSDK::avsCommon::utils::bluetooth::BluetoothEventType> getEventTypes();
+
+    /// @name BluetoothEventListenerInterface Functions
+    /// @{
+    void onEventFired(const alexaClientSDK::avsCommon::utils::bluetooth::BluetoothEvent& event) override;
+    /// @}
+
+private:
+    /// The lazily created Bluetooth capability agent
+    std::weak_ptr<LazyCapabilityAgent> m_agent;
+};
+
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_BLUETOOTHACTIVATIONTRIGGER_H_
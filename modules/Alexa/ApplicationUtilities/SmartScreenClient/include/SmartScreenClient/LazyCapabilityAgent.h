@@ -0,0 +1,213 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_LAZYCAPABILITYAGENT_H_
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_LAZYCAPABILITYAGENT_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <AVSCommon/AVS/CapabilityConfiguration.h>
+#include <AVSCommon/AVS/DirectiveHandlerConfiguration.h>
+#include <AVSCommon/AVS/NamespaceAndName.h>
+#include <AVSCommon/SDKInterfaces/CapabilityConfigurationInterface.h>
+#include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
+#include <AVSCommon/SDKInterfaces/DirectiveHandlerInterface.h>
+#include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
+#include <AVSCommon/SDKInterfaces/Storage/MiscStorageInterface.h>
+#include <AVSCommon/Utils/RequiresShutdown.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+#include <RegistrationManager/CustomerDataHandler.h>
+#include <RegistrationManager/CustomerDataManager.h>
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+
+/**
+ * Stands in for a capability agent which is only constructed when it is first needed.
+ *
+ * The proxy publishes the capability and directive handler configurations the agent itself reported, cached in misc
+ * storage for the running SDK version, so it is registered with the default endpoint and the directive sequencer like
+ * the agent.  Without a cached configuration, e.g. on the first boot or after an SDK update, the agent is constructed
+ * by @c create.  Otherwise the agent, together with its storages, media players and executor threads, is built by the
+ * factory on the first directive, the first call to @c get, the first request for the state it provides or the first
+ * request to clear customer data.  Until then the proxy stands in for it as state provider and customer data handler.
+ */
+class LazyCapabilityAgent
+        : public alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::CapabilityConfigurationInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::StateProviderInterface
+        , public alexaClientSDK::registrationManager::CustomerDataHandler
+        , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
+public:
+    /**
+     * Builds the agent, returns nullptr on failure.  The agent has to register its state providers with the given
+     * context manager, which records them so the proxy can stand in for them on the next boot.
+     */
+    using Factory = std::function<std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface>(
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>)>;
+
+    /**
+     * Creates the proxy, and constructs the agent right away if its configuration is not cached.
+     *
+     * @param name Name of the agent, used for logging and as key of the cached configuration
+     * @param miscStorage The storage the configuration of the agent is cached in
+     * @param contextManager The context manager the agent provides state to
+     * @param customerDataManager The manager the agent is registered with as customer data handler
+     * @param factory Builds the agent, called at most once
+     * @return The proxy, or nullptr if a parameter is invalid or the agent had to be constructed and could not be
+     */
+    static std::shared_ptr<LazyCapabilityAgent> create(
+        const std::string& name,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface> miscStorage,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
+        std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+        Factory factory);
+
+    /**
+     * Gets the agent, constructing it if this is the first use.
+     *
+     * @return The agent, or nullptr if it could not be constructed or the proxy was shut down
+     */
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface> get();
+
+    /**
+     * @return The agent if it was constructed, nullptr otherwise
+     */
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface> getIfCreated() const;
+
+    /// @name DirectiveHandlerInterface Functions
+    /// @{
+    void handleDirectiveImmediately(std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSDirective> directive) override;
+    void preHandleDirective(
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSDirective> directive,
+        std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerResultInterface> result) override;
+    bool handleDirective(const std::string& messageId) override;
+    void cancelDirective(const std::string& messageId) override;
+    void onDeregistered() override;
+    alexaClientSDK::avsCommon::avs::DirectiveHandlerConfiguration getConfiguration() const override;
+    /// @}
+
+    /// @name CapabilityConfigurationInterface Functions
+    /// @{
+    std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>>
+    getCapabilityConfigurations() override;
+    /// @}
+
+    /// @name StateProviderInterface Functions
+    /// @{
+    void provideState(
+        const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
+        unsigned int stateRequestToken) override;
+    /// @}
+
+    /// @name CustomerDataHandler Functions
+    /// @{
+    void clearData() override;
+    /// @}
+
+private:
+    /**
+     * Constructor
+     *
+     * @param name Name of the agent
+     * @param miscStorage The storage the configuration of the agent is cached in
+     * @param contextManager The context manager the agent provides state to
+     * @param customerDataManager The manager the proxy is registered with as customer data handler
+     * @param factory Builds the agent
+     */
+    LazyCapabilityAgent(
+        const std::string& name,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface> miscStorage,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
+        std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+        Factory factory);
+
+    /// @name RequiresShutdown Functions
+    /// @{
+    void doShutdown() override;
+    /// @}
+
+    /**
+     * Loads the configuration cached for the running SDK version.
+     *
+     * @return Whether a cached configuration was loaded
+     */
+    bool loadConfiguration();
+
+    /**
+     * Records the configuration reported by a newly constructed agent.  The configuration is published if the agent
+     * was constructed by @c create, and cached if it differs from the cached one.
+     *
+     * @param agent The agent
+     * @param stateProviderNames The state providers the agent registered
+     */
+    void recordConfiguration(
+        const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface>& agent,
+        const std::vector<alexaClientSDK::avsCommon::avs::NamespaceAndName>& stateProviderNames);
+
+    /// Name of the agent
+    const std::string m_name;
+
+    /// The storage the configuration of the agent is cached in
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface> m_miscStorage;
+
+    /// The context manager the agent provides state to
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> m_contextManager;
+
+    /// Capability configurations published for the agent, set before the proxy is published
+    std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>>
+        m_capabilityConfigurations;
+
+    /// Directives handled by the agent, set before the proxy is published
+    alexaClientSDK::avsCommon::avs::DirectiveHandlerConfiguration m_directiveHandlerConfiguration;
+
+    /// State providers the proxy stands in for, set before the proxy is published
+    std::vector<alexaClientSDK::avsCommon::avs::NamespaceAndName> m_stateProviderNames;
+
+    /// Whether the configurations above were published
+    bool m_isConfigurationPublished;
+
+    /// The configuration as cached, empty if none is cached
+    std::string m_cachedConfiguration;
+
+    /// Builds the agent, reset once it was called
+    Factory m_factory;
+
+    /// The agent once constructed
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface> m_agent;
+
+    /// Whether the agent was constructed, read without @c m_mutex while construction may be under way
+    std::atomic<bool> m_isCreated;
+
+    /// Whether the proxy was shut down, no agent is constructed afterwards
+    bool m_isShutdown;
+
+    /// Serializes construction of the agent
+    mutable std::mutex m_mutex;
+
+    /// Constructs the agent off the threads of the context manager and the customer data manager
+    alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
+};
+
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_INCLUDE_SMARTSCREENCLIENT_LAZYCAPABILITYAGENT_H_
@@ -123,8 +123,10 @@
 #include <System/RevokeAuthorizationHandler.h>
 #endif
 
+#include "BluetoothActivationTrigger.h"
 #include "EqualizerRuntimeSetup.h"
 #include "ExternalCapabilitiesBuilderInterface.h"
+#include "LazyCapabilityAgent.h"
 
 namespace alexaSmartScreenSDK {
 namespace smartScreenClient {
@@ -888,6 +890,13 @@ private:
      */
     SmartScreenClient(const alexaClientSDK::avsCommon::utils::DeviceInfo& deviceInfo);
 
+    /**
+     * Gets the bluetooth capability agent, constructing it if this is the first use.
+     *
+     * @return The bluetooth capability agent, or nullptr if bluetooth is disabled
+     */
+    std::shared_ptr<alexaClientSDK::acsdkBluetooth::Bluetooth> getBluetooth();
+
     /**
      * Initializes the SDK and "glues" all the components together.
      *
@@ -1093,8 +1102,11 @@ private:
     /// The alerts capability agent.
     std::shared_ptr<alexaClientSDK::acsdkAlerts::AlertsCapabilityAgent> m_alertsCapabilityAgent;
 
-    /// The bluetooth capability agent.
-    std::shared_ptr<alexaClientSDK::acsdkBluetooth::Bluetooth> m_bluetooth;
+    /// The bluetooth capability agent, constructed on first use.
+    std::shared_ptr<LazyCapabilityAgent> m_bluetooth;
+
+    /// Constructs the bluetooth capability agent on Bluetooth stack activity.
+    std::shared_ptr<BluetoothActivationTrigger> m_bluetoothActivationTrigger;
 
     /// The interaction model capability agent.
     std::shared_ptr<alexaClientSDK::capabilityAgents::interactionModel::InteractionModelCapabilityAgent>
@@ -0,0 +1,61 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "SmartScreenClient/BluetoothActivationTrigger.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+
+using namespace alexaClientSDK::avsCommon::utils::bluetooth;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("BluetoothActivationTrigger");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+BluetoothActivationTrigger::BluetoothActivationTrigger(std::weak_ptr<LazyCapabilityAgent> agent) :
+        m_agent{std::move(agent)} {
+}
+
+std::vector<BluetoothEventType> BluetoothActivationTrigger::getEventTypes() {
+    return {BluetoothEventType::DEVICE_STATE_CHANGED,
+            BluetoothEventType::STREAMING_STATE_CHANGED,
+            BluetoothEventType::MEDIA_COMMAND_RECEIVED};
+}
+
+void BluetoothActivationTrigger::onEventFired(const BluetoothEvent& event) {
+    auto agent = m_agent.lock();
+    if (!agent || agent->getIfCreated()) {
+        return;
+    }
+    ACSDK_DEBUG5(LX(__func__).m("Bluetooth activity, constructing Bluetooth CA"));
+    // The agent starts listening to the event bus while it is constructed, after this event was dispatched.
+    auto listener = std::dynamic_pointer_cast<BluetoothEventListenerInterface>(agent->get());
+    if (!listener) {
+        ACSDK_ERROR(LX("onEventFiredFailed").d("reason", "noBluetoothEventListener"));
+        return;
+    }
+    listener->onEventFired(event);
+}
+
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,635 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <tuple>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <AVSCommon/SDKInterfaces/DirectiveHandlerResultInterface.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/SDKVersion.h>
+
+#include "SmartScreenClient/LazyCapabilityAgent.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+
+using namespace alexaClientSDK::avsCommon::avs;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces::storage;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LazyCapabilityAgent");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Component name of the cached configurations in misc storage.
+static const std::string COMPONENT_NAME = "lazyCapabilityAgent";
+
+/// Table of the cached configurations in misc storage, keyed by agent name.
+static const std::string TABLE_NAME = "configurations";
+
+/// Key of the SDK version the configuration was reported by.
+static const char SDK_VERSION_KEY[] = "sdkVersion";
+
+/// Key of the capability configurations.
+static const char CAPABILITIES_KEY[] = "capabilities";
+
+/// Key of the directive handler configuration.
+static const char DIRECTIVES_KEY[] = "directives";
+
+/// Key of the state providers.
+static const char STATE_PROVIDERS_KEY[] = "stateProviders";
+
+/// Key of the type of a capability.
+static const char TYPE_KEY[] = "type";
+
+/// Key of the interface name of a capability.
+static const char INTERFACE_NAME_KEY[] = "interfaceName";
+
+/// Key of the version of a capability.
+static const char VERSION_KEY[] = "version";
+
+/// Key of the namespace of a directive or state provider.
+static const char NAMESPACE_KEY[] = "namespace";
+
+/// Key of the name of a directive or state provider.
+static const char NAME_KEY[] = "name";
+
+/// Key of the mediums of a blocking policy.
+static const char MEDIUMS_KEY[] = "mediums";
+
+/// Key of whether a blocking policy is blocking.
+static const char IS_BLOCKING_KEY[] = "isBlocking";
+
+/**
+ * A context manager handed to the factory of an agent, which forwards to the real context manager and records the
+ * state providers the agent registers.
+ */
+class StateProviderRecorder : public ContextManagerInterface {
+public:
+    /**
+     * Constructor
+     *
+     * @param contextManager The real context manager
+     */
+    explicit StateProviderRecorder(std::shared_ptr<ContextManagerInterface> contextManager) :
+            m_contextManager{std::move(contextManager)} {
+    }
+
+    /**
+     * @return The state providers registered so far
+     */
+    std::vector<NamespaceAndName> getStateProviderNames() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_stateProviderNames;
+    }
+
+    /// @name ContextManagerInterface Functions
+    /// @{
+    void setStateProvider(const CapabilityTag& stateProviderName, std::shared_ptr<StateProviderInterface> stateProvider)
+        override {
+        record(stateProviderName, stateProvider != nullptr);
+        m_contextManager->setStateProvider(stateProviderName, stateProvider);
+    }
+
+    void addStateProvider(
+        const CapabilityTag& capabilityIdentifier,
+        std::shared_ptr<StateProviderInterface> stateProvider) override {
+        record(capabilityIdentifier, stateProvider != nullptr);
+        m_contextManager->addStateProvider(capabilityIdentifier, stateProvider);
+    }
+
+    void removeStateProvider(const CapabilityTag& capabilityIdentifier) override {
+        record(capabilityIdentifier, false);
+        m_contextManager->removeStateProvider(capabilityIdentifier);
+    }
+
+    SetStateResult setState(
+        const CapabilityTag& stateProviderName,
+        const std::string& jsonState,
+        const StateRefreshPolicy& refreshPolicy,
+        const unsigned int stateRequestToken) override {
+        return m_contextManager->setState(stateProviderName, jsonState, refreshPolicy, stateRequestToken);
+    }
+
+    ContextRequestToken getContext(
+        std::shared_ptr<ContextRequesterInterface> contextRequester,
+        const std::string& endpointId,
+        const std::chrono::milliseconds& timeout) override {
+        return m_contextManager->getContext(contextRequester, endpointId, timeout);
+    }
+
+    ContextRequestToken getContextWithoutReportableStateProperties(
+        std::shared_ptr<ContextRequesterInterface> contextRequester,
+        const std::string& endpointId,
+        const std::chrono::milliseconds& timeout) override {
+        return m_contextManager->getContextWithoutReportableStateProperties(contextRequester, endpointId, timeout);
+    }
+
+    void reportStateChange(
+        const CapabilityTag& capabilityIdentifier,
+        const CapabilityState& capabilityState,
+        AlexaStateChangeCauseType cause) override {
+        m_contextManager->reportStateChange(capabilityIdentifier, capabilityState, cause);
+    }
+
+    void provideStateResponse(
+        const CapabilityTag& capabilityIdentifier,
+        const CapabilityState& capabilityState,
+        const unsigned int stateRequestToken) override {
+        m_contextManager->provideStateResponse(capabilityIdentifier, capabilityState, stateRequestToken);
+    }
+
+    void provideStateUnavailableResponse(
+        const CapabilityTag& capabilityIdentifier,
+        const unsigned int stateRequestToken,
+        bool isEndpointUnreachable) override {
+        m_contextManager->provideStateUnavailableResponse(
+            capabilityIdentifier, stateRequestToken, isEndpointUnreachable);
+    }
+
+    void addContextManagerObserver(std::shared_ptr<ContextManagerObserverInterface> observer) override {
+        m_contextManager->addContextManagerObserver(observer);
+    }
+
+    void removeContextManagerObserver(const std::shared_ptr<ContextManagerObserverInterface>& observer) override {
+        m_contextManager->removeContextManagerObserver(observer);
+    }
+    /// @}
+
+private:
+    /**
+     * Records a state provider being registered or removed.
+     *
+     * @param stateProviderName The state provider
+     * @param isRegistered Whether the state provider is registered
+     */
+    void record(const CapabilityTag& stateProviderName, bool isRegistered) {
+        NamespaceAndName name{stateProviderName.nameSpace, stateProviderName.name};
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stateProviderNames.erase(
+            std::remove(m_stateProviderNames.begin(), m_stateProviderNames.end(), name), m_stateProviderNames.end());
+        if (isRegistered) {
+            m_stateProviderNames.push_back(name);
+        }
+    }
+
+    /// The real context manager
+    std::shared_ptr<ContextManagerInterface> m_contextManager;
+
+    /// Serializes access to @c m_stateProviderNames
+    std::mutex m_mutex;
+
+    /// The state providers registered
+    std::vector<NamespaceAndName> m_stateProviderNames;
+};
+
+/**
+ * Serializes the configuration of an agent for the running SDK version.  Entries are sorted so equal configurations
+ * serialize equally.
+ *
+ * @param capabilityConfigurations The capability configurations
+ * @param directiveHandlerConfiguration The directive handler configuration
+ * @param stateProviderNames The state providers
+ * @param[out] json Receives the serialized configuration
+ * @return Whether the configuration can be cached, capabilities with instances, properties or additional
+ * configurations are not
+ */
+static bool serializeConfiguration(
+    const std::unordered_set<std::shared_ptr<CapabilityConfiguration>>& capabilityConfigurations,
+    const DirectiveHandlerConfiguration& directiveHandlerConfiguration,
+    const std::vector<NamespaceAndName>& stateProviderNames,
+    std::string* json) {
+    std::vector<std::tuple<std::string, std::string, std::string>> capabilities;
+    for (auto& configuration : capabilityConfigurations) {
+        if (!configuration || configuration->instanceName.hasValue() || configuration->properties.hasValue() ||
+            !configuration->additionalConfigurations.empty()) {
+            return false;
+        }
+        capabilities.emplace_back(configuration->type, configuration->interfaceName, configuration->version);
+    }
+    std::sort(capabilities.begin(), capabilities.end());
+
+    std::vector<std::tuple<std::string, std::string, unsigned long, bool>> directives;
+    for (auto& entry : directiveHandlerConfiguration) {
+        directives.emplace_back(
+            entry.first.nameSpace, entry.first.name, entry.second.getMediums().to_ulong(), entry.second.isBlocking());
+    }
+    std::sort(directives.begin(), directives.end());
+
+    std::vector<std::tuple<std::string, std::string>> stateProviders;
+    for (auto& name : stateProviderNames) {
+        stateProviders.emplace_back(name.nameSpace, name.name);
+    }
+    std::sort(stateProviders.begin(), stateProviders.end());
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key(SDK_VERSION_KEY);
+    writer.String(alexaClientSDK::avsCommon::utils::sdkVersion::getCurrentVersion());
+    writer.Key(CAPABILITIES_KEY);
+    writer.StartArray();
+    for (auto& capability : capabilities) {
+        writer.StartObject();
+        writer.Key(TYPE_KEY);
+        writer.String(std::get<0>(capability));
+        writer.Key(INTERFACE_NAME_KEY);
+        writer.String(std::get<1>(capability));
+        writer.Key(VERSION_KEY);
+        writer.String(std::get<2>(capability));
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key(DIRECTIVES_KEY);
+    writer.StartArray();
+    for (auto& directive : directives) {
+        writer.StartObject();
+        writer.Key(NAMESPACE_KEY);
+        writer.String(std::get<0>(directive));
+        writer.Key(NAME_KEY);
+        writer.String(std::get<1>(directive));
+        writer.Key(MEDIUMS_KEY);
+        writer.Uint64(std::get<2>(directive));
+        writer.Key(IS_BLOCKING_KEY);
+        writer.Bool(std::get<3>(directive));
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key(STATE_PROVIDERS_KEY);
+    writer.StartArray();
+    for (auto& stateProvider : stateProviders) {
+        writer.StartObject();
+        writer.Key(NAMESPACE_KEY);
+        writer.String(std::get<0>(stateProvider));
+        writer.Key(NAME_KEY);
+        writer.String(std::get<1>(stateProvider));
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    json->assign(buffer.GetString(), buffer.GetSize());
+    return true;
+}
+
+/**
+ * Gets a string member of a JSON object.
+ *
+ * @param object The object
+ * @param key The member name
+ * @param[out] value Receives the value
+ * @return Whether the member exists and is a string
+ */
+static bool getString(const rapidjson::Value& object, const char* key, std::string* value) {
+    auto it = object.FindMember(key);
+    if (it == object.MemberEnd() || !it->value.IsString()) {
+        return false;
+    }
+    value->assign(it->value.GetString(), it->value.GetStringLength());
+    return true;
+}
+
+/**
+ * Parses a configuration serialized by @c serializeConfiguration.
+ *
+ * @param json The serialized configuration
+ * @param[out] capabilityConfigurations Receives the capability configurations
+ * @param[out] directiveHandlerConfiguration Receives the directive handler configuration
+ * @param[out] stateProviderNames Receives the state providers
+ * @return Whether the configuration is valid and was reported by the running SDK version
+ */
+static bool parseConfiguration(
+    const std::string& json,
+    std::unordered_set<std::shared_ptr<CapabilityConfiguration>>* capabilityConfigurations,
+    DirectiveHandlerConfiguration* directiveHandlerConfiguration,
+    std::vector<NamespaceAndName>* stateProviderNames) {
+    rapidjson::Document document;
+    if (document.Parse(json.c_str()).HasParseError() || !document.IsObject()) {
+        return false;
+    }
+
+    std::string sdkVersion;
+    if (!getString(document, SDK_VERSION_KEY, &sdkVersion) ||
+        sdkVersion != alexaClientSDK::avsCommon::utils::sdkVersion::getCurrentVersion()) {
+        return false;
+    }
+
+    auto capabilities = document.FindMember(CAPABILITIES_KEY);
+    auto directives = document.FindMember(DIRECTIVES_KEY);
+    auto stateProviders = document.FindMember(STATE_PROVIDERS_KEY);
+    if (capabilities == document.MemberEnd() || !capabilities->value.IsArray() ||
+        directives == document.MemberEnd() || !directives->value.IsArray() ||
+        stateProviders == document.MemberEnd() || !stateProviders->value.IsArray()) {
+        return false;
+    }
+
+    for (auto& capability : capabilities->value.GetArray()) {
+        std::string type, interfaceName, version;
+        if (!capability.IsObject() || !getString(capability, TYPE_KEY, &type) ||
+            !getString(capability, INTERFACE_NAME_KEY, &interfaceName) ||
+            !getString(capability, VERSION_KEY, &version)) {
+            return false;
+        }
+        capabilityConfigurations->insert(std::make_shared<CapabilityConfiguration>(type, interfaceName, version));
+    }
+
+    for (auto& directive : directives->value.GetArray()) {
+        std::string nameSpace, name;
+        if (!directive.IsObject() || !getString(directive, NAMESPACE_KEY, &nameSpace) ||
+            !getString(directive, NAME_KEY, &name)) {
+            return false;
+        }
+        auto mediums = directive.FindMember(MEDIUMS_KEY);
+        auto isBlocking = directive.FindMember(IS_BLOCKING_KEY);
+        if (mediums == directive.MemberEnd() || !mediums->value.IsUint64() || isBlocking == directive.MemberEnd() ||
+            !isBlocking->value.IsBool()) {
+            return false;
+        }
+        (*directiveHandlerConfiguration)[NamespaceAndName{nameSpace, name}] =
+            BlockingPolicy(BlockingPolicy::Mediums(mediums->value.GetUint64()), isBlocking->value.GetBool());
+    }
+
+    for (auto& stateProvider : stateProviders->value.GetArray()) {
+        std::string nameSpace, name;
+        if (!stateProvider.IsObject() || !getString(stateProvider, NAMESPACE_KEY, &nameSpace) ||
+            !getString(stateProvider, NAME_KEY, &name)) {
+            return false;
+        }
+        stateProviderNames->emplace_back(nameSpace, name);
+    }
+    return true;
+}
+
+std::shared_ptr<LazyCapabilityAgent> LazyCapabilityAgent::create(
+    const std::string& name,
+    std::shared_ptr<MiscStorageInterface> miscStorage,
+    std::shared_ptr<ContextManagerInterface> contextManager,
+    std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+    Factory factory) {
+    if (!miscStorage) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullMiscStorage").d("name", name));
+        return nullptr;
+    }
+    if (!contextManager) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullContextManager").d("name", name));
+        return nullptr;
+    }
+    if (!customerDataManager) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullCustomerDataManager").d("name", name));
+        return nullptr;
+    }
+    if (!factory) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullFactory").d("name", name));
+        return nullptr;
+    }
+
+    std::shared_ptr<LazyCapabilityAgent> agent(
+        new LazyCapabilityAgent(name, miscStorage, contextManager, customerDataManager, std::move(factory)));
+    if (!agent->loadConfiguration()) {
+        ACSDK_DEBUG5(LX("create").d("name", name).m("No cached configuration, constructing agent"));
+        if (!agent->get()) {
+            ACSDK_ERROR(LX("createFailed").d("reason", "agentConstructionFailed").d("name", name));
+            return nullptr;
+        }
+    } else {
+        // The agent replaces the proxy as state provider once it is constructed.
+        for (auto& stateProviderName : agent->m_stateProviderNames) {
+            contextManager->setStateProvider(stateProviderName, agent);
+        }
+    }
+    agent->m_isConfigurationPublished = true;
+    return agent;
+}
+
+LazyCapabilityAgent::LazyCapabilityAgent(
+    const std::string& name,
+    std::shared_ptr<MiscStorageInterface> miscStorage,
+    std::shared_ptr<ContextManagerInterface> contextManager,
+    std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+    Factory factory) :
+        CustomerDataHandler{customerDataManager},
+        RequiresShutdown{"LazyCapabilityAgent:" + name},
+        m_name{name},
+        m_miscStorage{std::move(miscStorage)},
+        m_contextManager{std::move(contextManager)},
+        m_isConfigurationPublished{false},
+        m_factory{std::move(factory)},
+        m_isCreated{false},
+        m_isShutdown{false} {
+}
+
+bool LazyCapabilityAgent::loadConfiguration() {
+    bool tableExists = false;
+    if (!m_miscStorage->tableExists(COMPONENT_NAME, TABLE_NAME, &tableExists)) {
+        ACSDK_ERROR(LX("loadConfigurationFailed").d("reason", "tableExistsFailed").d("name", m_name));
+        return false;
+    }
+    if (!tableExists) {
+        if (!m_miscStorage->createTable(
+                COMPONENT_NAME,
+                TABLE_NAME,
+                MiscStorageInterface::KeyType::STRING_KEY,
+                MiscStorageInterface::ValueType::STRING_VALUE)) {
+            ACSDK_ERROR(LX("loadConfigurationFailed").d("reason", "createTableFailed").d("name", m_name));
+        }
+        return false;
+    }
+
+    std::string configuration;
+    if (!m_miscStorage->get(COMPONENT_NAME, TABLE_NAME, m_name, &configuration) || configuration.empty()) {
+        return false;
+    }
+    if (!parseConfiguration(
+            configuration, &m_capabilityConfigurations, &m_directiveHandlerConfiguration, &m_stateProviderNames)) {
+        ACSDK_DEBUG5(LX("loadConfiguration").d("name", m_name).m("Cached configuration invalid or outdated"));
+        m_capabilityConfigurations.clear();
+        m_directiveHandlerConfiguration.clear();
+        m_stateProviderNames.clear();
+        return false;
+    }
+    m_cachedConfiguration = configuration;
+    return true;
+}
+
+void LazyCapabilityAgent::recordConfiguration(
+    const std::shared_ptr<DirectiveHandlerInterface>& agent,
+    const std::vector<NamespaceAndName>& stateProviderNames) {
+    auto directiveHandlerConfiguration = agent->getConfiguration();
+    std::unordered_set<std::shared_ptr<CapabilityConfiguration>> capabilityConfigurations;
+    auto capabilityConfigurationInterface = std::dynamic_pointer_cast<CapabilityConfigurationInterface>(agent);
+    if (capabilityConfigurationInterface) {
+        capabilityConfigurations = capabilityConfigurationInterface->getCapabilityConfigurations();
+    }
+
+    if (!m_isConfigurationPublished) {
+        m_capabilityConfigurations = capabilityConfigurations;
+        m_directiveHandlerConfiguration = directiveHandlerConfiguration;
+        m_stateProviderNames = stateProviderNames;
+    }
+
+    std::string configuration;
+    if (!serializeConfiguration(
+            capabilityConfigurations, directiveHandlerConfiguration, stateProviderNames, &configuration)) {
+        ACSDK_WARN(LX("configurationNotCached").d("reason", "unsupportedCapabilityConfiguration").d("name", m_name));
+        return;
+    }
+    if (configuration == m_cachedConfiguration) {
+        return;
+    }
+    if (m_isConfigurationPublished) {
+        ACSDK_WARN(LX("publishedConfigurationOutdated").d("name", m_name).m("Cache updated for the next boot"));
+    }
+    if (!m_miscStorage->put(COMPONENT_NAME, TABLE_NAME, m_name, configuration)) {
+        ACSDK_ERROR(LX("recordConfigurationFailed").d("reason", "putFailed").d("name", m_name));
+        return;
+    }
+    m_cachedConfiguration = configuration;
+}
+
+std::shared_ptr<DirectiveHandlerInterface> LazyCapabilityAgent::get() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_agent || !m_factory || m_isShutdown) {
+        return m_agent;
+    }
+
+    ACSDK_DEBUG5(LX("constructingAgent").d("name", m_name));
+    auto factory = std::move(m_factory);
+    m_factory = nullptr;
+    auto stateProviderRecorder = std::make_shared<StateProviderRecorder>(m_contextManager);
+    m_agent = factory(stateProviderRecorder);
+    if (!m_agent) {
+        ACSDK_ERROR(LX("getFailed").d("reason", "agentConstructionFailed").d("name", m_name));
+        return nullptr;
+    }
+
+    recordConfiguration(m_agent, stateProviderRecorder->getStateProviderNames());
+    m_isCreated = true;
+    return m_agent;
+}
+
+std::shared_ptr<DirectiveHandlerInterface> LazyCapabilityAgent::getIfCreated() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_agent;
+}
+
+void LazyCapabilityAgent::handleDirectiveImmediately(std::shared_ptr<AVSDirective> directive) {
+    auto agent = get();
+    if (!agent) {
+        ACSDK_ERROR(LX("handleDirectiveImmediatelyFailed").d("reason", "noAgent").d("name", m_name));
+        return;
+    }
+    agent->handleDirectiveImmediately(directive);
+}
+
+void LazyCapabilityAgent::preHandleDirective(
+    std::shared_ptr<AVSDirective> directive,
+    std::unique_ptr<DirectiveHandlerResultInterface> result) {
+    auto agent = get();
+    if (!agent) {
+        ACSDK_ERROR(LX("preHandleDirectiveFailed").d("reason", "noAgent").d("name", m_name));
+        if (result) {
+            result->setFailed(m_name + " is not available");
+        }
+        return;
+    }
+    agent->preHandleDirective(directive, std::move(result));
+}
+
+bool LazyCapabilityAgent::handleDirective(const std::string& messageId) {
+    auto agent = getIfCreated();
+    if (!agent) {
+        ACSDK_ERROR(LX("handleDirectiveFailed").d("reason", "noAgent").d("name", m_name));
+        return false;
+    }
+    return agent->handleDirective(messageId);
+}
+
+void LazyCapabilityAgent::cancelDirective(const std::string& messageId) {
+    auto agent = getIfCreated();
+    if (agent) {
+        agent->cancelDirective(messageId);
+    }
+}
+
+void LazyCapabilityAgent::onDeregistered() {
+    auto agent = getIfCreated();
+    if (agent) {
+        agent->onDeregistered();
+    }
+}
+
+DirectiveHandlerConfiguration LazyCapabilityAgent::getConfiguration() const {
+    return m_directiveHandlerConfiguration;
+}
+
+std::unordered_set<std::shared_ptr<CapabilityConfiguration>> LazyCapabilityAgent::getCapabilityConfigurations() {
+    return m_capabilityConfigurations;
+}
+
+void LazyCapabilityAgent::provideState(const NamespaceAndName& stateProviderName, unsigned int stateRequestToken) {
+    m_executor.submit([this, stateProviderName, stateRequestToken]() {
+        auto stateProvider = std::dynamic_pointer_cast<StateProviderInterface>(get());
+        if (!stateProvider) {
+            ACSDK_ERROR(LX("provideStateFailed").d("reason", "noStateProvider").d("name", m_name));
+            return;
+        }
+        stateProvider->provideState(stateProviderName, stateRequestToken);
+    });
+}
+
+void LazyCapabilityAgent::clearData() {
+    // A constructed agent clears its data as a customer data handler of its own.
+    if (m_isCreated) {
+        return;
+    }
+    // The agent registers with the customer data manager while it is constructed, which blocks while data is cleared.
+    m_executor.submit([this]() {
+        auto customerDataHandler = std::dynamic_pointer_cast<CustomerDataHandler>(get());
+        if (!customerDataHandler) {
+            ACSDK_ERROR(LX("clearDataFailed").d("reason", "noCustomerDataHandler").d("name", m_name));
+            return;
+        }
+        customerDataHandler->clearData();
+    });
+}
+
+void LazyCapabilityAgent::doShutdown() {
+    m_executor.shutdown();
+
+    std::shared_ptr<DirectiveHandlerInterface> agent;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShutdown = true;
+        m_factory = nullptr;
+        agent = std::move(m_agent);
+    }
+    auto requiresShutdown = std::dynamic_pointer_cast<alexaClientSDK::avsCommon::utils::RequiresShutdown>(agent);
+    if (requiresShutdown) {
+        requiresShutdown->shutdown();
+    }
+}
+
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
@@ -94,6 +94,9 @@ static const std::string AUDIO_CHANNEL_CONFIG_KEY = "audioChannels";
 /// Key for the interrupt model configuration
 static const std::string INTERRUPT_MODEL_CONFIG_KEY = "interruptModel";
 
+/// Name of the Bluetooth CA, under which the configuration it reports is cached.
+static const std::string BLUETOOTH_CAPABILITY_AGENT_NAME = "Bluetooth";
+
 /// String to identify log entries originating from this file.
 static const std::string TAG("SmartScreenClient");
 
@@ -1261,34 +1264,59 @@ bool SmartScreenClient::initialize(
     }
 
     if (bluetoothDeviceManager) {
-        ACSDK_DEBUG5(LX(__func__).m("Creating Bluetooth CA"));
-
         // Create a temporary pointer to the eventBus inside of
         // bluetoothDeviceManager so that
         // the unique ptr for bluetoothDeviceManager can be moved.
         auto eventBus = bluetoothDeviceManager->getEventBus();
 
-        auto bluetoothMediaInputTransformer =
-            alexaClientSDK::acsdkBluetooth::BluetoothMediaInputTransformer::create(eventBus, m_playbackRouter);
+        // The factory has to be copyable, the device manager is moved out of the holder on the only call.
+        auto deviceManagerHolder =
+            std::make_shared<std::unique_ptr<avsCommon::sdkInterfaces::bluetooth::BluetoothDeviceManagerInterface>>(
+                std::move(bluetoothDeviceManager));
+        auto audioFocusManager = m_audioFocusManager;
+        auto connectionManager = m_connectionManager;
+        auto exceptionSender = m_exceptionSender;
+        auto playbackRouter = m_playbackRouter;
 
         /*
          * Creating the Bluetooth Capability Agent - This component is responsible
          * for handling directives from AVS
-         * regarding bluetooth functionality.
+         * regarding bluetooth functionality.  Once its configuration is cached, its storage, event handling and
+         * executor are only set up on the first Bluetooth directive, context request or customer data reset, the first
+         * use through this client or the first activity of the Bluetooth stack.
          */
-        m_bluetooth = alexaClientSDK::acsdkBluetooth::Bluetooth::create(
+        m_bluetooth = LazyCapabilityAgent::create(
+            BLUETOOTH_CAPABILITY_AGENT_NAME,
+            miscStorage,
             contextManager,
-            m_audioFocusManager,
-            m_connectionManager,
-            m_exceptionSender,
-            std::move(bluetoothStorage),
-            std::move(bluetoothDeviceManager),
-            std::move(eventBus),
-            bluetoothMediaPlayer,
             customerDataManager,
-            enabledConnectionRules,
-            bluetoothChannelVolumeInterface,
-            bluetoothMediaInputTransformer);
+            [=](std::shared_ptr<ContextManagerInterface> recordingContextManager)
+                -> std::shared_ptr<DirectiveHandlerInterface> {
+                ACSDK_DEBUG5(LX("initialize").m("Creating Bluetooth CA"));
+                auto bluetoothMediaInputTransformer =
+                    alexaClientSDK::acsdkBluetooth::BluetoothMediaInputTransformer::create(eventBus, playbackRouter);
+
+                return alexaClientSDK::acsdkBluetooth::Bluetooth::create(
+                    recordingContextManager,
+                    audioFocusManager,
+                    connectionManager,
+                    exceptionSender,
+                    bluetoothStorage,
+                    std::move(*deviceManagerHolder),
+                    eventBus,
+                    bluetoothMediaPlayer,
+                    customerDataManager,
+                    enabledConnectionRules,
+                    bluetoothChannelVolumeInterface,
+                    bluetoothMediaInputTransformer);
+            });
+        if (!m_bluetooth) {
+            ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateBluetooth"));
+            return false;
+        }
+
+        m_bluetoothActivationTrigger = std::make_shared<BluetoothActivationTrigger>(m_bluetooth);
+        eventBus->addListener(BluetoothActivationTrigger::getEventTypes(), m_bluetoothActivationTrigger);
     } else {
         ACSDK_DEBUG5(LX("bluetoothCapabilityAgentDisabled").d("reason", "nullBluetoothDeviceManager"));
     }
@@ -1615,13 +1643,21 @@ void SmartScreenClient::setCaptionMediaPlayers(
 }
 #endif
 
+std::shared_ptr<alexaClientSDK::acsdkBluetooth::Bluetooth> SmartScreenClient::getBluetooth() {
+    if (!m_bluetooth) {
+        return nullptr;
+    }
+    return std::dynamic_pointer_cast<alexaClientSDK::acsdkBluetooth::Bluetooth>(m_bluetooth->get());
+}
+
 void SmartScreenClient::addBluetoothDeviceObserver(
     std::shared_ptr<alexaClientSDK::acsdkBluetoothInterfaces::BluetoothDeviceObserverInterface> observer) {
-    if (!m_bluetooth) {
+    auto bluetooth = getBluetooth();
+    if (!bluetooth) {
         ACSDK_DEBUG5(LX(__func__).m("bluetooth is disabled, not adding observer"));
         return;
     }
-    m_bluetooth->addObserver(observer);
+    bluetooth->addObserver(observer);
 }
 
 void SmartScreenClient::removeBluetoothDeviceObserver(
@@ -1629,7 +1665,12 @@ void SmartScreenClient::removeBluetoothDeviceObserver(
     if (!m_bluetooth) {
         return;
     }
-    m_bluetooth->removeObserver(observer);
+    // An agent which was never constructed has no observers.
+    auto bluetooth = std::dynamic_pointer_cast<alexaClientSDK::acsdkBluetooth::Bluetooth>(m_bluetooth->getIfCreated());
+    if (!bluetooth) {
+        return;
+    }
+    bluetooth->removeObserver(observer);
 }
 
 #ifdef ENABLE_REVOKE_AUTH
@@ -0,0 +1,156 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/SDKInterfaces/Bluetooth/Services/AVRCPTargetInterface.h>
+#include <AVSCommon/Utils/Bluetooth/BluetoothEvents.h>
+#include <RegistrationManager/CustomerDataManager.h>
+
+#include "MockCapabilityAgent.h"
+#include "MockContextManager.h"
+#include "StubMiscStorage.h"
+
+#include "SmartScreenClient/BluetoothActivationTrigger.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+namespace test {
+
+using namespace alexaClientSDK;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces::bluetooth::services;
+using namespace alexaClientSDK::avsCommon::utils::bluetooth;
+using namespace ::testing;
+
+/// Name of the agent under test.
+static const std::string AGENT_NAME = "Bluetooth";
+
+/// Test harness for @c BluetoothActivationTrigger class.
+class BluetoothActivationTriggerTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    /**
+     * Creates the proxy of @c m_agent.
+     *
+     * @param isCached Whether the configuration of the agent is cached first, so the agent is not constructed
+     */
+    void createProxy(bool isCached);
+
+    /// The agent returned by the factory.
+    std::shared_ptr<StrictMock<MockCapabilityAgent>> m_agent;
+
+    /// Number of calls to the factory.
+    int m_factoryCalls;
+
+    /// The proxy of the agent.
+    std::shared_ptr<LazyCapabilityAgent> m_proxy;
+
+    /// The trigger under test.
+    std::shared_ptr<BluetoothActivationTrigger> m_trigger;
+};
+
+void BluetoothActivationTriggerTest::SetUp() {
+    m_agent = std::make_shared<StrictMock<MockCapabilityAgent>>(
+        std::make_shared<registrationManager::CustomerDataManager>());
+    m_factoryCalls = 0;
+}
+
+void BluetoothActivationTriggerTest::TearDown() {
+    if (m_proxy) {
+        m_proxy->shutdown();
+    }
+}
+
+void BluetoothActivationTriggerTest::createProxy(bool isCached) {
+    auto miscStorage = std::make_shared<smartScreenSDKInterfaces::test::StubMiscStorage>();
+    auto contextManager = std::make_shared<NiceMock<smartScreenSDKInterfaces::test::MockContextManager>>();
+    auto customerDataManager = std::make_shared<registrationManager::CustomerDataManager>();
+    auto factory = [this](std::shared_ptr<ContextManagerInterface>) -> std::shared_ptr<DirectiveHandlerInterface> {
+        m_factoryCalls++;
+        return m_agent;
+    };
+    if (isCached) {
+        auto proxy = LazyCapabilityAgent::create(AGENT_NAME, miscStorage, contextManager, customerDataManager, factory);
+        ASSERT_TRUE(proxy);
+        proxy->shutdown();
+        m_factoryCalls = 0;
+    }
+    m_proxy = LazyCapabilityAgent::create(AGENT_NAME, miscStorage, contextManager, customerDataManager, factory);
+    ASSERT_TRUE(m_proxy);
+    m_trigger = std::make_shared<BluetoothActivationTrigger>(m_proxy);
+}
+
+/**
+ * Tests that the trigger listens to the events which report Bluetooth activity.
+ */
+TEST_F(BluetoothActivationTriggerTest, testEventTypes) {
+    auto eventTypes = BluetoothActivationTrigger::getEventTypes();
+    EXPECT_THAT(
+        eventTypes,
+        UnorderedElementsAre(
+            BluetoothEventType::DEVICE_STATE_CHANGED,
+            BluetoothEventType::STREAMING_STATE_CHANGED,
+            BluetoothEventType::MEDIA_COMMAND_RECEIVED));
+}
+
+/**
+ * Tests that an event constructs the agent and is delivered to it.
+ */
+TEST_F(BluetoothActivationTriggerTest, testEventConstructsAgentAndIsDelivered) {
+    createProxy(true);
+    ASSERT_FALSE(m_proxy->getIfCreated());
+
+    EXPECT_CALL(*m_agent, onEventFired(Property(&BluetoothEvent::getType, BluetoothEventType::MEDIA_COMMAND_RECEIVED)))
+        .Times(1);
+    m_trigger->onEventFired(MediaCommandReceivedEvent(MediaCommand::PLAY));
+    EXPECT_EQ(1, m_factoryCalls);
+    EXPECT_EQ(m_agent, m_proxy->getIfCreated());
+}
+
+/**
+ * Tests that events are left to the agent once it is constructed, as it listens to the event bus itself.
+ */
+TEST_F(BluetoothActivationTriggerTest, testEventIgnoredOnceAgentConstructed) {
+    createProxy(false);
+    ASSERT_TRUE(m_proxy->getIfCreated());
+
+    EXPECT_CALL(*m_agent, onEventFired(_)).Times(0);
+    m_trigger->onEventFired(MediaCommandReceivedEvent(MediaCommand::PLAY));
+    EXPECT_EQ(1, m_factoryCalls);
+}
+
+/**
+ * Tests that events are ignored once the proxy is gone.
+ */
+TEST_F(BluetoothActivationTriggerTest, testEventIgnoredWithoutProxy) {
+    createProxy(true);
+    m_proxy->shutdown();
+    m_proxy.reset();
+
+    EXPECT_CALL(*m_agent, onEventFired(_)).Times(0);
+    m_trigger->onEventFired(MediaCommandReceivedEvent(MediaCommand::PLAY));
+    EXPECT_EQ(0, m_factoryCalls);
+}
+
+}  // namespace test
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,296 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <RegistrationManager/CustomerDataManager.h>
+
+#include "MockCapabilityAgent.h"
+#include "MockContextManager.h"
+#include "MockDirectiveHandlerResult.h"
+#include "StubMiscStorage.h"
+
+#include "SmartScreenClient/LazyCapabilityAgent.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+namespace test {
+
+using namespace alexaClientSDK;
+using namespace alexaClientSDK::avsCommon::avs;
+using namespace alexaClientSDK::avsCommon::sdkInterfaces;
+using namespace ::testing;
+
+/// Timeout when waiting for futures to be set.
+static const std::chrono::milliseconds TIMEOUT(1000);
+
+/// Name of the agent under test.
+static const std::string AGENT_NAME = "Test";
+
+/// A message id.
+static const std::string MESSAGE_ID = "messageId";
+
+/// A state request token.
+static const unsigned int STATE_REQUEST_TOKEN = 42;
+
+/// Test harness for @c LazyCapabilityAgent class.
+class LazyCapabilityAgentTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    /**
+     * Creates a proxy whose factory returns @c m_agent.
+     *
+     * @return The proxy
+     */
+    std::shared_ptr<LazyCapabilityAgent> createProxy();
+
+    /// Creates a proxy to cache the configuration of @c m_agent, and a new agent for the next proxy.
+    void cacheConfiguration();
+
+    /// The storage the configuration is cached in.
+    std::shared_ptr<smartScreenSDKInterfaces::test::StubMiscStorage> m_miscStorage;
+
+    /// Mocked @c ContextManagerInterface.
+    std::shared_ptr<NiceMock<smartScreenSDKInterfaces::test::MockContextManager>> m_mockContextManager;
+
+    /// The customer data manager the proxy is registered with.
+    std::shared_ptr<registrationManager::CustomerDataManager> m_customerDataManager;
+
+    /// The agent returned by the factory, registered with a customer data manager of its own.
+    std::shared_ptr<StrictMock<MockCapabilityAgent>> m_agent;
+
+    /// Number of calls to the factory.
+    std::atomic<int> m_factoryCalls;
+
+    /// The proxy under test.
+    std::shared_ptr<LazyCapabilityAgent> m_proxy;
+};
+
+void LazyCapabilityAgentTest::SetUp() {
+    m_miscStorage = std::make_shared<smartScreenSDKInterfaces::test::StubMiscStorage>();
+    m_mockContextManager = std::make_shared<NiceMock<smartScreenSDKInterfaces::test::MockContextManager>>();
+    m_customerDataManager = std::make_shared<registrationManager::CustomerDataManager>();
+    m_agent = std::make_shared<StrictMock<MockCapabilityAgent>>(
+        std::make_shared<registrationManager::CustomerDataManager>());
+    m_factoryCalls = 0;
+}
+
+void LazyCapabilityAgentTest::TearDown() {
+    if (m_proxy) {
+        m_proxy->shutdown();
+    }
+}
+
+std::shared_ptr<LazyCapabilityAgent> LazyCapabilityAgentTest::createProxy() {
+    return LazyCapabilityAgent::create(
+        AGENT_NAME,
+        m_miscStorage,
+        m_mockContextManager,
+        m_customerDataManager,
+        [this](std::shared_ptr<ContextManagerInterface> contextManager) -> std::shared_ptr<DirectiveHandlerInterface> {
+            m_factoryCalls++;
+            contextManager->setStateProvider(TEST_STATE, m_agent);
+            return m_agent;
+        });
+}
+
+void LazyCapabilityAgentTest::cacheConfiguration() {
+    auto proxy = createProxy();
+    ASSERT_TRUE(proxy);
+    proxy->shutdown();
+    m_agent = std::make_shared<StrictMock<MockCapabilityAgent>>(
+        std::make_shared<registrationManager::CustomerDataManager>());
+    m_factoryCalls = 0;
+}
+
+/**
+ * Tests that create fails with null parameters.
+ */
+TEST_F(LazyCapabilityAgentTest, testCreateWithNullParameters) {
+    auto factory = [](std::shared_ptr<ContextManagerInterface>) { return nullptr; };
+    EXPECT_FALSE(
+        LazyCapabilityAgent::create(AGENT_NAME, nullptr, m_mockContextManager, m_customerDataManager, factory));
+    EXPECT_FALSE(LazyCapabilityAgent::create(AGENT_NAME, m_miscStorage, nullptr, m_customerDataManager, factory));
+    EXPECT_FALSE(LazyCapabilityAgent::create(AGENT_NAME, m_miscStorage, m_mockContextManager, nullptr, factory));
+    EXPECT_FALSE(LazyCapabilityAgent::create(
+        AGENT_NAME, m_miscStorage, m_mockContextManager, m_customerDataManager, nullptr));
+}
+
+/**
+ * Tests that create fails if the configuration is not cached and the agent cannot be constructed.
+ */
+TEST_F(LazyCapabilityAgentTest, testCreateFailsIfAgentCannotBeConstructed) {
+    EXPECT_FALSE(LazyCapabilityAgent::create(
+        AGENT_NAME,
+        m_miscStorage,
+        m_mockContextManager,
+        m_customerDataManager,
+        [](std::shared_ptr<ContextManagerInterface>) { return nullptr; }));
+}
+
+/**
+ * Tests that the agent is constructed right away without a cached configuration, and that the proxy publishes the
+ * configuration the agent reports.
+ */
+TEST_F(LazyCapabilityAgentTest, testConstructsAgentWithoutCachedConfiguration) {
+    EXPECT_CALL(*m_mockContextManager, setStateProvider(Field(&CapabilityTag::name, TEST_STATE_NAME), _)).Times(1);
+
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+    EXPECT_EQ(1, m_factoryCalls);
+    EXPECT_EQ(m_agent, m_proxy->getIfCreated());
+    EXPECT_EQ(m_agent->getConfiguration(), m_proxy->getConfiguration());
+
+    auto capabilityConfigurations = m_proxy->getCapabilityConfigurations();
+    ASSERT_EQ(1u, capabilityConfigurations.size());
+    EXPECT_EQ(TEST_NAMESPACE, (*capabilityConfigurations.begin())->interfaceName);
+    EXPECT_EQ(TEST_VERSION, (*capabilityConfigurations.begin())->version);
+}
+
+/**
+ * Tests that a cached configuration is published without constructing the agent, and that the proxy stands in for
+ * the state providers of the agent.
+ */
+TEST_F(LazyCapabilityAgentTest, testPublishesCachedConfigurationWithoutConstructingAgent) {
+    cacheConfiguration();
+
+    std::shared_ptr<StateProviderInterface> stateProvider;
+    EXPECT_CALL(*m_mockContextManager, setStateProvider(Field(&CapabilityTag::name, TEST_STATE_NAME), _))
+        .WillOnce(SaveArg<1>(&stateProvider));
+
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+    EXPECT_EQ(0, m_factoryCalls);
+    EXPECT_FALSE(m_proxy->getIfCreated());
+    EXPECT_EQ(m_proxy, stateProvider);
+    EXPECT_EQ(m_agent->getConfiguration(), m_proxy->getConfiguration());
+
+    auto capabilityConfigurations = m_proxy->getCapabilityConfigurations();
+    ASSERT_EQ(1u, capabilityConfigurations.size());
+    EXPECT_EQ(TEST_NAMESPACE, (*capabilityConfigurations.begin())->interfaceName);
+    EXPECT_EQ(TEST_VERSION, (*capabilityConfigurations.begin())->version);
+}
+
+/**
+ * Tests that an invalid cached configuration is replaced by the one the agent reports.
+ */
+TEST_F(LazyCapabilityAgentTest, testInvalidCachedConfigurationIsReplaced) {
+    cacheConfiguration();
+    ASSERT_TRUE(m_miscStorage->put("lazyCapabilityAgent", "configurations", AGENT_NAME, "{\"sdkVersion\":\"0\"}"));
+
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+    EXPECT_EQ(1, m_factoryCalls);
+    m_proxy->shutdown();
+
+    m_factoryCalls = 0;
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+    EXPECT_EQ(0, m_factoryCalls);
+}
+
+/**
+ * Tests that the first directive constructs the agent and is forwarded to it, as are the later calls for it.
+ */
+TEST_F(LazyCapabilityAgentTest, testDirectiveConstructsAgent) {
+    cacheConfiguration();
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+
+    EXPECT_FALSE(m_proxy->handleDirective(MESSAGE_ID));
+
+    EXPECT_CALL(*m_agent, onPreHandleDirective(_, NotNull())).Times(1);
+    EXPECT_CALL(*m_agent, handleDirective(MESSAGE_ID)).WillOnce(Return(true));
+    EXPECT_CALL(*m_agent, cancelDirective(MESSAGE_ID)).Times(1);
+
+    std::unique_ptr<DirectiveHandlerResultInterface> result(
+        new StrictMock<smartScreenSDKInterfaces::test::MockDirectiveHandlerResult>());
+    m_proxy->preHandleDirective(nullptr, std::move(result));
+    EXPECT_EQ(1, m_factoryCalls);
+    EXPECT_TRUE(m_proxy->handleDirective(MESSAGE_ID));
+    m_proxy->cancelDirective(MESSAGE_ID);
+    EXPECT_EQ(1, m_factoryCalls);
+}
+
+/**
+ * Tests that a state request constructs the agent and is forwarded to it.
+ */
+TEST_F(LazyCapabilityAgentTest, testProvideStateConstructsAgent) {
+    cacheConfiguration();
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+
+    std::promise<void> stateProvided;
+    EXPECT_CALL(*m_agent, provideState(TEST_STATE, STATE_REQUEST_TOKEN)).WillOnce(InvokeWithoutArgs([&stateProvided] {
+        stateProvided.set_value();
+    }));
+
+    m_proxy->provideState(TEST_STATE, STATE_REQUEST_TOKEN);
+    EXPECT_EQ(std::future_status::ready, stateProvided.get_future().wait_for(TIMEOUT));
+    EXPECT_EQ(1, m_factoryCalls);
+}
+
+/**
+ * Tests that clearing customer data constructs the agent and clears its data.
+ */
+TEST_F(LazyCapabilityAgentTest, testClearDataConstructsAgent) {
+    cacheConfiguration();
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+
+    std::promise<void> dataCleared;
+    EXPECT_CALL(*m_agent, clearData()).WillOnce(InvokeWithoutArgs([&dataCleared] { dataCleared.set_value(); }));
+
+    m_customerDataManager->clearData();
+    EXPECT_EQ(std::future_status::ready, dataCleared.get_future().wait_for(TIMEOUT));
+    EXPECT_EQ(1, m_factoryCalls);
+}
+
+/**
+ * Tests that the proxy leaves clearing customer data to a constructed agent.
+ */
+TEST_F(LazyCapabilityAgentTest, testClearDataLeftToConstructedAgent) {
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+
+    EXPECT_CALL(*m_agent, clearData()).Times(0);
+    m_customerDataManager->clearData();
+}
+
+/**
+ * Tests that shutting down the proxy prevents the agent from being constructed.
+ */
+TEST_F(LazyCapabilityAgentTest, testNoAgentAfterShutdown) {
+    cacheConfiguration();
+    m_proxy = createProxy();
+    ASSERT_TRUE(m_proxy);
+
+    m_proxy->shutdown();
+    EXPECT_FALSE(m_proxy->get());
+    EXPECT_EQ(0, m_factoryCalls);
+}
+
+}  // namespace test
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,107 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_TEST_MOCKCAPABILITYAGENT_H_
+#define ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_TEST_MOCKCAPABILITYAGENT_H_
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include <gmock/gmock.h>
+
+#include <AVSCommon/AVS/CapabilityConfiguration.h>
+#include <AVSCommon/AVS/DirectiveHandlerConfiguration.h>
+#include <AVSCommon/SDKInterfaces/CapabilityConfigurationInterface.h>
+#include <AVSCommon/SDKInterfaces/DirectiveHandlerInterface.h>
+#include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
+#include <AVSCommon/Utils/Bluetooth/BluetoothEventBus.h>
+#include <RegistrationManager/CustomerDataHandler.h>
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenClient {
+namespace test {
+
+/// Namespace of the test agent.
+static const std::string TEST_NAMESPACE = "TestInterface";
+
+/// Name of the state the test agent provides.
+static const std::string TEST_STATE_NAME = "TestState";
+
+/// The state the test agent provides.
+static const alexaClientSDK::avsCommon::avs::NamespaceAndName TEST_STATE{TEST_NAMESPACE, TEST_STATE_NAME};
+
+/// A directive handled by the test agent.
+static const alexaClientSDK::avsCommon::avs::NamespaceAndName TEST_DIRECTIVE{TEST_NAMESPACE, "TestDirective"};
+
+/// Version of the interface of the test agent.
+static const std::string TEST_VERSION = "1.2";
+
+/// Mock of a capability agent constructed through a @c LazyCapabilityAgent.
+class MockCapabilityAgent
+        : public alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::CapabilityConfigurationInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::StateProviderInterface
+        , public alexaClientSDK::avsCommon::utils::bluetooth::BluetoothEventListenerInterface
+        , public alexaClientSDK::registrationManager::CustomerDataHandler {
+public:
+    /**
+     * Constructor
+     *
+     * @param customerDataManager The manager the agent is registered with as customer data handler
+     */
+    explicit MockCapabilityAgent(
+        std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager) :
+            CustomerDataHandler{customerDataManager} {
+    }
+
+    void preHandleDirective(
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSDirective> directive,
+        std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerResultInterface> result) override {
+        onPreHandleDirective(directive, result.get());
+    }
+
+    alexaClientSDK::avsCommon::avs::DirectiveHandlerConfiguration getConfiguration() const override {
+        alexaClientSDK::avsCommon::avs::DirectiveHandlerConfiguration configuration;
+        configuration[TEST_DIRECTIVE] = alexaClientSDK::avsCommon::avs::BlockingPolicy(
+            alexaClientSDK::avsCommon::avs::BlockingPolicy::MEDIUM_AUDIO, false);
+        return configuration;
+    }
+
+    std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>>
+    getCapabilityConfigurations() override {
+        return {std::make_shared<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>(
+            "AlexaInterface", TEST_NAMESPACE, TEST_VERSION)};
+    }
+
+    MOCK_METHOD1(handleDirectiveImmediately, void(std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSDirective>));
+    MOCK_METHOD2(
+        onPreHandleDirective,
+        void(
+            std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSDirective>,
+            alexaClientSDK::avsCommon::sdkInterfaces::DirectiveHandlerResultInterface*));
+    MOCK_METHOD1(handleDirective, bool(const std::string&));
+    MOCK_METHOD1(cancelDirective, void(const std::string&));
+    MOCK_METHOD0(onDeregistered, void());
+    MOCK_METHOD2(provideState, void(const alexaClientSDK::avsCommon::avs::NamespaceAndName&, unsigned int));
+    MOCK_METHOD1(onEventFired, void(const alexaClientSDK::avsCommon::utils::bluetooth::BluetoothEvent&));
+    MOCK_METHOD0(clearData, void());
+};
+
+}  // namespace test
+}  // namespace smartScreenClient
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_APPLICATIONUTILITIES_SMARTSCREENCLIENT_TEST_MOCKCAPABILITYAGENT_H_
@@ -0,0 +1,382 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Compares the ways RenderDocument payloads are read on their way to the APL client, on a generated payload and on
+ * any payload files given.  For every payload the benchmark reports:
+ *
+ * - a full parse into a @c rapidjson::Document, the baseline of all paths,
+ * - reading the presentation token and window id, with a parse per member as before and with @c scanJsonMembers,
+ * - extracting the document, data sources and supported viewports, by parsing and serializing each section as before
+ *   and as slices found by @c scanJsonMembers,
+ *
+ * and checks that both ways of every path produce the same values.  The RapidJSON SIMD instruction set of the build,
+ * selected with the RAPIDJSON_SIMD cmake option, is part of the report, so builds can be compared.
+ *
+ * Usage: JsonScanBenchmark [--iterations N] [--size KB] [--payload file]... [--output file]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "SSSDKCommon/JsonMemberScanner.h"
+
+using namespace alexaSmartScreenSDK::sssdkCommon;
+
+/// Default number of measured iterations per path.
+static const int DEFAULT_ITERATIONS = 50;
+/// Default size of the generated payload in kilobytes.
+static const int DEFAULT_SIZE_KB = 512;
+/// Members read for the presentation token and window id.
+static const std::vector<std::string> TOKEN_MEMBERS = {"presentationToken", "windowId"};
+/// Sections passed to the APL client.
+static const std::vector<std::string> SECTION_MEMBERS = {"document", "datasources", "supportedViewports"};
+
+#if defined(RAPIDJSON_SSE42)
+/// SIMD instruction set of the build.
+static const char SIMD[] = "SSE42";
+#elif defined(RAPIDJSON_SSE2)
+/// SIMD instruction set of the build.
+static const char SIMD[] = "SSE2";
+#else
+/// SIMD instruction set of the build.
+static const char SIMD[] = "OFF";
+#endif
+
+/// Duration type used for all measurements.
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+/**
+ * Summary statistics of a series of samples.
+ */
+struct Summary {
+    double mean = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double max = 0;
+};
+
+/**
+ * Computes summary statistics.
+ *
+ * @param samples The samples, reordered by this call.
+ * @return The summary.
+ */
+static Summary summarize(std::vector<double>& samples) {
+    Summary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    double total = 0;
+    for (auto sample : samples) {
+        total += sample;
+    }
+    summary.mean = total / samples.size();
+    summary.p50 = samples[samples.size() / 2];
+    summary.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    summary.max = samples.back();
+    return summary;
+}
+
+/**
+ * Writes a summary as a JSON object.
+ *
+ * @param writer The writer.
+ * @param name The member name.
+ * @param summary The summary.
+ */
+static void writeSummary(
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer,
+    const char* name,
+    const Summary& summary) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("mean");
+    writer.Double(summary.mean);
+    writer.Key("p50");
+    writer.Double(summary.p50);
+    writer.Key("p95");
+    writer.Double(summary.p95);
+    writer.Key("max");
+    writer.Double(summary.max);
+    writer.EndObject();
+}
+
+/**
+ * Serializes a value.
+ *
+ * @param value The value.
+ * @return The compact JSON text.
+ */
+static std::string serialize(const rapidjson::Value& value) {
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    value.Accept(writer);
+    return sb.GetString();
+}
+
+/**
+ * Generates a pretty printed RenderDocument payload with a list of items, as sent for a long list of search results.
+ *
+ * @param sizeKb Approximate size of the payload in kilobytes.
+ * @return The payload.
+ */
+static std::string generatePayload(int sizeKb) {
+    rapidjson::Document payload(rapidjson::kObjectType);
+    auto& allocator = payload.GetAllocator();
+    payload.AddMember("presentationToken", "amzn1.as-tt.v1.ThirdPartySdkSpeechlet#TID#benchmark", allocator);
+    payload.AddMember("windowId", "visualWindowId", allocator);
+
+    rapidjson::Value item(rapidjson::kObjectType);
+    item.AddMember("type", "TouchWrapper", allocator);
+    item.AddMember("id", "${data.id}", allocator);
+    item.AddMember("item", rapidjson::Value(rapidjson::kObjectType).AddMember("type", "Text", allocator), allocator);
+    rapidjson::Value mainTemplate(rapidjson::kObjectType);
+    mainTemplate.AddMember(
+        "parameters", rapidjson::Value(rapidjson::kArrayType).PushBack("payload", allocator), allocator);
+    mainTemplate.AddMember("item", item, allocator);
+    rapidjson::Value document(rapidjson::kObjectType);
+    document.AddMember("type", "APL", allocator);
+    document.AddMember("version", "1.4", allocator);
+    document.AddMember("mainTemplate", mainTemplate, allocator);
+    payload.AddMember("document", document, allocator);
+
+    rapidjson::Value items(rapidjson::kArrayType);
+    rapidjson::StringBuffer sb;
+    for (int i = 0; sb.GetSize() < static_cast<size_t>(sizeKb) * 1024; i++) {
+        rapidjson::Value listItem(rapidjson::kObjectType);
+        listItem.AddMember("id", rapidjson::Value(("item-" + std::to_string(i)).c_str(), allocator).Move(), allocator);
+        listItem.AddMember(
+            "primaryText",
+            rapidjson::Value(("Result number " + std::to_string(i) + " with a \"quoted\" title").c_str(), allocator)
+                .Move(),
+            allocator);
+        listItem.AddMember("rating", 3.5 + (i % 3) * 0.5, allocator);
+        listItem.AddMember("available", i % 2 == 0, allocator);
+        items.PushBack(listItem, allocator);
+        if (i % 100 == 0) {
+            sb.Clear();
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+            items.Accept(writer);
+        }
+    }
+    rapidjson::Value datasources(rapidjson::kObjectType);
+    datasources.AddMember(
+        "payload", rapidjson::Value(rapidjson::kObjectType).AddMember("items", items, allocator), allocator);
+    payload.AddMember("datasources", datasources, allocator);
+
+    rapidjson::Value viewport(rapidjson::kObjectType);
+    viewport.AddMember("mode", "HUB", allocator);
+    viewport.AddMember("shape", "RECTANGLE", allocator);
+    payload.AddMember(
+        "supportedViewports", rapidjson::Value(rapidjson::kArrayType).PushBack(viewport, allocator), allocator);
+
+    sb.Clear();
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    payload.Accept(writer);
+    return sb.GetString();
+}
+
+/**
+ * Measures one path.
+ *
+ * @param iterations Number of iterations.
+ * @param path The path.
+ * @return The latency samples.
+ */
+template <typename Path>
+static std::vector<double> measure(int iterations, Path path) {
+    std::vector<double> samples;
+    for (int i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        path();
+        samples.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+    }
+    return samples;
+}
+
+/**
+ * Benchmarks one payload.
+ *
+ * @param name Name of the payload in the report.
+ * @param payload The payload.
+ * @param iterations Number of iterations per path.
+ * @param writer The writer.
+ * @return Whether both ways of every path produced the same values.
+ */
+static bool benchmarkPayload(
+    const std::string& name,
+    const std::string& payload,
+    int iterations,
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+    rapidjson::Document expected;
+    if (expected.Parse(payload).HasParseError() || !expected.IsObject()) {
+        std::cerr << "Skipping invalid payload: " << name << std::endl;
+        return false;
+    }
+
+    // Check that the scanned values match the parsed ones.
+    bool matches = true;
+    JsonMembers members;
+    matches &= scanJsonMembers(payload, TOKEN_MEMBERS, false, &members);
+    for (auto& member : TOKEN_MEMBERS) {
+        auto it = expected.FindMember(member);
+        bool expectedString = it != expected.MemberEnd() && it->value.IsString();
+        auto found = members.find(member);
+        bool foundString = found != members.end() && found->second.type == rapidjson::kStringType;
+        matches &= expectedString == foundString && (!expectedString || found->second.string == it->value.GetString());
+    }
+    matches &= scanJsonMembers(payload, SECTION_MEMBERS, true, &members);
+    for (auto& member : SECTION_MEMBERS) {
+        auto it = expected.FindMember(member);
+        auto found = members.find(member);
+        if ((it != expected.MemberEnd()) != (found != members.end())) {
+            matches = false;
+        } else if (found != members.end()) {
+            rapidjson::Document section;
+            matches &= !section.Parse(found->second.json).HasParseError() && section == it->value;
+        }
+    }
+    if (!matches) {
+        std::cerr << "Scanned members differ from the parsed payload: " << name << std::endl;
+    }
+
+    auto parseSamples = measure(iterations, [&payload] {
+        rapidjson::Document document;
+        document.Parse(payload);
+    });
+
+    auto tokenParseSamples = measure(iterations, [&payload] {
+        for (auto& member : TOKEN_MEMBERS) {
+            rapidjson::Document document;
+            document.Parse(payload);
+            auto it = document.FindMember(member);
+            if (it != document.MemberEnd() && it->value.IsString()) {
+                std::string value = it->value.GetString();
+            }
+        }
+    });
+
+    auto tokenScanSamples = measure(iterations, [&payload] {
+        JsonMembers members;
+        scanJsonMembers(payload, TOKEN_MEMBERS, false, &members);
+    });
+
+    auto sectionParseSamples = measure(iterations, [&payload] {
+        rapidjson::Document document;
+        document.Parse(payload);
+        for (auto& member : SECTION_MEMBERS) {
+            auto it = document.FindMember(member);
+            if (it != document.MemberEnd()) {
+                serialize(it->value);
+            }
+        }
+    });
+
+    auto sectionScanSamples = measure(iterations, [&payload] {
+        JsonMembers members;
+        scanJsonMembers(payload, SECTION_MEMBERS, true, &members);
+    });
+
+    writer.StartObject();
+    writer.Key("payload");
+    writer.String(name);
+    writer.Key("bytes");
+    writer.Uint64(payload.size());
+    writer.Key("matches");
+    writer.Bool(matches);
+    writeSummary(writer, "parseUs", summarize(parseSamples));
+    writer.Key("token");
+    writer.StartObject();
+    writeSummary(writer, "parseUs", summarize(tokenParseSamples));
+    writeSummary(writer, "scanUs", summarize(tokenScanSamples));
+    writer.EndObject();
+    writer.Key("sections");
+    writer.StartObject();
+    writeSummary(writer, "parseUs", summarize(sectionParseSamples));
+    writeSummary(writer, "scanUs", summarize(sectionScanSamples));
+    writer.EndObject();
+    writer.EndObject();
+    return matches;
+}
+
+int main(int argc, char** argv) {
+    std::string outputPath;
+    int iterations = DEFAULT_ITERATIONS;
+    int sizeKb = DEFAULT_SIZE_KB;
+    std::vector<std::string> payloadPaths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--size" && i + 1 < argc) {
+            sizeKb = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--payload" && i + 1 < argc) {
+            payloadPaths.push_back(argv[++i]);
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--iterations N] [--size KB] [--payload file]... [--output file]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("simd");
+    writer.String(SIMD);
+    writer.Key("iterations");
+    writer.Int(iterations);
+    writer.Key("results");
+    writer.StartArray();
+    bool success = benchmarkPayload("generated", generatePayload(sizeKb), iterations, writer);
+    for (auto& path : payloadPaths) {
+        std::ifstream input(path);
+        if (!input) {
+            std::cerr << "Skipping unreadable payload: " << path << std::endl;
+            success = false;
+            continue;
+        }
+        std::stringstream content;
+        content << input.rdbuf();
+        success &= benchmarkPayload(path, content.str(), iterations, writer);
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    if (outputPath.empty()) {
+        std::cout << sb.GetString() << std::endl;
+    } else {
+        std::ofstream output(outputPath);
+        output << sb.GetString() << std::endl;
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Compares the thread per timer @c alexaClientSDK::avsCommon::utils::timing::Timer with the @c WheelTimer running on a
+ * shared @c TimerWheel.  For both the benchmark reports:
+ *
+ * - cost of restarting a timer (stop followed by start), as done on every user interaction by the idle timers,
+ * - threads of the process while a number of timers are pending,
+ * - voluntary and involuntary context switches and CPU time while those timers run,
+ * - how late the timers fire.
+ *
+ * Usage: TimerWheelBenchmark [--iterations N] [--timers N] [--output file]
+ */
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <AVSCommon/Utils/Timing/Timer.h>
+
+#include "SSSDKCommon/WheelTimer.h"
+
+using namespace alexaSmartScreenSDK::sssdkCommon;
+
+/// Default number of restarts measured per timer type.
+static const int DEFAULT_ITERATIONS = 1000;
+/// Default number of concurrently pending timers.
+static const int DEFAULT_TIMERS = 100;
+/// Delay of restarted timers, long enough to never fire during the measurement.
+static const std::chrono::seconds RESTART_DELAY{10};
+/// Delays of the concurrent timers are spread evenly up to this value.
+static const std::chrono::milliseconds MAX_CONCURRENT_DELAY{500};
+/// Maximum time to wait for all concurrent timers to fire.
+static const std::chrono::seconds CONCURRENT_TIMEOUT{10};
+/// Status file listing the threads of the process.
+static const std::string PROC_STATUS_PATH = "/proc/self/status";
+/// Key of the thread count in the status file.
+static const std::string THREADS_KEY = "Threads:";
+
+/// Duration type used for all measurements.
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+/**
+ * Summary statistics of a series of samples.
+ */
+struct Summary {
+    double mean = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double max = 0;
+};
+
+/**
+ * Computes summary statistics.
+ *
+ * @param samples The samples, reordered by this call.
+ * @return The summary.
+ */
+static Summary summarize(std::vector<double>& samples) {
+    Summary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    double total = 0;
+    for (auto sample : samples) {
+        total += sample;
+    }
+    summary.mean = total / samples.size();
+    summary.p50 = samples[samples.size() / 2];
+    summary.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    summary.max = samples.back();
+    return summary;
+}
+
+/**
+ * Writes a summary as a JSON object.
+ *
+ * @param writer The writer.
+ * @param name The member name.
+ * @param summary The summary.
+ */
+static void writeSummary(
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer,
+    const char* name,
+    const Summary& summary) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("mean");
+    writer.Double(summary.mean);
+    writer.Key("p50");
+    writer.Double(summary.p50);
+    writer.Key("p95");
+    writer.Double(summary.p95);
+    writer.Key("max");
+    writer.Double(summary.max);
+    writer.EndObject();
+}
+
+/**
+ * @return The number of threads of the process, -1 where the platform does not provide it.
+ */
+static int countThreads() {
+    std::ifstream status(PROC_STATUS_PATH);
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, THREADS_KEY.size(), THREADS_KEY) == 0) {
+            return std::atoi(line.c_str() + THREADS_KEY.size());
+        }
+    }
+    return -1;
+}
+
+/**
+ * Resource usage of the process.
+ */
+struct Usage {
+    long contextSwitches = 0;
+    double cpuMs = 0;
+};
+
+/**
+ * @return The context switches and CPU time of the process so far.
+ */
+static Usage getUsage() {
+    Usage usage;
+    rusage self;
+    if (0 == getrusage(RUSAGE_SELF, &self)) {
+        usage.contextSwitches = self.ru_nvcsw + self.ru_nivcsw;
+        usage.cpuMs = (self.ru_utime.tv_sec + self.ru_stime.tv_sec) * 1000.0 +
+                      (self.ru_utime.tv_usec + self.ru_stime.tv_usec) / 1000.0;
+    }
+    return usage;
+}
+
+/**
+ * Measures one timer type.
+ *
+ * @param name Name of the timer type in the report.
+ * @param iterations Number of restarts.
+ * @param timerCount Number of concurrently pending timers.
+ * @param writer The writer.
+ * @return Whether all timers fired.
+ */
+template <typename TimerType>
+static bool benchmarkTimer(
+    const char* name,
+    int iterations,
+    int timerCount,
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+    std::vector<double> restartSamples;
+    {
+        TimerType timer;
+        for (int i = 0; i < iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            timer.stop();
+            timer.start(RESTART_DELAY, [] {});
+            restartSamples.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+        }
+        timer.stop();
+    }
+
+    std::mutex mutex;
+    std::condition_variable allFired;
+    int fired = 0;
+    std::vector<double> latenessSamples;
+    int threadsBefore = countThreads();
+    auto usageBefore = getUsage();
+    int threadsPending = -1;
+    bool completed;
+    {
+        std::vector<std::unique_ptr<TimerType>> timers;
+        auto origin = std::chrono::steady_clock::now();
+        for (int i = 0; i < timerCount; i++) {
+            auto delay = MAX_CONCURRENT_DELAY * (i + 1) / timerCount;
+            auto due = origin + delay;
+            timers.emplace_back(new TimerType);
+            timers.back()->start(delay, [&, due] {
+                auto lateness = Microseconds(std::chrono::steady_clock::now() - due).count();
+                std::lock_guard<std::mutex> lock{mutex};
+                latenessSamples.push_back(lateness);
+                if (++fired == timerCount) {
+                    allFired.notify_one();
+                }
+            });
+        }
+        threadsPending = countThreads();
+
+        std::unique_lock<std::mutex> lock{mutex};
+        completed = allFired.wait_for(lock, CONCURRENT_TIMEOUT, [&] { return fired == timerCount; });
+    }
+    auto usageAfter = getUsage();
+
+    writer.StartObject();
+    writer.Key("timer");
+    writer.String(name);
+    writeSummary(writer, "restartUs", summarize(restartSamples));
+    writer.Key("threadsBefore");
+    writer.Int(threadsBefore);
+    writer.Key("threadsWithPendingTimers");
+    writer.Int(threadsPending);
+    writer.Key("contextSwitches");
+    writer.Int64(usageAfter.contextSwitches - usageBefore.contextSwitches);
+    writer.Key("cpuMs");
+    writer.Double(usageAfter.cpuMs - usageBefore.cpuMs);
+    writer.Key("fired");
+    writer.Int(fired);
+    writeSummary(writer, "latenessUs", summarize(latenessSamples));
+    writer.EndObject();
+
+    if (!completed) {
+        std::cerr << name << ": only " << fired << " of " << timerCount << " timers fired" << std::endl;
+    }
+    return completed;
+}
+
+int main(int argc, char** argv) {
+    std::string outputPath;
+    int iterations = DEFAULT_ITERATIONS;
+    int timerCount = DEFAULT_TIMERS;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--timers" && i + 1 < argc) {
+            timerCount = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--iterations N] [--timers N] [--output file]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Start the shared wheel up front, so its thread is not counted as one of the pending timers.
+    TimerWheel::getInstance();
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("iterations");
+    writer.Int(iterations);
+    writer.Key("timers");
+    writer.Int(timerCount);
+    writer.Key("results");
+    writer.StartArray();
+    bool success = true;
+    success &= benchmarkTimer<alexaClientSDK::avsCommon::utils::timing::Timer>("Timer", iterations, timerCount, writer);
+    success &= benchmarkTimer<WheelTimer>("WheelTimer", iterations, timerCount, writer);
+    writer.EndArray();
+    writer.EndObject();
+
+    if (outputPath.empty()) {
+        std::cout << sb.GetString() << std::endl;
+    } else {
+        std::ofstream output(outputPath);
+        output << sb.GetString() << std::endl;
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_JSONMEMBERSCANNER_H_
+#define ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_JSONMEMBERSCANNER_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/// A top level member found by @c scanJsonMembers.
+struct JsonMemberValue {
+    /// Type of the value
+    rapidjson::Type type;
+
+    /// The value as it appears in the scanned text
+    std::string json;
+
+    /// The value, unescaped, if it is a string
+    std::string string;
+};
+
+/// Members found by @c scanJsonMembers, by name.
+using JsonMembers = std::unordered_map<std::string, JsonMemberValue>;
+
+/**
+ * Finds top level members of a JSON object in one pass over the text, without building a document.
+ *
+ * Large directive payloads are often parsed only to read a few small members or to pass a member on as text.  Scanning
+ * leaves the values that are not needed unallocated, returns containers as a slice of the original text rather than
+ * serializing them again, and with @c validateAll set to false stops as soon as every member is found.  Duplicate
+ * members resolve to the first one, as with @c rapidjson::Value::FindMember.
+ *
+ * @param json The JSON text
+ * @param names Names of the members to find
+ * @param validateAll Whether the whole text is parsed, so malformed text after the found members is detected
+ * @param[out] members Receives the members found, missing members are left out
+ * @return Whether the text is a JSON object, or starts with a valid object prefix holding every member if
+ * @c validateAll is false
+ */
+bool scanJsonMembers(
+    const std::string& json,
+    const std::vector<std::string>& names,
+    bool validateAll,
+    JsonMembers* members);
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_JSONMEMBERSCANNER_H_
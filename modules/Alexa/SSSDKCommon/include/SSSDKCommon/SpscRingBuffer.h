@@ -0,0 +1,164 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_SPSCRINGBUFFER_H_
+#define ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_SPSCRINGBUFFER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/**
+ * A lock free ring buffer for exactly one producer thread and one consumer thread.
+ *
+ * Neither side ever blocks or allocates, which makes the producer side safe to use from real time callbacks such as
+ * audio capture.  The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRingBuffer {
+public:
+    /**
+     * Constructor
+     *
+     * @param capacity Minimum number of elements the buffer holds
+     */
+    explicit SpscRingBuffer(size_t capacity);
+
+    /**
+     * Appends elements, called from the producer thread only.
+     *
+     * @param data The elements
+     * @param count Number of elements
+     * @return Number of elements appended, less than @c count if the buffer is full
+     */
+    size_t push(const T* data, size_t count);
+
+    /**
+     * Removes the oldest elements, called from the consumer thread only.
+     *
+     * @param[out] data Receives the elements
+     * @param count Maximum number of elements
+     * @return Number of elements removed
+     */
+    size_t pop(T* data, size_t count);
+
+    /**
+     * @return Number of elements in the buffer, exact only when called from the producer or the consumer thread
+     */
+    size_t size() const;
+
+    /**
+     * @return Number of elements the buffer holds
+     */
+    size_t capacity() const;
+
+private:
+    /**
+     * Rounds up to a power of two.
+     *
+     * @param value The value
+     * @return The smallest power of two not less than @c value, at least 1
+     */
+    static size_t roundUpToPowerOfTwo(size_t value);
+
+    /// Size of a cache line, the indices are kept on separate lines so the two threads do not contend for them.
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    /// The elements, the size is a power of two
+    std::vector<T> m_buffer;
+
+    /// Mask mapping an index to its position in @c m_buffer
+    const size_t m_mask;
+
+    /// Separates the indices from the rest of the object
+    char m_padding0[CACHE_LINE_SIZE];
+
+    /// Total number of elements pushed, only written by the producer
+    std::atomic<size_t> m_writeIndex;
+
+    /// Separates the write index from the read index
+    char m_padding1[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+    /// Total number of elements popped, only written by the consumer
+    std::atomic<size_t> m_readIndex;
+
+    /// Separates the read index from whatever follows the object
+    char m_padding2[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+};
+
+template <typename T>
+size_t SpscRingBuffer<T>::roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+template <typename T>
+SpscRingBuffer<T>::SpscRingBuffer(size_t capacity) :
+        m_buffer(roundUpToPowerOfTwo(capacity)),
+        m_mask{m_buffer.size() - 1},
+        m_writeIndex{0},
+        m_readIndex{0} {
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::push(const T* data, size_t count) {
+    auto writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    auto readIndex = m_readIndex.load(std::memory_order_acquire);
+    count = std::min(count, m_buffer.size() - (writeIndex - readIndex));
+    // The free space wraps around the end of the buffer at most once.
+    auto position = writeIndex & m_mask;
+    auto first = std::min(count, m_buffer.size() - position);
+    std::copy(data, data + first, m_buffer.begin() + position);
+    std::copy(data + first, data + count, m_buffer.begin());
+    m_writeIndex.store(writeIndex + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::pop(T* data, size_t count) {
+    auto readIndex = m_readIndex.load(std::memory_order_relaxed);
+    auto writeIndex = m_writeIndex.load(std::memory_order_acquire);
+    count = std::min(count, writeIndex - readIndex);
+    auto position = readIndex & m_mask;
+    auto first = std::min(count, m_buffer.size() - position);
+    std::copy(m_buffer.begin() + position, m_buffer.begin() + position + first, data);
+    std::copy(m_buffer.begin(), m_buffer.begin() + (count - first), data + first);
+    m_readIndex.store(readIndex + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::size() const {
+    // The read index is loaded first, as it never passes the write index.
+    auto readIndex = m_readIndex.load(std::memory_order_acquire);
+    return m_writeIndex.load(std::memory_order_acquire) - readIndex;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::capacity() const {
+    return m_buffer.size();
+}
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_SPSCRINGBUFFER_H_
@@ -16,6 +16,7 @@
 #ifndef ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_TESTMEDIAPLAYER_H_
 #define ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_TESTMEDIAPLAYER_H_
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
@@ -28,10 +29,12 @@
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/SourceConfig.h>
-#include "AVSCommon/Utils/Timing/Timer.h"
 #include <AVSCommon/Utils/RequiresShutdown.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/SDKInterfaces/Audio/EqualizerInterface.h>
 
+#include "SSSDKCommon/WheelTimer.h"
+
 namespace alexaSmartScreenSDK {
 namespace sssdkCommon {
 
@@ -114,11 +117,13 @@ private:
     /// Observer to notify of state changes.
     std::shared_ptr<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface> m_observer;
     /// Flag to indicate when a playback finished notification has been sent to the observer.
-    bool m_playbackFinished = false;
+    std::atomic_bool m_playbackFinished{false};
     /// The AttachmentReader to read audioData from.
     std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> m_attachmentReader;
+    /// Executor notifying the observer, so the timer thread shared by all timers is not held up by it.
+    alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
     /// Timer to wait to send onPlaybackFinished to the observer.
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::timing::Timer> m_timer;
+    std::shared_ptr<WheelTimer> m_timer;
     // istream for Alerts.
     std::shared_ptr<std::istream> m_istream;
 };
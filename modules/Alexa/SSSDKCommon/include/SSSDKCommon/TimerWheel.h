@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_TIMERWHEEL_H_
+#define ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_TIMERWHEEL_H_
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/**
+ * Runs the tasks of many timers on a single thread, using a hierarchical timing wheel with a resolution of one
+ * millisecond.
+ *
+ * Each of the four levels of the wheel has 256 slots, a slot of level n spans 256^n ticks.  A timer is placed into the
+ * lowest level which can hold its deadline, and the content of a higher level slot is redistributed to the lower
+ * levels when the wheel reaches it.  Scheduling and cancelling are constant time, and the thread only wakes up when a
+ * timer is due or a slot has to be redistributed.
+ *
+ * Tasks run on the thread of the wheel and must not block, long running work should be handed to an executor.
+ */
+class TimerWheel {
+public:
+    /// Identifies a scheduled timer, never 0.
+    using TimerId = uint64_t;
+
+    /// Clock used for all deadlines.
+    using Clock = std::chrono::steady_clock;
+
+    /// How the period of a periodic timer is measured.
+    enum class PeriodType {
+        /// The period starts when the previous task finished.
+        RELATIVE,
+        /// The period starts when the previous task was due, so the task runs at a fixed rate.
+        ABSOLUTE
+    };
+
+    /// Number of runs of a periodic timer which never stops by itself.
+    static const size_t FOREVER = 0;
+
+    /**
+     * @return The wheel shared by all components of the process
+     */
+    static std::shared_ptr<TimerWheel> getInstance();
+
+    /**
+     * Constructor, starts the thread of the wheel.
+     */
+    TimerWheel();
+
+    /**
+     * Destructor, drops all timers and joins the thread.  Must not be called from a task of the wheel.
+     */
+    ~TimerWheel();
+
+    /**
+     * Schedules a task.
+     *
+     * @param delay Time until the first run
+     * @param period Time between runs, zero for a one shot timer
+     * @param periodType How the period is measured
+     * @param maxCount Number of runs, @c FOREVER to run until cancelled.  Ignored for one shot timers.
+     * @param task The task
+     * @return The id of the timer
+     */
+    TimerId schedule(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task);
+
+    /**
+     * Cancels a timer.  When the task of the timer is running on the thread of the wheel, waits for it to finish
+     * unless called from the task itself.
+     *
+     * @param id The timer
+     */
+    void cancel(TimerId id);
+
+    /**
+     * @param id The timer
+     * @return Whether the timer is scheduled or its task is running
+     */
+    bool isScheduled(TimerId id) const;
+
+    /**
+     * @return Number of timers currently scheduled
+     */
+    size_t size() const;
+
+private:
+    /// Number of levels of the wheel.
+    static const int LEVELS = 4;
+
+    /// Number of bits of the slot index within a level.
+    static const int SLOT_BITS = 8;
+
+    /// Number of slots per level.
+    static const size_t SLOTS = 1 << SLOT_BITS;
+
+    /// A scheduled timer.
+    struct Entry {
+        /// The task, shared so it can run without the lock held
+        std::shared_ptr<const std::function<void()>> task;
+
+        /// Tick at which the task is due
+        uint64_t deadline;
+
+        /// Ticks between runs, zero for one shot timers
+        uint64_t period;
+
+        /// How the period is measured
+        PeriodType periodType;
+
+        /// Runs left, @c FOREVER for timers which run until cancelled
+        size_t remaining;
+    };
+
+    /// The timers of a slot.  Cancelled timers are dropped lazily when their slot is reached.
+    using Slot = std::vector<TimerId>;
+
+    /**
+     * @return The current tick
+     */
+    uint64_t now() const;
+
+    /**
+     * Places a timer into the slot holding its deadline.  Must be called with the lock held.
+     *
+     * @param id The timer
+     * @param deadline Tick at which the timer is due
+     */
+    void place(TimerId id, uint64_t deadline);
+
+    /**
+     * Finds the next tick at which a timer is due or a slot has to be redistributed.  Must be called with the lock
+     * held.
+     *
+     * @param[out] tick The next tick
+     * @return Whether any slot holds a timer
+     */
+    bool nextEventTick(uint64_t* tick) const;
+
+    /**
+     * Advances the wheel to a tick, redistributing the higher level slots reached and collecting the due timers.  Must
+     * be called with the lock held.
+     *
+     * @param tick The tick, at most the next event tick
+     * @param[out] due The timers due at the tick
+     */
+    void advance(uint64_t tick, std::vector<TimerId>* due);
+
+    /**
+     * Runs a due timer and reschedules it if it is periodic.  Called with the lock held, which is released while the
+     * task runs.
+     *
+     * @param lock The lock
+     * @param id The timer
+     */
+    void run(std::unique_lock<std::mutex>& lock, TimerId id);
+
+    /// The thread of the wheel.
+    void loop();
+
+    /// Start of the first tick
+    const Clock::time_point m_epoch;
+
+    /// The tick the wheel has advanced to
+    uint64_t m_currentTick;
+
+    /// The slots of all levels
+    std::array<std::array<Slot, SLOTS>, LEVELS> m_slots;
+
+    /// The scheduled timers
+    std::unordered_map<TimerId, Entry> m_entries;
+
+    /// Id of the next timer
+    TimerId m_nextId;
+
+    /// Id of the timer whose task is running, 0 if none
+    TimerId m_runningId;
+
+    /// Whether the wheel is shutting down
+    bool m_isShuttingDown;
+
+    /// Serializes access to the wheel
+    mutable std::mutex m_mutex;
+
+    /// Wakes the thread when a timer is scheduled or the wheel shuts down
+    std::condition_variable m_wakeTrigger;
+
+    /// Notified when a task finished
+    std::condition_variable m_taskFinished;
+
+    /// The thread of the wheel
+    std::thread m_thread;
+};
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_TIMERWHEEL_H_
@@ -0,0 +1,165 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_WHEELTIMER_H_
+#define ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_WHEELTIMER_H_
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "SSSDKCommon/TimerWheel.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/**
+ * A timer with the interface of @c alexaClientSDK::avsCommon::utils::timing::Timer whose tasks run on a shared
+ * @c TimerWheel instead of a thread of its own.
+ *
+ * Starting and stopping do not create or join threads, which makes restarting a timer cheap.  Tasks must not block,
+ * as they delay the tasks of all other timers of the wheel.
+ */
+class WheelTimer {
+public:
+    /// How the period of a periodic timer is measured.
+    using PeriodType = TimerWheel::PeriodType;
+
+    /// Number of runs of a periodic timer which never stops by itself.
+    static const size_t FOREVER = TimerWheel::FOREVER;
+
+    /**
+     * Constructor
+     *
+     * @param wheel The wheel running the task, the shared one by default
+     */
+    explicit WheelTimer(std::shared_ptr<TimerWheel> wheel = TimerWheel::getInstance());
+
+    /**
+     * Destructor, stops the timer.
+     */
+    ~WheelTimer();
+
+    /**
+     * Runs a task once after a delay.
+     *
+     * @param delay Time until the task runs
+     * @param task The task
+     * @return @c false if the timer is already active
+     */
+    template <typename Rep, typename Period>
+    bool start(const std::chrono::duration<Rep, Period>& delay, std::function<void()> task);
+
+    /**
+     * Runs a task periodically, the first run is one period from now.
+     *
+     * @param period Time between runs
+     * @param periodType How the period is measured
+     * @param maxCount Number of runs, @c FOREVER to run until stopped
+     * @param task The task
+     * @return @c false if the timer is already active
+     */
+    template <typename Rep, typename Period>
+    bool start(
+        const std::chrono::duration<Rep, Period>& period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task);
+
+    /**
+     * Runs a task periodically.
+     *
+     * @param delay Time until the first run
+     * @param period Time between runs
+     * @param periodType How the period is measured
+     * @param maxCount Number of runs, @c FOREVER to run until stopped
+     * @param task The task
+     * @return @c false if the timer is already active
+     */
+    template <typename Rep, typename Period>
+    bool start(
+        const std::chrono::duration<Rep, Period>& delay,
+        const std::chrono::duration<Rep, Period>& period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task);
+
+    /**
+     * Stops the timer.  Waits for a running task to finish unless called from the task itself.
+     */
+    void stop();
+
+    /**
+     * @return Whether the timer is started and has runs left, including while its last task is running
+     */
+    bool isActive() const;
+
+private:
+    /**
+     * Schedules the task on the wheel.
+     *
+     * @param delay Time until the first run
+     * @param period Time between runs, zero for a one shot timer
+     * @param periodType How the period is measured
+     * @param maxCount Number of runs
+     * @param task The task
+     * @return @c false if the timer is already active
+     */
+    bool schedule(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task);
+
+    /// The wheel running the task
+    const std::shared_ptr<TimerWheel> m_wheel;
+
+    /// Id of the timer on the wheel, 0 if never started
+    TimerWheel::TimerId m_id;
+
+    /// Serializes starting and stopping
+    mutable std::mutex m_mutex;
+};
+
+template <typename Rep, typename Period>
+bool WheelTimer::start(const std::chrono::duration<Rep, Period>& delay, std::function<void()> task) {
+    return schedule(delay, std::chrono::nanoseconds::zero(), PeriodType::ABSOLUTE, 1, std::move(task));
+}
+
+template <typename Rep, typename Period>
+bool WheelTimer::start(
+    const std::chrono::duration<Rep, Period>& period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    return schedule(period, period, periodType, maxCount, std::move(task));
+}
+
+template <typename Rep, typename Period>
+bool WheelTimer::start(
+    const std::chrono::duration<Rep, Period>& delay,
+    const std::chrono::duration<Rep, Period>& period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    return schedule(delay, period, periodType, maxCount, std::move(task));
+}
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SSSDKCOMMON_INCLUDE_SSSDKCOMMON_WHEELTIMER_H_
@@ -0,0 +1,298 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <rapidjson/reader.h>
+
+#include "SSSDKCommon/JsonMemberScanner.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/// Characters between the end of a member name and the start of its value.
+static const char NAME_SEPARATOR_CHARACTERS[] = " \t\n\r:";
+
+/**
+ * A read only stream over a null terminated string.  Unlike @c rapidjson::StringStream the reader does not copy it
+ * while parsing, so its position is current whenever a handler callback is made.
+ */
+class ScanStream {
+public:
+    /// Character type
+    typedef char Ch;
+
+    /**
+     * Constructor
+     *
+     * @param text The null terminated text
+     */
+    explicit ScanStream(const Ch* text) : m_current{text}, m_head{text} {
+    }
+
+    Ch Peek() const {
+        return *m_current;
+    }
+
+    Ch Take() {
+        return *m_current++;
+    }
+
+    size_t Tell() const {
+        return static_cast<size_t>(m_current - m_head);
+    }
+
+    Ch* PutBegin() {
+        return nullptr;
+    }
+
+    void Put(Ch) {
+    }
+
+    void Flush() {
+    }
+
+    size_t PutEnd(Ch*) {
+        return 0;
+    }
+
+    /// The current position
+    const Ch* m_current;
+
+private:
+    /// The start of the text
+    const Ch* m_head;
+};
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+/**
+ * Skips whitespace with the SIMD instructions RapidJSON is built with, found by the reader through argument dependent
+ * lookup in place of its generic implementation.
+ *
+ * @param stream The stream
+ */
+inline void SkipWhitespace(ScanStream& stream) {
+    stream.m_current = rapidjson::SkipWhitespace_SIMD(stream.m_current);
+}
+#endif
+
+/**
+ * Records the top level members of interest while a reader walks the text.  The position of the stream at each
+ * callback delimits the text of a value: a name ends right before its value, and a value ends where its callback is
+ * made.
+ */
+class MemberScanHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, MemberScanHandler> {
+public:
+    /**
+     * Constructor
+     *
+     * @param json The scanned text
+     * @param stream The stream the reader consumes the text from
+     * @param names Names of the members to find
+     * @param validateAll Whether the scan continues once every member is found
+     * @param members Receives the members found
+     */
+    MemberScanHandler(
+        const std::string& json,
+        const ScanStream& stream,
+        const std::vector<std::string>& names,
+        bool validateAll,
+        JsonMembers* members) :
+            m_json(json),
+            m_stream(stream),
+            m_names(names),
+            m_validateAll{validateAll},
+            m_members{members},
+            m_remaining{names.size()},
+            m_depth{0},
+            m_capturing{false},
+            m_valueStart{0},
+            m_containerType{rapidjson::kNullType},
+            m_stoppedEarly{false} {
+    }
+
+    /**
+     * @return Whether the scan stopped because every member was found
+     */
+    bool stoppedEarly() const {
+        return m_stoppedEarly;
+    }
+
+    bool Null() {
+        return onScalar(rapidjson::kNullType, nullptr, 0);
+    }
+
+    bool Bool(bool value) {
+        return onScalar(value ? rapidjson::kTrueType : rapidjson::kFalseType, nullptr, 0);
+    }
+
+    /// Called for every number.
+    bool Default() {
+        return onScalar(rapidjson::kNumberType, nullptr, 0);
+    }
+
+    bool String(const char* value, rapidjson::SizeType length, bool) {
+        return onScalar(rapidjson::kStringType, value, length);
+    }
+
+    bool StartObject() {
+        return onStart(rapidjson::kObjectType);
+    }
+
+    bool Key(const char* value, rapidjson::SizeType length, bool) {
+        if (1 == m_depth) {
+            m_name.assign(value, length);
+            m_capturing = std::find(m_names.begin(), m_names.end(), m_name) != m_names.end() &&
+                          m_members->find(m_name) == m_members->end();
+            m_valueStart = m_stream.Tell();
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        return onEnd();
+    }
+
+    bool StartArray() {
+        return onStart(rapidjson::kArrayType);
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        return onEnd();
+    }
+
+private:
+    /**
+     * Handles the start of an object or array.
+     *
+     * @param type The container type
+     * @return Whether the scan continues
+     */
+    bool onStart(rapidjson::Type type) {
+        if (0 == m_depth && type != rapidjson::kObjectType) {
+            return false;
+        }
+        if (1 == m_depth) {
+            m_containerType = type;
+        }
+        m_depth++;
+        return true;
+    }
+
+    /**
+     * Handles the end of an object or array.
+     *
+     * @return Whether the scan continues
+     */
+    bool onEnd() {
+        m_depth--;
+        return 1 != m_depth || !m_capturing || capture(m_containerType, nullptr, 0);
+    }
+
+    /**
+     * Handles a value other than an object or array.
+     *
+     * @param type The value type
+     * @param string The unescaped value of a string, @c nullptr otherwise
+     * @param length Length of @c string
+     * @return Whether the scan continues
+     */
+    bool onScalar(rapidjson::Type type, const char* string, rapidjson::SizeType length) {
+        if (0 == m_depth) {
+            return false;
+        }
+        return 1 != m_depth || !m_capturing || capture(type, string, length);
+    }
+
+    /**
+     * Records the member whose value just ended.
+     *
+     * @param type The value type
+     * @param string The unescaped value of a string, @c nullptr otherwise
+     * @param length Length of @c string
+     * @return Whether the scan continues
+     */
+    bool capture(rapidjson::Type type, const char* string, rapidjson::SizeType length) {
+        m_capturing = false;
+        auto start = m_json.find_first_not_of(NAME_SEPARATOR_CHARACTERS, m_valueStart);
+        auto& member = (*m_members)[m_name];
+        member.type = type;
+        member.json.assign(m_json, start, m_stream.Tell() - start);
+        if (string) {
+            member.string.assign(string, length);
+        }
+        if (0 == --m_remaining && !m_validateAll) {
+            m_stoppedEarly = true;
+            return false;
+        }
+        return true;
+    }
+
+    /// The scanned text
+    const std::string& m_json;
+
+    /// The stream the reader consumes the text from
+    const ScanStream& m_stream;
+
+    /// Names of the members to find
+    const std::vector<std::string>& m_names;
+
+    /// Whether the scan continues once every member is found
+    const bool m_validateAll;
+
+    /// Receives the members found
+    JsonMembers* m_members;
+
+    /// Number of members not found yet
+    size_t m_remaining;
+
+    /// Nesting depth, 1 within the top level object
+    int m_depth;
+
+    /// Name of the current top level member
+    std::string m_name;
+
+    /// Whether the value of the current top level member is recorded
+    bool m_capturing;
+
+    /// Offset of the end of the current top level member name
+    size_t m_valueStart;
+
+    /// Type of the current top level container value
+    rapidjson::Type m_containerType;
+
+    /// Whether the scan stopped because every member was found
+    bool m_stoppedEarly;
+};
+
+bool scanJsonMembers(
+    const std::string& json,
+    const std::vector<std::string>& names,
+    bool validateAll,
+    JsonMembers* members) {
+    if (!members) {
+        return false;
+    }
+    members->clear();
+
+    ScanStream stream(json.c_str());
+    MemberScanHandler handler(json, stream, names, validateAll, members);
+    rapidjson::Reader reader;
+    auto result = reader.Parse(stream, handler);
+    return !result.IsError() || (result.Code() == rapidjson::kParseErrorTermination && handler.stoppedEarly());
+}
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
@@ -81,13 +81,15 @@ bool TestMediaPlayer::play(avsCommon::utils::mediaPlayer::MediaPlayerInterface::
     if (m_observer) {
         m_observer->onPlaybackStarted(id, avsCommon::utils::mediaPlayer::MediaPlayerState());
         m_playbackFinished = true;
-        m_timer = std::unique_ptr<avsCommon::utils::timing::Timer>(new avsCommon::utils::timing::Timer);
-        // Wait 600 milliseconds before sending onPlaybackFinished.
+        m_timer = std::make_shared<WheelTimer>();
+        // Wait 3 seconds before sending onPlaybackFinished.
         m_timer->start(std::chrono::milliseconds(3000), [this, id] {
-            if (m_playbackFinished) {
-                m_observer->onPlaybackFinished(id, avsCommon::utils::mediaPlayer::MediaPlayerState());
-                m_playbackFinished = false;
-            }
+            m_executor.submit([this, id] {
+                if (m_playbackFinished) {
+                    m_observer->onPlaybackFinished(id, avsCommon::utils::mediaPlayer::MediaPlayerState());
+                    m_playbackFinished = false;
+                }
+            });
         });
         return true;
     } else {
@@ -124,6 +126,10 @@ uint64_t TestMediaPlayer::getNumBytesBuffered() {
 }
 
 void TestMediaPlayer::doShutdown() {
+    if (m_timer) {
+        m_timer->stop();
+    }
+    m_executor.shutdown();
 }
 
 alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>
@@ -0,0 +1,268 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "SSSDKCommon/TimerWheel.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerWheel");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Duration of a tick of the wheel.
+static const std::chrono::milliseconds TICK{1};
+
+/**
+ * Converts a duration to ticks, rounding up so a timer never fires early.
+ *
+ * @param duration The duration
+ * @return The number of ticks
+ */
+static uint64_t toTicks(std::chrono::nanoseconds duration) {
+    if (duration.count() <= 0) {
+        return 0;
+    }
+    auto tick = std::chrono::duration_cast<std::chrono::nanoseconds>(TICK).count();
+    return static_cast<uint64_t>((duration.count() + tick - 1) / tick);
+}
+
+std::shared_ptr<TimerWheel> TimerWheel::getInstance() {
+    static std::shared_ptr<TimerWheel> instance = std::make_shared<TimerWheel>();
+    return instance;
+}
+
+TimerWheel::TimerWheel() :
+        m_epoch{Clock::now()},
+        m_currentTick{0},
+        m_nextId{1},
+        m_runningId{0},
+        m_isShuttingDown{false} {
+    m_thread = std::thread(&TimerWheel::loop, this);
+}
+
+TimerWheel::~TimerWheel() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShuttingDown = true;
+        m_entries.clear();
+    }
+    m_wakeTrigger.notify_one();
+    if (!m_thread.joinable()) {
+        return;
+    }
+    if (std::this_thread::get_id() == m_thread.get_id()) {
+        // Destroying the wheel from one of its tasks is not supported, detaching at least avoids a deadlock.
+        ACSDK_ERROR(LX("destructorFailed").d("reason", "calledFromTask"));
+        m_thread.detach();
+    } else {
+        m_thread.join();
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    if (!task) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "nullTask"));
+        return 0;
+    }
+
+    auto periodTicks = toTicks(period);
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_isShuttingDown) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "shuttingDown"));
+        return 0;
+    }
+    auto id = m_nextId++;
+    // A delay is counted from the start of the next tick, the current one has partly elapsed already.
+    auto deadline = now() + toTicks(delay) + (delay.count() > 0 ? 1 : 0);
+    m_entries[id] = {std::make_shared<const std::function<void()>>(std::move(task)),
+                     deadline,
+                     periodTicks,
+                     periodType,
+                     periodTicks > 0 ? maxCount : 1};
+    place(id, deadline);
+    lock.unlock();
+
+    m_wakeTrigger.notify_one();
+    return id;
+}
+
+void TimerWheel::cancel(TimerId id) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_entries.erase(id);
+    if (m_runningId == id && std::this_thread::get_id() != m_thread.get_id()) {
+        m_taskFinished.wait(lock, [this, id]() { return m_runningId != id; });
+    }
+}
+
+bool TimerWheel::isScheduled(TimerId id) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_entries.find(id) != m_entries.end();
+}
+
+size_t TimerWheel::size() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_entries.size();
+}
+
+uint64_t TimerWheel::now() const {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - m_epoch).count());
+}
+
+void TimerWheel::place(TimerId id, uint64_t deadline) {
+    deadline = std::max(deadline, m_currentTick);
+    for (int level = 0; level < LEVELS; level++) {
+        auto shift = level * SLOT_BITS;
+        if ((deadline >> shift) - (m_currentTick >> shift) < SLOTS) {
+            m_slots[level][(deadline >> shift) & (SLOTS - 1)].push_back(id);
+            return;
+        }
+    }
+    // Beyond the span of the wheel, park the timer in the last slot of the top level.  It is placed again with its
+    // real deadline when that slot is redistributed.
+    auto shift = (LEVELS - 1) * SLOT_BITS;
+    m_slots[LEVELS - 1][((m_currentTick >> shift) + SLOTS - 1) & (SLOTS - 1)].push_back(id);
+}
+
+bool TimerWheel::nextEventTick(uint64_t* tick) const {
+    bool found = false;
+    for (size_t distance = 0; distance < SLOTS; distance++) {
+        if (!m_slots[0][(m_currentTick + distance) & (SLOTS - 1)].empty()) {
+            *tick = m_currentTick + distance;
+            found = true;
+            break;
+        }
+    }
+    for (int level = 1; level < LEVELS; level++) {
+        auto shift = level * SLOT_BITS;
+        auto current = m_currentTick >> shift;
+        // The slot of the current position was redistributed already, so a non empty slot is at least one ahead.
+        for (size_t distance = 1; distance <= SLOTS; distance++) {
+            if (!m_slots[level][(current + distance) & (SLOTS - 1)].empty()) {
+                auto candidate = (current + distance) << shift;
+                if (!found || candidate < *tick) {
+                    *tick = candidate;
+                    found = true;
+                }
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+void TimerWheel::advance(uint64_t tick, std::vector<TimerId>* due) {
+    m_currentTick = tick;
+    for (int level = LEVELS - 1; level > 0; level--) {
+        auto shift = level * SLOT_BITS;
+        if (tick & ((uint64_t{1} << shift) - 1)) {
+            continue;
+        }
+        Slot slot;
+        slot.swap(m_slots[level][(tick >> shift) & (SLOTS - 1)]);
+        for (auto id : slot) {
+            auto it = m_entries.find(id);
+            if (it != m_entries.end()) {
+                place(id, it->second.deadline);
+            }
+        }
+    }
+
+    Slot slot;
+    slot.swap(m_slots[0][tick & (SLOTS - 1)]);
+    for (auto id : slot) {
+        if (m_entries.find(id) != m_entries.end()) {
+            due->push_back(id);
+        }
+    }
+}
+
+void TimerWheel::run(std::unique_lock<std::mutex>& lock, TimerId id) {
+    auto it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        // Cancelled by a task which ran earlier in the same tick.
+        return;
+    }
+    auto task = it->second.task;
+
+    m_runningId = id;
+    lock.unlock();
+    (*task)();
+    lock.lock();
+    m_runningId = 0;
+    m_taskFinished.notify_all();
+
+    it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        return;
+    }
+    auto& entry = it->second;
+    if (0 == entry.period || (FOREVER != entry.remaining && 0 == --entry.remaining)) {
+        m_entries.erase(it);
+        return;
+    }
+    auto nowTick = now();
+    if (PeriodType::RELATIVE == entry.periodType) {
+        entry.deadline = nowTick + entry.period;
+    } else {
+        // Runs missed while the wheel was late are skipped rather than run back to back.
+        entry.deadline = std::max(entry.deadline + entry.period, nowTick);
+    }
+    place(id, entry.deadline);
+}
+
+void TimerWheel::loop() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    std::vector<TimerId> due;
+    while (!m_isShuttingDown) {
+        uint64_t tick;
+        if (!nextEventTick(&tick)) {
+            m_currentTick = std::max(m_currentTick, now());
+            m_wakeTrigger.wait(lock);
+            continue;
+        }
+        if (tick > now()) {
+            m_wakeTrigger.wait_until(lock, m_epoch + tick * TICK);
+            continue;
+        }
+
+        due.clear();
+        advance(tick, &due);
+        for (auto id : due) {
+            if (m_isShuttingDown) {
+                break;
+            }
+            run(lock, id);
+        }
+    }
+}
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,82 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "SSSDKCommon/WheelTimer.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("WheelTimer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+WheelTimer::WheelTimer(std::shared_ptr<TimerWheel> wheel) : m_wheel{std::move(wheel)}, m_id{0} {
+}
+
+WheelTimer::~WheelTimer() {
+    stop();
+}
+
+bool WheelTimer::schedule(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    if (!m_wheel) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "nullWheel"));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_id != 0 && m_wheel->isScheduled(m_id)) {
+        return false;
+    }
+    auto id = m_wheel->schedule(delay, period, periodType, maxCount, std::move(task));
+    if (0 == id) {
+        return false;
+    }
+    m_id = id;
+    return true;
+}
+
+void WheelTimer::stop() {
+    TimerWheel::TimerId id;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        id = m_id;
+        m_id = 0;
+    }
+    // Cancelled outside the lock, so a running task may query the timer while stop waits for it.
+    if (id != 0 && m_wheel) {
+        m_wheel->cancel(id);
+    }
+}
+
+bool WheelTimer::isActive() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_id != 0 && m_wheel->isScheduled(m_id);
+}
+
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
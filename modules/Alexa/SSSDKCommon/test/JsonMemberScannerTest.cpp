@@ -0,0 +1,168 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "SSSDKCommon/JsonMemberScanner.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+namespace test {
+
+/// A payload whose top level members are followed by a large container, as in a RenderDocument directive.
+static const std::string PAYLOAD = R"({"presentationToken":"token","windowId":"main",)"
+                                   R"("document":{"type":"APL","mainTemplate":{"items":[1,2,3]}}})";
+
+/// A payload cut off within its last member.
+static const std::string TRUNCATED_PAYLOAD = R"({"presentationToken":"token","document":{"type":"AP)";
+
+/**
+ * Test that members are found with their type, text and unescaped string value, and missing members are left out.
+ */
+TEST(JsonMemberScannerTest, test_findsRequestedMembers) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(PAYLOAD, {"presentationToken", "document", "missing"}, true, &members));
+
+    ASSERT_EQ(2u, members.size());
+    EXPECT_EQ(rapidjson::kStringType, members["presentationToken"].type);
+    EXPECT_EQ("\"token\"", members["presentationToken"].json);
+    EXPECT_EQ("token", members["presentationToken"].string);
+    EXPECT_EQ(rapidjson::kObjectType, members["document"].type);
+    EXPECT_EQ(R"({"type":"APL","mainTemplate":{"items":[1,2,3]}})", members["document"].json);
+    EXPECT_EQ(members.end(), members.find("missing"));
+}
+
+/**
+ * Test that the first of duplicate members is found, as with @c rapidjson::Value::FindMember.
+ */
+TEST(JsonMemberScannerTest, test_firstDuplicateMemberWins) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(R"({"a":"first","b":0,"a":"second"})", {"a"}, true, &members));
+    EXPECT_EQ("first", members["a"].string);
+
+    ASSERT_TRUE(scanJsonMembers(R"({"a":{"x":1},"a":[2]})", {"a"}, false, &members));
+    EXPECT_EQ(rapidjson::kObjectType, members["a"].type);
+    EXPECT_EQ(R"({"x":1})", members["a"].json);
+}
+
+/**
+ * Test that members of nested objects are not mistaken for top level members.
+ */
+TEST(JsonMemberScannerTest, test_nestedMembersAreIgnored) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(R"({"outer":{"a":1,"list":[{"a":2}]},"a":3})", {"a"}, true, &members));
+    EXPECT_EQ("3", members["a"].json);
+}
+
+/**
+ * Test that text other than an object fails the scan.
+ */
+TEST(JsonMemberScannerTest, test_nonObjectTopLevelFails) {
+    JsonMembers members;
+    EXPECT_FALSE(scanJsonMembers(R"([{"a":1}])", {"a"}, true, &members));
+    EXPECT_FALSE(scanJsonMembers(R"("a")", {"a"}, true, &members));
+    EXPECT_FALSE(scanJsonMembers("1", {"a"}, true, &members));
+    EXPECT_FALSE(scanJsonMembers("null", {"a"}, false, &members));
+    EXPECT_FALSE(scanJsonMembers("", {"a"}, false, &members));
+    EXPECT_TRUE(members.empty());
+}
+
+/**
+ * Test that escaped strings keep their escapes in the text of the value, are unescaped in the string value, and that
+ * escaped member names match their unescaped name.
+ */
+TEST(JsonMemberScannerTest, test_escapedStrings) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(
+        R"({"a":"quote\" backslash\\ brace} \u0041","t\u006fken":"v\"}","b":1})", {"a", "token"}, true, &members));
+
+    EXPECT_EQ(R"("quote\" backslash\\ brace} \u0041")", members["a"].json);
+    EXPECT_EQ(R"(quote" backslash\ brace} A)", members["a"].string);
+    EXPECT_EQ(R"("v\"}")", members["token"].json);
+    EXPECT_EQ(R"(v"})", members["token"].string);
+}
+
+/**
+ * Test the text of numbers, literals and containers as the last member, where it is followed by the end of the
+ * object rather than a separator.
+ */
+TEST(JsonMemberScannerTest, test_valuesAsLastMember) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(R"({"n":-1.5e3})", {"n"}, true, &members));
+    EXPECT_EQ(rapidjson::kNumberType, members["n"].type);
+    EXPECT_EQ("-1.5e3", members["n"].json);
+
+    ASSERT_TRUE(scanJsonMembers("{ \"n\" :\n 42 \n}", {"n"}, true, &members));
+    EXPECT_EQ("42", members["n"].json);
+
+    ASSERT_TRUE(scanJsonMembers(R"({"t":true,"f":false,"z":null})", {"t", "f", "z"}, true, &members));
+    EXPECT_EQ(rapidjson::kTrueType, members["t"].type);
+    EXPECT_EQ(rapidjson::kFalseType, members["f"].type);
+    EXPECT_EQ(rapidjson::kNullType, members["z"].type);
+    EXPECT_EQ("null", members["z"].json);
+
+    ASSERT_TRUE(scanJsonMembers(R"({"o":{"x":[1,{"y":"}"}]} })", {"o"}, true, &members));
+    EXPECT_EQ(rapidjson::kObjectType, members["o"].type);
+    EXPECT_EQ(R"({"x":[1,{"y":"}"}]})", members["o"].json);
+
+    ASSERT_TRUE(scanJsonMembers(R"({"l":[[],{}]})", {"l"}, true, &members));
+    EXPECT_EQ(rapidjson::kArrayType, members["l"].type);
+    EXPECT_EQ("[[],{}]", members["l"].json);
+}
+
+/**
+ * Test that without full validation the scan stops once every member is found, so malformed text after them is not
+ * detected, while a full validation detects it.
+ */
+TEST(JsonMemberScannerTest, test_earlyStopSkipsMalformedTail) {
+    const std::string payload = R"({"presentationToken":"token","document":{"type":"APL",,]})";
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(payload, {"presentationToken"}, false, &members));
+    EXPECT_EQ("token", members["presentationToken"].string);
+
+    EXPECT_FALSE(scanJsonMembers(payload, {"presentationToken"}, true, &members));
+}
+
+/**
+ * Test that a truncated payload is accepted without full validation only if every member precedes the cut.
+ */
+TEST(JsonMemberScannerTest, test_earlyStopOnTruncatedTail) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(TRUNCATED_PAYLOAD, {"presentationToken"}, false, &members));
+    EXPECT_EQ("token", members["presentationToken"].string);
+
+    EXPECT_FALSE(scanJsonMembers(TRUNCATED_PAYLOAD, {"presentationToken"}, true, &members));
+    EXPECT_FALSE(scanJsonMembers(TRUNCATED_PAYLOAD, {"presentationToken", "windowId"}, false, &members));
+    EXPECT_FALSE(scanJsonMembers(TRUNCATED_PAYLOAD, {"document"}, false, &members));
+}
+
+/**
+ * Test that the members of a previous scan are cleared, and that the scan fails without a map for the members.
+ */
+TEST(JsonMemberScannerTest, test_membersAreReset) {
+    JsonMembers members;
+    ASSERT_TRUE(scanJsonMembers(PAYLOAD, {"windowId"}, false, &members));
+    ASSERT_TRUE(scanJsonMembers(PAYLOAD, {"presentationToken"}, false, &members));
+    EXPECT_EQ(1u, members.size());
+    EXPECT_EQ(members.end(), members.find("windowId"));
+
+    EXPECT_FALSE(scanJsonMembers(PAYLOAD, {"presentationToken"}, false, nullptr));
+}
+
+}  // namespace test
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
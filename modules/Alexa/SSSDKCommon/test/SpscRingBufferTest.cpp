@@ -0,0 +1,178 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "SSSDKCommon/SpscRingBuffer.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+namespace test {
+
+/// Capacity of the buffers under test, a power of two.
+static const size_t CAPACITY = 8;
+
+/// Number of elements the producer thread hands to the consumer thread.
+static const size_t TRANSFER_COUNT = 100000;
+
+/// Maximum number of elements pushed or popped at once by the producer and consumer threads.
+static const size_t MAX_CHUNK = 5;
+
+/**
+ * Test that the capacity is rounded up to a power of two, at least 1.
+ */
+TEST(SpscRingBufferTest, testCapacityIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(1u, SpscRingBuffer<int>(0).capacity());
+    EXPECT_EQ(1u, SpscRingBuffer<int>(1).capacity());
+    EXPECT_EQ(8u, SpscRingBuffer<int>(5).capacity());
+    EXPECT_EQ(8u, SpscRingBuffer<int>(8).capacity());
+    EXPECT_EQ(16u, SpscRingBuffer<int>(9).capacity());
+}
+
+/**
+ * Test that nothing can be popped from an empty buffer.
+ */
+TEST(SpscRingBufferTest, testPopFromEmptyBuffer) {
+    SpscRingBuffer<int> ring(CAPACITY);
+    int value = -1;
+    EXPECT_EQ(0u, ring.size());
+    EXPECT_EQ(0u, ring.pop(&value, 1));
+    EXPECT_EQ(-1, value);
+}
+
+/**
+ * Test that a push to a buffer with less free space than requested appends what fits, and nothing once it is full.
+ */
+TEST(SpscRingBufferTest, testPushToFullBuffer) {
+    SpscRingBuffer<int> ring(CAPACITY);
+    std::vector<int> input(CAPACITY + 3);
+    for (size_t index = 0; index < input.size(); index++) {
+        input[index] = static_cast<int>(index);
+    }
+
+    EXPECT_EQ(CAPACITY, ring.push(input.data(), input.size()));
+    EXPECT_EQ(CAPACITY, ring.size());
+    EXPECT_EQ(0u, ring.push(input.data(), 1));
+
+    std::vector<int> output(input.size(), -1);
+    EXPECT_EQ(CAPACITY, ring.pop(output.data(), output.size()));
+    EXPECT_EQ(std::vector<int>(input.begin(), input.begin() + CAPACITY),
+              std::vector<int>(output.begin(), output.begin() + CAPACITY));
+    EXPECT_EQ(0u, ring.size());
+}
+
+/**
+ * Test that elements pushed and popped across the end of the buffer keep their order.
+ */
+TEST(SpscRingBufferTest, testPushAndPopWrapAround) {
+    SpscRingBuffer<int> ring(CAPACITY);
+    int next = 0;
+    int expected = 0;
+    // Chunks of a size prime to the capacity start at every position of the buffer.
+    const size_t chunk = 3;
+    for (size_t round = 0; round < CAPACITY * 4; round++) {
+        std::vector<int> input(chunk);
+        for (auto& value : input) {
+            value = next++;
+        }
+        ASSERT_EQ(chunk, ring.push(input.data(), input.size()));
+
+        std::vector<int> output(chunk, -1);
+        ASSERT_EQ(chunk, ring.pop(output.data(), output.size()));
+        for (auto value : output) {
+            EXPECT_EQ(expected++, value);
+        }
+        EXPECT_EQ(0u, ring.size());
+    }
+}
+
+/**
+ * Test that a buffer filled across its end is popped in order, first in part and then through the end.
+ */
+TEST(SpscRingBufferTest, testPartialPopOfWrappedContent) {
+    SpscRingBuffer<int> ring(CAPACITY);
+    std::vector<int> input(CAPACITY);
+    for (size_t index = 0; index < input.size(); index++) {
+        input[index] = static_cast<int>(index);
+    }
+    std::vector<int> output(CAPACITY, -1);
+
+    // Moves the indices to the middle of the buffer, so the next fill wraps around its end.
+    ASSERT_EQ(CAPACITY / 2, ring.push(input.data(), CAPACITY / 2));
+    ASSERT_EQ(CAPACITY / 2, ring.pop(output.data(), CAPACITY / 2));
+
+    ASSERT_EQ(CAPACITY, ring.push(input.data(), input.size()));
+    EXPECT_EQ(CAPACITY, ring.size());
+    ASSERT_EQ(1u, ring.pop(output.data(), 1));
+    EXPECT_EQ(0, output[0]);
+    ASSERT_EQ(CAPACITY - 1, ring.pop(output.data() + 1, CAPACITY));
+    EXPECT_EQ(input, output);
+    EXPECT_EQ(0u, ring.size());
+}
+
+/**
+ * Test that every element a producer thread pushes reaches a consumer thread once and in order.
+ */
+TEST(SpscRingBufferTest, testProducerAndConsumerThreads) {
+    SpscRingBuffer<size_t> ring(CAPACITY);
+
+    std::thread producer([&ring] {
+        size_t next = 0;
+        size_t chunk = 1;
+        std::vector<size_t> input(MAX_CHUNK);
+        while (next < TRANSFER_COUNT) {
+            auto count = std::min(chunk, TRANSFER_COUNT - next);
+            for (size_t index = 0; index < count; index++) {
+                input[index] = next + index;
+            }
+            auto pushed = ring.push(input.data(), count);
+            if (0 == pushed) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+            chunk = chunk % MAX_CHUNK + 1;
+        }
+    });
+
+    size_t expected = 0;
+    size_t mismatches = 0;
+    size_t chunk = 1;
+    std::vector<size_t> output(MAX_CHUNK);
+    while (expected < TRANSFER_COUNT) {
+        auto count = ring.pop(output.data(), chunk);
+        EXPECT_LE(count, chunk);
+        if (0 == count) {
+            std::this_thread::yield();
+        }
+        for (size_t index = 0; index < count; index++) {
+            if (output[index] != expected++) {
+                mismatches++;
+            }
+        }
+        chunk = chunk % MAX_CHUNK + 1;
+    }
+    producer.join();
+
+    EXPECT_EQ(0u, mismatches);
+    EXPECT_EQ(0u, ring.size());
+}
+
+}  // namespace test
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,304 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "SSSDKCommon/TimerWheel.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+namespace test {
+
+using Clock = TimerWheel::Clock;
+
+/// Time to wait for timers expected to fire.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// Period of the periodic timers.
+static const std::chrono::milliseconds PERIOD{50};
+
+/// Time a task of a periodic timer runs for, which only delays the next run of a relative timer.
+static const std::chrono::milliseconds TASK_DURATION{20};
+
+/// Number of runs of the periodic timers.
+static const size_t PERIODIC_RUNS = 6;
+
+/// Number of ticks a slot of the lowest level spans, one millisecond each.
+static const int LEVEL_ZERO_SPAN_MS = 256;
+
+/// Records when the tasks of timers ran.
+class RunRecorder {
+public:
+    /**
+     * Records a run.
+     *
+     * @param index Index of the timer
+     */
+    void record(size_t index) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_runs.push_back({index, Clock::now()});
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Waits for a number of runs.
+     *
+     * @param count Number of runs
+     * @return Whether @c count runs were recorded in time
+     */
+    bool waitForRuns(size_t count) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        return m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, count] { return m_runs.size() >= count; });
+    }
+
+    /**
+     * @return The runs, as the index of the timer and the time of the run, in order
+     */
+    std::vector<std::pair<size_t, Clock::time_point>> getRuns() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_runs;
+    }
+
+private:
+    /// Serializes access to @c m_runs.
+    std::mutex m_mutex;
+
+    /// Notified when a run is recorded.
+    std::condition_variable m_wakeTrigger;
+
+    /// The runs.
+    std::vector<std::pair<size_t, Clock::time_point>> m_runs;
+};
+
+class TimerWheelTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+protected:
+    /**
+     * Runs a periodic timer whose task takes @c TASK_DURATION to complete.
+     *
+     * @param periodType How the period is measured
+     * @return Average time between the starts of consecutive runs
+     */
+    std::chrono::milliseconds runPeriodicTimer(TimerWheel::PeriodType periodType);
+
+    /// The wheel under test.
+    std::shared_ptr<TimerWheel> m_wheel;
+
+    /// Records the runs.
+    RunRecorder m_recorder;
+};
+
+void TimerWheelTest::SetUp() {
+    m_wheel = std::make_shared<TimerWheel>();
+}
+
+std::chrono::milliseconds TimerWheelTest::runPeriodicTimer(TimerWheel::PeriodType periodType) {
+    auto id = m_wheel->schedule(PERIOD, PERIOD, periodType, PERIODIC_RUNS, [this] {
+        m_recorder.record(0);
+        std::this_thread::sleep_for(TASK_DURATION);
+    });
+    EXPECT_NE(0u, id);
+    EXPECT_TRUE(m_recorder.waitForRuns(PERIODIC_RUNS));
+
+    // A timer which ran the number of times it was scheduled for is dropped.
+    auto deadline = Clock::now() + WAIT_TIMEOUT;
+    while (m_wheel->isScheduled(id) && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_FALSE(m_wheel->isScheduled(id));
+
+    auto runs = m_recorder.getRuns();
+    EXPECT_EQ(PERIODIC_RUNS, runs.size());
+    if (runs.size() < 2) {
+        return std::chrono::milliseconds::zero();
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(runs.back().second - runs.front().second) /
+           (runs.size() - 1);
+}
+
+/**
+ * Test that timers due beyond the lowest level are redistributed to it and run in the order of their deadlines, none
+ * before its deadline.
+ */
+TEST_F(TimerWheelTest, testTimersOfHigherLevelsCascade) {
+    std::vector<std::chrono::milliseconds> delays{std::chrono::milliseconds(LEVEL_ZERO_SPAN_MS * 3 + 10),
+                                                  std::chrono::milliseconds(5),
+                                                  std::chrono::milliseconds(LEVEL_ZERO_SPAN_MS + 1),
+                                                  std::chrono::milliseconds(LEVEL_ZERO_SPAN_MS - 1),
+                                                  std::chrono::milliseconds(LEVEL_ZERO_SPAN_MS * 2)};
+    auto start = Clock::now();
+    for (size_t index = 0; index < delays.size(); index++) {
+        EXPECT_NE(
+            0u,
+            m_wheel->schedule(
+                delays[index],
+                std::chrono::nanoseconds::zero(),
+                TimerWheel::PeriodType::ABSOLUTE,
+                1,
+                [this, index] { m_recorder.record(index); }));
+    }
+
+    ASSERT_TRUE(m_recorder.waitForRuns(delays.size()));
+    auto runs = m_recorder.getRuns();
+    ASSERT_EQ(delays.size(), runs.size());
+    std::vector<size_t> expectedOrder{1, 3, 2, 4, 0};
+    for (size_t position = 0; position < runs.size(); position++) {
+        EXPECT_EQ(expectedOrder[position], runs[position].first);
+        EXPECT_GE(runs[position].second - start, delays[runs[position].first]);
+    }
+}
+
+/**
+ * Test that timers whose deadlines wrap around the end of the lowest level run in the order of their deadlines.
+ */
+TEST_F(TimerWheelTest, testTimersWrappingAroundTheLowestLevel) {
+    // Deadlines spread over more than a full turn of the lowest level, so some of them wrap around wherever it is.
+    const int step = 7;
+    std::vector<std::chrono::milliseconds> delays;
+    for (int delay = 1; delay < LEVEL_ZERO_SPAN_MS + step * 4; delay += step) {
+        delays.push_back(std::chrono::milliseconds(delay));
+    }
+    auto start = Clock::now();
+    for (size_t index = 0; index < delays.size(); index++) {
+        m_wheel->schedule(
+            delays[index],
+            std::chrono::nanoseconds::zero(),
+            TimerWheel::PeriodType::ABSOLUTE,
+            1,
+            [this, index] { m_recorder.record(index); });
+    }
+
+    ASSERT_TRUE(m_recorder.waitForRuns(delays.size()));
+    auto runs = m_recorder.getRuns();
+    ASSERT_EQ(delays.size(), runs.size());
+    for (size_t position = 0; position < runs.size(); position++) {
+        EXPECT_EQ(position, runs[position].first);
+        EXPECT_GE(runs[position].second - start, delays[position]);
+    }
+}
+
+/**
+ * Test that cancelling a timer while its task runs waits for the task to finish, and that the timer does not run
+ * again.
+ */
+TEST_F(TimerWheelTest, testCancelWhileTaskRunsWaitsForIt) {
+    std::promise<void> taskStarted;
+    std::promise<void> releaseTask;
+    auto releaseTaskFuture = releaseTask.get_future().share();
+    std::atomic<int> runs{0};
+    std::atomic<bool> taskFinished{false};
+    auto id = m_wheel->schedule(
+        std::chrono::milliseconds(1),
+        std::chrono::milliseconds(1),
+        TimerWheel::PeriodType::ABSOLUTE,
+        TimerWheel::FOREVER,
+        [&] {
+            if (1 == ++runs) {
+                taskStarted.set_value();
+                releaseTaskFuture.wait();
+                std::this_thread::sleep_for(TASK_DURATION);
+                taskFinished = true;
+            }
+        });
+    ASSERT_EQ(std::future_status::ready, taskStarted.get_future().wait_for(WAIT_TIMEOUT));
+
+    auto cancelled = std::async(std::launch::async, [this, id] { m_wheel->cancel(id); });
+    EXPECT_EQ(std::future_status::timeout, cancelled.wait_for(TASK_DURATION));
+
+    releaseTask.set_value();
+    ASSERT_EQ(std::future_status::ready, cancelled.wait_for(WAIT_TIMEOUT));
+    EXPECT_TRUE(taskFinished);
+    EXPECT_FALSE(m_wheel->isScheduled(id));
+
+    std::this_thread::sleep_for(PERIOD);
+    EXPECT_EQ(1, runs);
+}
+
+/**
+ * Test that a task may cancel its own timer without waiting for itself, and is not run again.
+ */
+TEST_F(TimerWheelTest, testCancelFromOwnTask) {
+    std::atomic<int> runs{0};
+    std::promise<void> cancelled;
+    auto id = std::make_shared<std::atomic<TimerWheel::TimerId>>(0);
+    *id = m_wheel->schedule(
+        std::chrono::milliseconds(1),
+        std::chrono::milliseconds(1),
+        TimerWheel::PeriodType::ABSOLUTE,
+        TimerWheel::FOREVER,
+        [&, id] {
+            if (1 == ++runs) {
+                while (0 == *id) {
+                    std::this_thread::yield();
+                }
+                m_wheel->cancel(*id);
+                cancelled.set_value();
+            }
+        });
+
+    ASSERT_EQ(std::future_status::ready, cancelled.get_future().wait_for(WAIT_TIMEOUT));
+    std::this_thread::sleep_for(PERIOD);
+    EXPECT_EQ(1, runs);
+    EXPECT_FALSE(m_wheel->isScheduled(*id));
+}
+
+/**
+ * Test that the period of an absolute timer is measured from the previous deadline, so the time its task runs for
+ * does not delay the next run.
+ */
+TEST_F(TimerWheelTest, testAbsolutePeriodRunsAtFixedRate) {
+    auto interval = runPeriodicTimer(TimerWheel::PeriodType::ABSOLUTE);
+    EXPECT_GE(interval, PERIOD - std::chrono::milliseconds(1));
+    EXPECT_LT(interval, PERIOD + TASK_DURATION);
+}
+
+/**
+ * Test that the period of a relative timer is measured from the end of the previous run.
+ */
+TEST_F(TimerWheelTest, testRelativePeriodStartsAfterTask) {
+    auto interval = runPeriodicTimer(TimerWheel::PeriodType::RELATIVE);
+    // The end of the run is rounded down to the tick it falls into.
+    EXPECT_GE(interval, PERIOD + TASK_DURATION - std::chrono::milliseconds(1));
+}
+
+/**
+ * Test that timers cannot be scheduled without a task.
+ */
+TEST_F(TimerWheelTest, testScheduleWithoutTaskFails) {
+    EXPECT_EQ(
+        0u,
+        m_wheel->schedule(
+            std::chrono::milliseconds(1),
+            std::chrono::nanoseconds::zero(),
+            TimerWheel::PeriodType::ABSOLUTE,
+            1,
+            nullptr));
+    EXPECT_EQ(0u, m_wheel->size());
+}
+
+}  // namespace test
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
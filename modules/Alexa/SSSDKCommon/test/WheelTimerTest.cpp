@@ -0,0 +1,174 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "SSSDKCommon/WheelTimer.h"
+
+namespace alexaSmartScreenSDK {
+namespace sssdkCommon {
+namespace test {
+
+/// Time to wait for timers expected to fire.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// Delay of the timers.
+static const std::chrono::milliseconds DELAY{10};
+
+/// Time a blocked task is given to show that it is waited for.
+static const std::chrono::milliseconds BLOCK_DURATION{50};
+
+class WheelTimerTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    void TearDown() override;
+
+protected:
+    /// The wheel running the timer.
+    std::shared_ptr<TimerWheel> m_wheel;
+
+    /// The timer under test.
+    std::unique_ptr<WheelTimer> m_timer;
+};
+
+void WheelTimerTest::SetUp() {
+    m_wheel = std::make_shared<TimerWheel>();
+    m_timer.reset(new WheelTimer(m_wheel));
+}
+
+void WheelTimerTest::TearDown() {
+    m_timer.reset();
+    m_wheel.reset();
+}
+
+/**
+ * Test that a one shot timer runs once and is inactive afterwards.
+ */
+TEST_F(WheelTimerTest, testOneShotRunsOnce) {
+    std::promise<void> ran;
+    ASSERT_TRUE(m_timer->start(DELAY, [&ran] { ran.set_value(); }));
+    EXPECT_TRUE(m_timer->isActive());
+    ASSERT_EQ(std::future_status::ready, ran.get_future().wait_for(WAIT_TIMEOUT));
+
+    auto deadline = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    while (m_timer->isActive() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_FALSE(m_timer->isActive());
+}
+
+/**
+ * Test that an active timer cannot be started again, and can once stopped.
+ */
+TEST_F(WheelTimerTest, testStartWhileActiveFails) {
+    ASSERT_TRUE(m_timer->start(WAIT_TIMEOUT, [] {}));
+    EXPECT_FALSE(m_timer->start(DELAY, [] {}));
+
+    m_timer->stop();
+    EXPECT_FALSE(m_timer->isActive());
+    EXPECT_TRUE(m_timer->start(DELAY, [] {}));
+}
+
+/**
+ * Test that stopping a timer while its task runs waits for the task to finish, and the timer does not run again.
+ */
+TEST_F(WheelTimerTest, testStopWhileTaskRunsWaitsForIt) {
+    std::promise<void> taskStarted;
+    std::promise<void> releaseTask;
+    auto releaseTaskFuture = releaseTask.get_future().share();
+    std::atomic<int> runs{0};
+    std::atomic<bool> taskFinished{false};
+    ASSERT_TRUE(m_timer->start(DELAY, WheelTimer::PeriodType::ABSOLUTE, WheelTimer::FOREVER, [&] {
+        if (1 == ++runs) {
+            taskStarted.set_value();
+            releaseTaskFuture.wait();
+            taskFinished = true;
+        }
+    }));
+    ASSERT_EQ(std::future_status::ready, taskStarted.get_future().wait_for(WAIT_TIMEOUT));
+
+    auto stopped = std::async(std::launch::async, [this] { m_timer->stop(); });
+    EXPECT_EQ(std::future_status::timeout, stopped.wait_for(BLOCK_DURATION));
+
+    releaseTask.set_value();
+    ASSERT_EQ(std::future_status::ready, stopped.wait_for(WAIT_TIMEOUT));
+    EXPECT_TRUE(taskFinished);
+    EXPECT_FALSE(m_timer->isActive());
+
+    std::this_thread::sleep_for(BLOCK_DURATION);
+    EXPECT_EQ(1, runs);
+}
+
+/**
+ * Test that a task can restart its own timer once it stopped it, while starting it without stopping fails as the
+ * timer is still active.
+ */
+TEST_F(WheelTimerTest, testRestartFromTask) {
+    std::promise<bool> startWhileActive;
+    std::promise<bool> restarted;
+    std::promise<void> restartedTaskRan;
+    ASSERT_TRUE(m_timer->start(DELAY, [&] {
+        startWhileActive.set_value(m_timer->start(DELAY, [] {}));
+        m_timer->stop();
+        restarted.set_value(m_timer->start(DELAY, [&restartedTaskRan] { restartedTaskRan.set_value(); }));
+    }));
+
+    auto startWhileActiveFuture = startWhileActive.get_future();
+    ASSERT_EQ(std::future_status::ready, startWhileActiveFuture.wait_for(WAIT_TIMEOUT));
+    EXPECT_FALSE(startWhileActiveFuture.get());
+    auto restartedFuture = restarted.get_future();
+    ASSERT_EQ(std::future_status::ready, restartedFuture.wait_for(WAIT_TIMEOUT));
+    EXPECT_TRUE(restartedFuture.get());
+    EXPECT_EQ(std::future_status::ready, restartedTaskRan.get_future().wait_for(WAIT_TIMEOUT));
+}
+
+/**
+ * Test that a periodic timer runs the requested number of times.
+ */
+TEST_F(WheelTimerTest, testPeriodicRunsMaxCount) {
+    const size_t maxCount = 3;
+    std::atomic<size_t> runs{0};
+    std::promise<void> lastRun;
+    ASSERT_TRUE(m_timer->start(DELAY, WheelTimer::PeriodType::RELATIVE, maxCount, [&] {
+        if (maxCount == ++runs) {
+            lastRun.set_value();
+        }
+    }));
+
+    ASSERT_EQ(std::future_status::ready, lastRun.get_future().wait_for(WAIT_TIMEOUT));
+    std::this_thread::sleep_for(BLOCK_DURATION);
+    EXPECT_EQ(maxCount, runs);
+    EXPECT_FALSE(m_timer->isActive());
+}
+
+/**
+ * Test that a timer without a wheel cannot be started.
+ */
+TEST_F(WheelTimerTest, testStartWithoutWheelFails) {
+    WheelTimer timer(nullptr);
+    EXPECT_FALSE(timer.start(DELAY, [] {}));
+    EXPECT_FALSE(timer.isActive());
+}
+
+}  // namespace test
+}  // namespace sssdkCommon
+}  // namespace alexaSmartScreenSDK
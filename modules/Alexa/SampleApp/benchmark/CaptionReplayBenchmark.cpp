@@ -0,0 +1,331 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * Replays a sequence of caption frames through the caption path of the Sample App, from the caption presenter to the
+ * serialized renderCaptions message sent to the GUI Client.  The current path is compared with the previous one, which
+ * built a document per frame, serialized it, and parsed it again into the message.  For both the benchmark reports
+ * the latency and the number of heap allocations per frame, and checks that both produce the same messages.
+ *
+ * Usage: CaptionReplayBenchmark [--frames N] [--output file]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <Captions/CaptionFrame.h>
+
+#include "SampleApp/Messages/GUIClientMessage.h"
+#include "SampleApp/SmartScreenCaptionPresenter.h"
+
+using namespace alexaClientSDK::captions;
+using namespace alexaSmartScreenSDK;
+using namespace alexaSmartScreenSDK::sampleApp;
+
+/// Default number of replayed frames.
+static const int DEFAULT_FRAMES = 5000;
+/// Number of frames replayed before measuring, so buffers reach their steady state size.
+static const int WARMUP_FRAMES = 100;
+/// Words the caption lines are made of.
+static const std::vector<std::string> WORDS = {"the",
+                                              "weather",
+                                              "in",
+                                              "Seattle",
+                                              "today",
+                                              "is",
+                                              "partly",
+                                              "cloudy",
+                                              "with",
+                                              "a",
+                                              "high",
+                                              "of",
+                                              "sixty",
+                                              "degrees"};
+
+/// Number of heap allocations so far.
+static std::atomic<long> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+/// Duration type used for all measurements.
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+/**
+ * Summary statistics of a series of samples.
+ */
+struct Summary {
+    double mean = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double max = 0;
+};
+
+/**
+ * Computes summary statistics.
+ *
+ * @param samples The samples, reordered by this call.
+ * @return The summary.
+ */
+static Summary summarize(std::vector<double>& samples) {
+    Summary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    double total = 0;
+    for (auto sample : samples) {
+        total += sample;
+    }
+    summary.mean = total / samples.size();
+    summary.p50 = samples[samples.size() / 2];
+    summary.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    summary.max = samples.back();
+    return summary;
+}
+
+/**
+ * Writes a summary as a JSON object.
+ *
+ * @param writer The writer.
+ * @param name The member name.
+ * @param summary The summary.
+ */
+static void writeSummary(
+    rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer,
+    const char* name,
+    const Summary& summary) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("mean");
+    writer.Double(summary.mean);
+    writer.Key("p50");
+    writer.Double(summary.p50);
+    writer.Key("p95");
+    writer.Double(summary.p95);
+    writer.Key("max");
+    writer.Double(summary.max);
+    writer.EndObject();
+}
+
+/**
+ * Generates the replayed frames, one to three lines of a few words with a style run per word.
+ *
+ * @param count Number of frames.
+ * @return The frames.
+ */
+static std::vector<CaptionFrame> generateFrames(int count) {
+    std::vector<CaptionFrame> frames;
+    size_t word = 0;
+    for (int i = 0; i < count; i++) {
+        std::vector<CaptionLine> lines;
+        for (int line = 0; line <= i % 3; line++) {
+            std::string text;
+            std::vector<TextStyle> styles;
+            for (int j = 0; j < 6; j++) {
+                if (!text.empty()) {
+                    text += " ";
+                }
+                styles.push_back(TextStyle(text.size(), Style(word % 5 == 0, word % 7 == 0, false)));
+                text += WORDS[word++ % WORDS.size()];
+            }
+            lines.push_back(CaptionLine(text, styles));
+        }
+        frames.push_back(
+            CaptionFrame(i, std::chrono::milliseconds(1500 + i % 500), std::chrono::milliseconds(i % 50), lines));
+    }
+    return frames;
+}
+
+/**
+ * The previous caption path, building a document per frame with style flags converted by @c std::to_string.
+ */
+class DocumentCaptionPath {
+public:
+    std::string render(const CaptionFrame& captionFrame) {
+        rapidjson::Document frameJson(rapidjson::kObjectType);
+        auto& allocator = frameJson.GetAllocator();
+        frameJson.AddMember(
+            "duration",
+            rapidjson::Value(
+                std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDuration()).count())
+                .Move(),
+            allocator);
+        frameJson.AddMember(
+            "delay",
+            rapidjson::Value(std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDelay()).count())
+                .Move(),
+            allocator);
+        rapidjson::Value linesJson(rapidjson::kArrayType);
+        for (const auto& captionLine : captionFrame.getCaptionLines()) {
+            rapidjson::Value lineJson(rapidjson::kObjectType);
+            rapidjson::Value stylesJson(rapidjson::kArrayType);
+            for (auto textStyle : captionLine.styles) {
+                rapidjson::Value styleJson(rapidjson::kObjectType);
+                styleJson.AddMember(
+                    "bold",
+                    rapidjson::Value(std::to_string(textStyle.activeStyle.m_bold), allocator).Move(),
+                    allocator);
+                styleJson.AddMember(
+                    "italic",
+                    rapidjson::Value(std::to_string(textStyle.activeStyle.m_italic), allocator).Move(),
+                    allocator);
+                styleJson.AddMember(
+                    "underline",
+                    rapidjson::Value(std::to_string(textStyle.activeStyle.m_underline), allocator).Move(),
+                    allocator);
+                rapidjson::Value textStyleJson(rapidjson::kObjectType);
+                textStyleJson.AddMember("activeStyle", rapidjson::Value(styleJson, allocator).Move(), allocator);
+                textStyleJson.AddMember(
+                    "charIndex", rapidjson::Value(std::to_string(textStyle.charIndex), allocator).Move(), allocator);
+                stylesJson.PushBack(textStyleJson, allocator);
+            }
+            lineJson.AddMember("text", rapidjson::Value(captionLine.text, allocator), allocator);
+            lineJson.AddMember("styles", rapidjson::Value(stylesJson, allocator), allocator);
+            linesJson.PushBack(lineJson, allocator);
+        }
+        frameJson.AddMember("captionLines", rapidjson::Value(linesJson, allocator), allocator);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        frameJson.Accept(writer);
+
+        messages::GUIClientMessage message(GUI_MSG_TYPE_RENDER_CAPTIONS);
+        message.setParsedPayload(buffer.GetString());
+        return message.get();
+    }
+};
+
+/**
+ * The current caption path, the @c SmartScreenCaptionPresenter handing frames to a GUI Client which sends a
+ * @c RenderCaptionsMessage.
+ */
+class PresenterCaptionPath : public smartScreenSDKInterfaces::RenderCaptionsInterface {
+public:
+    void renderCaptions(const std::string& payload) override {
+        m_message = messages::RenderCaptionsMessage(payload).get();
+    }
+
+    /// The last message.
+    std::string m_message;
+};
+
+int main(int argc, char** argv) {
+    std::string outputPath;
+    int frameCount = DEFAULT_FRAMES;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            frameCount = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--frames N] [--output file]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto frames = generateFrames(frameCount);
+    DocumentCaptionPath documentPath;
+    auto presenterPath = std::make_shared<PresenterCaptionPath>();
+    SmartScreenCaptionPresenter presenter(presenterPath);
+
+    for (int i = 0; i < WARMUP_FRAMES; i++) {
+        documentPath.render(frames[i % frames.size()]);
+        presenter.onCaptionActivity(frames[i % frames.size()], alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND);
+    }
+
+    std::vector<double> documentLatency;
+    std::vector<double> presenterLatency;
+    long documentAllocations = 0;
+    long presenterAllocations = 0;
+    int mismatches = 0;
+    for (const auto& frame : frames) {
+        auto allocationsBefore = g_allocations.load();
+        auto start = std::chrono::steady_clock::now();
+        auto expected = documentPath.render(frame);
+        documentLatency.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+        documentAllocations += g_allocations.load() - allocationsBefore;
+
+        allocationsBefore = g_allocations.load();
+        start = std::chrono::steady_clock::now();
+        presenter.onCaptionActivity(frame, alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND);
+        presenterLatency.push_back(Microseconds(std::chrono::steady_clock::now() - start).count());
+        presenterAllocations += g_allocations.load() - allocationsBefore;
+
+        if (expected != presenterPath->m_message) {
+            if (0 == mismatches++) {
+                std::cerr << "Message mismatch:\n  " << expected << "\n  " << presenterPath->m_message << std::endl;
+            }
+        }
+    }
+
+    rapidjson::StringBuffer sb;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+    writer.StartObject();
+    writer.Key("frames");
+    writer.Int(frameCount);
+    writer.Key("mismatches");
+    writer.Int(mismatches);
+    writer.Key("results");
+    writer.StartArray();
+    writer.StartObject();
+    writer.Key("path");
+    writer.String("document");
+    writeSummary(writer, "latencyUs", summarize(documentLatency));
+    writer.Key("allocationsPerFrame");
+    writer.Double(static_cast<double>(documentAllocations) / frameCount);
+    writer.EndObject();
+    writer.StartObject();
+    writer.Key("path");
+    writer.String("presenter");
+    writeSummary(writer, "latencyUs", summarize(presenterLatency));
+    writer.Key("allocationsPerFrame");
+    writer.Double(static_cast<double>(presenterAllocations) / frameCount);
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+
+    if (outputPath.empty()) {
+        std::cout << sb.GetString() << std::endl;
+    } else {
+        std::ofstream output(outputPath);
+        output << sb.GetString() << std::endl;
+    }
+
+    return 0 == mismatches ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -17,10 +17,14 @@
 #define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_APLCLIENTBRIDGE_H_
 
 #include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/Logger/Level.h>
+#include <SSSDKCommon/JsonMemberScanner.h>
+#include <SSSDKCommon/WheelTimer.h>
 #include "SmartScreenSDKInterfaces/MessagingServerObserverInterface.h"
 #include "APLClient/AplClientBinding.h"
 #include "GUI/GUIManager.h"
 #include "CachingDownloadManager.h"
+#include "LocalPackageStore.h"
 
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
@@ -31,6 +35,12 @@ namespace sampleApp {
 struct AplClientBridgeParameter {
     // Maximum number of concurrent downloads allowed.
     int maxNumberOfConcurrentDownloads;
+    // File the APL trace is written to when a dump is requested, empty if tracing is disabled.
+    std::string traceOutputPath;
+    // Most verbose level logged for the APL client binding.
+    alexaClientSDK::avsCommon::utils::logger::Level aplClientLogLevel;
+    // Most verbose level logged for the APL core engine.
+    alexaClientSDK::avsCommon::utils::logger::Level aplCoreEngineLogLevel;
 };
 
 class AplClientBridge
@@ -38,10 +48,20 @@ class AplClientBridge
         , public smartScreenSDKInterfaces::MessagingServerObserverInterface
         , public smartScreenSDKInterfaces::VisualStateProviderInterface {
 public:
+    /**
+     * Creates an @c AplClientBridge.
+     *
+     * @param contentDownloadManager Download manager used to retrieve resources from the network
+     * @param guiClient The GUI client used to communicate with the viewhost
+     * @param parameters Additional parameters for the bridge
+     * @param packageStore Optional local package store consulted before downloading import packages
+     * @return The new @c AplClientBridge
+     */
     static std::shared_ptr<AplClientBridge> create(
         std::shared_ptr<CachingDownloadManager> contentDownloadManager,
         std::shared_ptr<smartScreenSDKInterfaces::GUIClientInterface> guiClient,
-        AplClientBridgeParameter parameters);
+        AplClientBridgeParameter parameters,
+        std::shared_ptr<LocalPackageStore> packageStore = nullptr);
 
     /// @name AplOptionsInterface Functions
     /// {
@@ -77,6 +97,8 @@ public:
 
     void logMessage(APLClient::LogLevel level, const std::string& source, const std::string& message) override;
 
+    bool shouldLog(APLClient::LogLevel level, APLClient::LogSubsystem subsystem) override;
+
     int getMaxNumberOfConcurrentDownloads() override;
     /// }
 
@@ -112,34 +134,38 @@ private:
     AplClientBridge(
         std::shared_ptr<CachingDownloadManager> contentDownloadManager,
         std::shared_ptr<smartScreenSDKInterfaces::GUIClientInterface> guiClient,
-        AplClientBridgeParameter parameters);
+        AplClientBridgeParameter parameters,
+        std::shared_ptr<LocalPackageStore> packageStore);
 
     /**
      * Extracts the document section from an APL payload
-     * @param jsonPayload
+     * @param members The top level members of the payload
      * @return The extracted document
      */
-    std::string extractDocument(const rapidjson::Document& document);
+    std::string extractDocument(const sssdkCommon::JsonMembers& members);
 
     /**
      * Extracts the data section from an APL payload
-     * @param jsonPayload
+     * @param members The top level members of the payload
      * @return The extracted data
      */
-    std::string extractData(const rapidjson::Document& document);
+    std::string extractData(const sssdkCommon::JsonMembers& members);
 
     /**
      * Extracts the SupportedViewports section from a directive
-     * @param jsonPayload
+     * @param members The top level members of the payload
      * @return The extracted section
      */
-    std::string extractSupportedViewports(const rapidjson::Document& jsonPayload);
+    std::string extractSupportedViewports(const sssdkCommon::JsonMembers& members);
 
     /// Pointer to the download manager for retrieving resources
     std::shared_ptr<CachingDownloadManager> m_contentDownloadManager;
 
+    /// Pointer to the local package store, consulted before downloading, may be null
+    std::shared_ptr<LocalPackageStore> m_packageStore;
+
     /// An internal timer use to run the APL Core update loop
-    alexaClientSDK::avsCommon::utils::timing::Timer m_updateTimer;
+    sssdkCommon::WheelTimer m_updateTimer;
 
     /// Pointer to the APL Client
     std::unique_ptr<APLClient::AplClientBinding> m_aplClient;
@@ -35,6 +35,8 @@ public:
      * @param cachePeriodInSeconds Number of seconds to reuse cache for downloaded packages
      * @param maxCacheSize Maximum cache size for caching downloaded packages
      * @param miscStorage Wrapper to read and write to misc stor=age database
+     * @param customerDataManager The @c CustomerDataManager this handler registers with
+     * @param downloadChunkSize Minimum number of bytes the download buffer grows by when Content-Length is unknown
      */
     CachingDownloadManager(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>
@@ -42,7 +44,8 @@ public:
         unsigned long cachePeriodInSeconds,
         unsigned long maxCacheSize,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface> miscStorage,
-        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager);
+        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+        size_t downloadChunkSize = DEFAULT_DOWNLOAD_CHUNK_SIZE);
 
     /**
      * Method that should be called when requesting content
@@ -52,6 +55,9 @@ public:
      */
     std::string retrieveContent(const std::string& source);
 
+    /// Default minimum number of bytes the download buffer grows by.
+    static const size_t DEFAULT_DOWNLOAD_CHUNK_SIZE = 4096;
+
     /**
      * Class to define a cached content item
      */
@@ -118,6 +124,10 @@ private:
      * Max numbers of entries in cache for downloaded content
      */
     unsigned long m_maxCacheSize;
+    /**
+     * Minimum number of bytes the download buffer grows by
+     */
+    size_t m_downloadChunkSize;
     /**
      * The hashmap that maps the source url to a CachedContent
      */
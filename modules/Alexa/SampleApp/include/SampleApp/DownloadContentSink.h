@@ -0,0 +1,112 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_DOWNLOADCONTENTSINK_H_
+#define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_DOWNLOADCONTENTSINK_H_
+
+#include <future>
+#include <mutex>
+#include <string>
+
+#include <AVSCommon/AVS/Attachment/AttachmentWriter.h>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+/**
+ * An @c AttachmentWriter that collects a downloaded body directly into a string buffer, and signals completion
+ * through a future when the content fetcher closes it.  This avoids polling the fetcher state and copying the body
+ * through an intermediate attachment.
+ */
+class DownloadContentSink : public alexaClientSDK::avsCommon::avs::attachment::AttachmentWriter {
+public:
+    /// The outcome of a download, settled when the sink is closed.
+    enum class Status {
+        /// Every expected byte was received, or the size of the body was not known.
+        COMPLETE,
+        /// The sink was closed before the expected number of bytes was received.
+        INCOMPLETE
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param expectedSize The expected size of the body in bytes (e.g. Content-Length), or 0 if not known.
+     * @param chunkSize The minimum number of bytes to grow the buffer by when it needs to be extended.
+     */
+    DownloadContentSink(size_t expectedSize, size_t chunkSize);
+
+    /**
+     * Destructor.  Signals completion if the sink was never closed.
+     */
+    ~DownloadContentSink() override;
+
+    /// @name AttachmentWriter Functions
+    /// @{
+    std::size_t write(
+        const void* buf,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) override;
+
+    void close() override;
+    /// @}
+
+    /**
+     * Returns a future which becomes ready when the writer has been closed, holding the outcome of the download.
+     *
+     * @return Future signalling body completion.
+     */
+    std::shared_future<Status> getCompletionFuture() const;
+
+    /**
+     * Moves the collected content out of the sink.  Should only be called once the sink is closed.
+     *
+     * @return The collected content.
+     */
+    std::string takeContent();
+
+    /**
+     * @return The number of bytes written to the sink so far.
+     */
+    size_t getBytesWritten();
+
+private:
+    /// Serializes access to @c m_content and @c m_closed.
+    std::mutex m_mutex;
+
+    /// The collected body.
+    std::string m_content;
+
+    /// The expected size of the body in bytes, or 0 if not known.
+    size_t m_expectedSize;
+
+    /// The minimum number of bytes to grow @c m_content by.
+    size_t m_chunkSize;
+
+    /// Whether the writer has been closed.
+    bool m_closed;
+
+    /// Promise satisfied when the writer is closed.
+    std::promise<Status> m_completionPromise;
+
+    /// Shared future for @c m_completionPromise.
+    std::shared_future<Status> m_completionFuture;
+};
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_DOWNLOADCONTENTSINK_H_
@@ -32,6 +32,7 @@
 #pragma GCC diagnostic pop
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -44,7 +45,6 @@
 #include <AVSCommon/SDKInterfaces/ChannelObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/Storage/MiscStorageInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
-#include <AVSCommon/Utils/Timing/Timer.h>
 #include <RegistrationManager/RegistrationObserverInterface.h>
 
 #include <apl/action/action.h>
@@ -58,6 +58,7 @@
 #include <SmartScreenSDKInterfaces/MessagingServerInterface.h>
 #include <SmartScreenSDKInterfaces/NavigationEvent.h>
 #include <SmartScreenSDKInterfaces/RenderCaptionsInterface.h>
+#include <SSSDKCommon/WheelTimer.h>
 #include <SampleApp/GUILogBridge.h>
 #include <SampleApp/SmartScreenCaptionStateManager.h>
 
@@ -90,19 +91,24 @@ public:
     /// Alias for GUI provided token.
     using APLToken = uint64_t;
 
+    /// Default time to wait for the initResponse before the initRequest is sent again.
+    static const std::chrono::milliseconds DEFAULT_INIT_RESPONSE_TIMEOUT;
+
     /**
      * Create a @c GUIClient
      *
      * @param serverImplementation An implementation of @c MessagingInterface
      * @param miscStorage An implementation of MiscStorageInterface
      * @param customerDataManager Object that will track the CustomerDataHandler.
+     * @param initResponseTimeout Time to wait for the initResponse before the initRequest is sent again.
      * @note The @c serverImplementation should implement the @c start method in a blocking fashion.
      * @return an instance of GUIClient.
      */
     static std::shared_ptr<GUIClient> create(
         std::shared_ptr<MessagingServerInterface> serverImplementation,
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface>& miscStorage,
-        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager);
+        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+        std::chrono::milliseconds initResponseTimeout = DEFAULT_INIT_RESPONSE_TIMEOUT);
 
     // @name TemplateRuntimeObserverInterface Functions
     /// @{
@@ -263,13 +269,20 @@ private:
         std::shared_ptr<MessagingServerInterface> serverImplementation,
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface>& miscStorage,
         const std::string& APLMaxVersion,
-        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager);
+        const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+        std::chrono::milliseconds initResponseTimeout);
 
     /// Server worker thread.
     void serverThread();
 
-    /// Send initRequest message to the client and wait for init response.
-    void sendInitRequestAndWait();
+    /// Send initRequest message to the client and arm the timeout for its response.
+    void executeSendInitRequest();
+
+    /// Send the initRequest again, unless it was sent too many times, if the client did not respond in time.
+    void executeOnInitResponseTimeout();
+
+    /// Forget the player info card the client displays, so the next one is sent in full.
+    void resetPlayerInfoCard();
 
     /// Process initResponse message received from the client.
     bool executeProcessInitResponse(const rapidjson::Document& message);
@@ -468,9 +481,6 @@ private:
     /// The thread used by the underlying server
     std::thread m_serverThread;
 
-    // The thread used for init messages.
-    std::thread m_initThread;
-
     /// Synchronize access between threads.
     std::mutex m_mutex;
 
@@ -486,6 +496,21 @@ private:
     /// Is the server in unrecoverable error state.
     std::atomic_bool m_errorState;
 
+    /// Whether the current connection has not received a valid initResponse yet, accessed on the executor.
+    bool m_initHandshakePending;
+
+    /// Number of initRequests sent on the current connection, accessed on the executor.
+    int m_initRequestAttempts;
+
+    /// Time to wait for the initResponse before the initRequest is sent again.
+    const std::chrono::milliseconds m_initResponseTimeout;
+
+    /// When the handshake on the current connection started, accessed on the executor.
+    std::chrono::steady_clock::time_point m_initHandshakeStart;
+
+    /// Fires when the initResponse is overdue.
+    sssdkCommon::WheelTimer m_initResponseTimer;
+
     /// The Listener to receive the messages
     std::shared_ptr<smartScreenSDKInterfaces::MessageListenerInterface> m_messageListener;
 
@@ -519,7 +544,16 @@ private:
         m_focusObservers;
 
     /// Autorelease timers for case when client not received channel state change message.
-    std::map<APLToken, std::shared_ptr<alexaClientSDK::avsCommon::utils::timing::Timer>> m_autoReleaseTimers;
+    std::map<APLToken, std::shared_ptr<sssdkCommon::WheelTimer>> m_autoReleaseTimers;
+
+    /// Serializes access to the state of the player info card the client displays.
+    std::mutex m_playerInfoMutex;
+
+    /// audioItemId of the player info card the client displays, empty if none.
+    std::string m_playerInfoAudioItemId;
+
+    /// Payload of the RenderPlayerInfo directive last sent for the displayed card.
+    std::string m_playerInfoPayload;
 
     /// GUI log bridge to be used to handle log events.
     GUILogBridge m_rendererLogBridge;
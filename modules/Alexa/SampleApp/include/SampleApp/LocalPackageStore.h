@@ -0,0 +1,136 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_LOCALPACKAGESTORE_H_
+#define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_LOCALPACKAGESTORE_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+/**
+ * An on-disk repository of APL import packages which is consulted before packages are downloaded from the network.
+ *
+ * Packages are stored in versioned directories, i.e. "<root>/<name>/<version>/document.json", which allows standard
+ * packages such as alexa-layouts and alexa-styles to be pre-seeded at build or provisioning time using a bundle file
+ * of the form:
+ * @code
+ * {
+ *   "packages": [
+ *     { "name": "alexa-layouts", "version": "1.1.0", "document": { ... } }
+ *   ]
+ * }
+ * @endcode
+ */
+class LocalPackageStore {
+public:
+    /**
+     * Creates a @c LocalPackageStore.
+     *
+     * @param rootPath The directory under which packages are stored.
+     * @param importBaseUrl Base URL of the package CDN, imports from "<importBaseUrl><name>/<version>/document.json"
+     * are resolved from the store.
+     * @return A new @c LocalPackageStore, or @c nullptr if the root path is empty or could not be created.
+     */
+    static std::shared_ptr<LocalPackageStore> create(
+        const std::string& rootPath,
+        const std::string& importBaseUrl = DEFAULT_IMPORT_BASE_URL);
+
+    /**
+     * Resolves a package import source against the store.  Both "file://" sources inside the store root and package
+     * CDN URLs are supported.
+     *
+     * @param source The import source.
+     * @param[out] content The package content if found.
+     * @return Whether the package was found in the store.
+     */
+    bool getPackageBySource(const std::string& source, std::string* content);
+
+    /**
+     * Retrieves a package by name and version.
+     *
+     * @param name The package name.
+     * @param version The package version.
+     * @param[out] content The package content if found.
+     * @return Whether the package was found in the store.
+     */
+    bool getPackage(const std::string& name, const std::string& version, std::string* content);
+
+    /**
+     * Stores a package, replacing any existing package with the same name and version.
+     *
+     * @param name The package name.
+     * @param version The package version.
+     * @param content The package content.
+     * @return Whether the package was stored.
+     */
+    bool putPackage(const std::string& name, const std::string& version, const std::string& content);
+
+    /**
+     * Imports all packages from a bundle file into the store.
+     *
+     * @param bundlePath Path to the bundle file.
+     * @return The number of packages imported.
+     */
+    int importBundle(const std::string& bundlePath);
+
+    /// The default package CDN base URL.
+    static const std::string DEFAULT_IMPORT_BASE_URL;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param rootPath The directory under which packages are stored.
+     * @param importBaseUrl Base URL of the package CDN.
+     */
+    LocalPackageStore(const std::string& rootPath, const std::string& importBaseUrl);
+
+    /**
+     * Builds the path of a package document, validating the name and version.
+     *
+     * @param name The package name.
+     * @param version The package version.
+     * @param[out] path The package document path.
+     * @return Whether the name and version are valid path segments.
+     */
+    bool getPackagePath(const std::string& name, const std::string& version, std::string* path);
+
+    /**
+     * Reads a file under the store root.
+     *
+     * @param path The file path.
+     * @param[out] content The file content.
+     * @return Whether the file was read.
+     */
+    bool readFile(const std::string& path, std::string* content);
+
+    /// The directory under which packages are stored.
+    std::string m_rootPath;
+
+    /// The package CDN base URL.
+    std::string m_importBaseUrl;
+
+    /// Serializes writes to the store.
+    std::mutex m_mutex;
+};
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_LOCALPACKAGESTORE_H_
@@ -17,6 +17,7 @@
 #define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_MESSAGES_GUICLIENTMESSAGE_H
 
 #include <string>
+#include <utility>
 
 #include <rapidjson/document.h>
 
@@ -59,6 +60,9 @@ const std::string GUI_MSG_TYPE_RENDER_TEMPLATE("renderTemplate");
 /// The message type for renderPlayerInfo.
 const std::string GUI_MSG_TYPE_RENDER_PLAYER_INFO("renderPlayerInfo");
 
+/// The message type for playerInfoUpdate.
+const std::string GUI_MSG_TYPE_PLAYER_INFO_UPDATE("playerInfoUpdate");
+
 /// The message type for clearTemplateCard.
 const std::string GUI_MSG_TYPE_CLEAR_TEMPLATE_CARD("clearTemplateCard");
 
@@ -71,6 +75,11 @@ const std::string GUI_MSG_TYPE_CLEAR_DOCUMENT("clearDocument");
 /// The message type for renderCaptions.
 const std::string GUI_MSG_TYPE_RENDER_CAPTIONS("renderCaptions");
 
+/// The start of a renderCaptions message, completed by the serialized captions payload and a closing brace.
+const std::string GUI_MSG_RENDER_CAPTIONS_PREFIX(
+    std::string("{\"") + alexaSmartScreenSDK::smartScreenSDKInterfaces::MSG_TYPE_TAG + "\":\"" +
+    GUI_MSG_TYPE_RENDER_CAPTIONS + "\",\"" + MSG_PAYLOAD_TAG + "\":");
+
 /// The SSSDK version key in the message.
 const std::string GUI_MSG_SMART_SCREEN_SDK_VERSION_TAG("smartScreenSDKVersion");
 
@@ -104,6 +113,9 @@ const char GUI_MSG_AUDIO_PLAYER_STATE_TAG[] = "audioPlayerState";
 /// The audioOffset json key in the message.
 const char GUI_MSG_AUDIO_OFFSET_TAG[] = "audioOffset";
 
+/// The audioItemId json key in the message.
+const char GUI_MSG_AUDIO_ITEM_ID_TAG[] = "audioItemId";
+
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
 namespace messages {
@@ -329,6 +341,35 @@ public:
     }
 };
 
+/**
+ *  The @c PlayerInfoUpdateMessage updates the player info card the GUI Client displays for the same media item.  It
+ * carries the AudioPlayer state and offset, and the members of the RenderPlayerInfo payload which changed.
+ */
+class PlayerInfoUpdateMessage : public GUIClientMessage {
+public:
+    /**
+     * Constructor.
+     *
+     * @param audioItemId The audioItemId of the displayed card.
+     * @param audioPlayerInfo @c The smartScreenSDKInterfaces::AudioPlayerInfo object containing player state and offset
+     * values.
+     * @param changedPayload The changed members of the RenderPlayerInfo payload in structured JSON format, empty if
+     * none changed.
+     */
+    PlayerInfoUpdateMessage(
+        const std::string& audioItemId,
+        smartScreenSDKInterfaces::AudioPlayerInfo audioPlayerInfo,
+        const std::string& changedPayload) :
+            GUIClientMessage(GUI_MSG_TYPE_PLAYER_INFO_UPDATE) {
+        addMember(GUI_MSG_AUDIO_ITEM_ID_TAG, audioItemId);
+        addMember(GUI_MSG_AUDIO_PLAYER_STATE_TAG, playerActivityToString(audioPlayerInfo.audioPlayerState));
+        addMember(GUI_MSG_AUDIO_OFFSET_TAG, audioPlayerInfo.offset.count());
+        if (!changedPayload.empty()) {
+            setParsedPayload(changedPayload);
+        }
+    }
+};
+
 /**
  *  The @c ClearRenderTemplateCardMessage instructs the GUI Client to clear visual content from the screen.
  */
@@ -357,13 +398,36 @@ public:
 };
 
 /**
- *  The @c RenderCaptionsMessage instructs the GUI Client to render captions
+ *  The @c RenderCaptionsMessage instructs the GUI Client to render captions.  It is sent for every caption frame, so
+ *  the payload, which is serialized JSON already, is spliced into a prebuilt envelope once on construction instead of
+ *  being parsed and serialized again.
  */
 class RenderCaptionsMessage : public GUIClientMessage {
 public:
+    /**
+     * Constructor.
+     *
+     * @param payload The serialized caption frame.
+     */
     explicit RenderCaptionsMessage(const std::string& payload) : GUIClientMessage(GUI_MSG_TYPE_RENDER_CAPTIONS) {
-        setParsedPayload(payload);
+        m_message.reserve(GUI_MSG_RENDER_CAPTIONS_PREFIX.size() + payload.size() + 1);
+        m_message.append(GUI_MSG_RENDER_CAPTIONS_PREFIX).append(payload);
+        m_message.push_back('}');
     };
+
+    std::string get() override {
+        return m_message;
+    }
+
+    rapidjson::Value&& getValue() override {
+        // Parsing the whole message replaces the document, so the payload is never added twice.
+        mDocument.Parse(m_message);
+        return GUIClientMessage::getValue();
+    }
+
+private:
+    /// The serialized message, built once on construction.
+    std::string m_message;
 };
 }  // namespace messages
 }  // namespace sampleApp
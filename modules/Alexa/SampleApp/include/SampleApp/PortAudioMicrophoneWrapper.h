@@ -16,10 +16,17 @@
 #ifndef ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_PORTAUDIOMICROPHONEWRAPPER_H_
 #define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_PORTAUDIOMICROPHONEWRAPPER_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <AVSCommon/AVS/AudioInputStream.h>
+#include <SSSDKCommon/SpscRingBuffer.h>
 
 #include <portaudio.h>
 #include <Audio/MicrophoneInterface.h>
@@ -27,9 +34,39 @@
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
 
-/// This acts as a wrapper around PortAudio, a cross-platform open-source audio I/O library.
+/**
+ * This acts as a wrapper around PortAudio, a cross-platform open-source audio I/O library.
+ *
+ * The PortAudio callback runs on a real time thread, so it only copies the captured samples into a lock free staging
+ * ring.  A feeder thread moves them from the ring into the shared data stream, where contention with the readers of
+ * the stream cannot delay the capture.  The frames per buffer of the PortAudio stream and the size of the ring are
+ * configurable, a ring size of 0 writes into the stream straight from the callback.
+ *
+ * For latency measurements the microphone can replay an audio file, paced like the PortAudio callback, instead of
+ * capturing from the device.  The capture to stream latency is logged whenever streaming stops.
+ */
 class PortAudioMicrophoneWrapper : public alexaClientSDK::applicationUtilities::resources::audio::MicrophoneInterface {
 public:
+    /**
+     * Counters of the audio lost on the way from the device to the shared data stream.
+     */
+    struct Statistics {
+        /// Number of callbacks whose samples did not fit into the staging ring.
+        uint64_t ringOverruns = 0;
+
+        /// Number of samples dropped because the staging ring was full.
+        uint64_t droppedSamples = 0;
+
+        /// Number of callbacks for which PortAudio reported that input data was discarded.
+        uint64_t inputOverflows = 0;
+
+        /// Number of callbacks for which PortAudio reported that input data was inserted as silence.
+        uint64_t inputUnderflows = 0;
+
+        /// Number of failed writes into the shared data stream.
+        uint64_t streamWriteFailures = 0;
+    };
+
     /**
      * Creates a @c PortAudioMicrophoneWrapper.
      *
@@ -60,6 +97,11 @@ public:
      */
     bool isStreaming() override;
 
+    /**
+     * @return The counters of lost audio since the microphone was created.
+     */
+    Statistics getStatistics() const;
+
     /**
      * Destructor.
      */
@@ -92,9 +134,56 @@ private:
         PaStreamCallbackFlags statusFlags,
         void* userData);
 
+    /**
+     * Handles samples captured by the device or read from the replayed file.  Called from the capture thread only.
+     *
+     * @param samples The samples.
+     * @param numSamples The number of samples.
+     * @return Whether capturing should continue.
+     */
+    bool onSamplesCaptured(const int16_t* samples, unsigned long numSamples);
+
+    /// The thread moving samples from the staging ring into the shared data stream.
+    void feederLoop();
+
+    /**
+     * Moves all samples of the staging ring into the shared data stream.  Called from the feeder thread only.
+     */
+    void drainRing();
+
+    /**
+     * Records the latency of the replayed buffers which reached the shared data stream.  Called from the feeder thread
+     * only.
+     */
+    void recordReplayLatencies();
+
+    /// The thread replaying @c m_replaySamples in place of the device.
+    void replayLoop();
+
+    /**
+     * Starts the feeder thread, if captured samples go through the ring buffer and it is not running yet.
+     */
+    void startFeeder();
+
+    /**
+     * Stops the feeder thread after it moved the remaining samples into the shared data stream.
+     */
+    void stopFeeder();
+
+    /**
+     * Logs the capture to stream latency measured while replaying a file, and resets the measurement.
+     */
+    void logReplayLatency();
+
     /// Initializes PortAudio
     bool initialize();
 
+    /**
+     * Reads the optional configuration of the PortAudio stream, the staging ring and the replayed file from
+     * @c AlexaClientSDKConfig.json.
+     */
+    void readConfig();
+
     /**
      * Get the optional config parameter from @c AlexaClientSDKConfig.json
      * for setting the PortAudio stream's suggested latency.
@@ -123,6 +212,64 @@ private:
      * Whether the microphone is currently streaming.
      */
     bool m_isStreaming;
+
+    /// The frames per buffer the PortAudio stream is opened with.
+    unsigned long m_framesPerBuffer;
+
+    /// The staging ring between the capture thread and the feeder thread, @c nullptr to write from the callback.
+    std::unique_ptr<sssdkCommon::SpscRingBuffer<int16_t>> m_ring;
+
+    /// Samples popped from the ring by the feeder thread before they are written into the shared data stream.
+    std::vector<int16_t> m_feederBuffer;
+
+    /// How long the feeder thread sleeps when the ring is empty.
+    std::chrono::microseconds m_feederInterval;
+
+    /// Whether the feeder thread should keep running.
+    std::atomic<bool> m_isFeederRunning;
+
+    /// The feeder thread.
+    std::thread m_feederThread;
+
+    /// @name Counters of lost audio, see @c Statistics.
+    /// @{
+    std::atomic<uint64_t> m_ringOverruns;
+    std::atomic<uint64_t> m_droppedSamples;
+    std::atomic<uint64_t> m_inputOverflows;
+    std::atomic<uint64_t> m_inputUnderflows;
+    std::atomic<uint64_t> m_streamWriteFailures;
+    /// @}
+
+    /// The samples replayed in place of the device, empty when capturing from the device.
+    std::vector<int16_t> m_replaySamples;
+
+    /// Whether the replay thread should keep running.
+    std::atomic<bool> m_isReplayRunning;
+
+    /// The thread replaying @c m_replaySamples.
+    std::thread m_replayThread;
+
+    /**
+     * Capture times of the replayed buffers, each with the total number of samples pushed into the staging ring up to
+     * the end of the buffer.  Written by the replay thread and read by the feeder thread.
+     */
+    std::unique_ptr<sssdkCommon::SpscRingBuffer<std::pair<uint64_t, std::chrono::steady_clock::time_point>>>
+        m_replayCaptureTimes;
+
+    /// Total number of samples pushed into the staging ring, only used while replaying.
+    uint64_t m_capturedSamples;
+
+    /// Total number of samples moved from the staging ring into the shared data stream, only used while replaying.
+    uint64_t m_writtenSamples;
+
+    /// The capture time of a replayed buffer whose last sample did not reach the shared data stream yet.
+    std::pair<uint64_t, std::chrono::steady_clock::time_point> m_pendingCaptureTime;
+
+    /// Whether @c m_pendingCaptureTime is set.
+    bool m_hasPendingCaptureTime;
+
+    /// Capture to stream latencies of the replayed buffers in microseconds, only used while replaying.
+    std::vector<double> m_replayLatencies;
 };
 
 }  // namespace sampleApp
@@ -30,12 +30,12 @@
 #include <KWD/AbstractKeywordDetector.h>
 #endif
 
-#ifdef GSTREAMER_MEDIA_PLAYER
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
+#include <SSSDKCommon/TestMediaPlayer.h>
+#elif defined(GSTREAMER_MEDIA_PLAYER)
 #include <MediaPlayer/MediaPlayer.h>
 #elif defined(ANDROID_MEDIA_PLAYER)
 #include <AndroidSLESMediaPlayer/AndroidSLESMediaPlayer.h>
-#elif defined(UWP_BUILD)
-#include <SSSDKCommon/TestMediaPlayer.h>
 #endif
 
 #include "GUI/GUIClient.h"
@@ -52,12 +52,12 @@
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
 
-#ifdef GSTREAMER_MEDIA_PLAYER
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
+using ApplicationMediaPlayer = alexaSmartScreenSDK::sssdkCommon::TestMediaPlayer;
+#elif defined(GSTREAMER_MEDIA_PLAYER)
 using ApplicationMediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer;
 #elif defined(ANDROID_MEDIA_PLAYER)
 using ApplicationMediaPlayer = mediaPlayer::android::AndroidSLESMediaPlayer;
-#elif defined(UWP_BUILD)
-using ApplicationMediaPlayer = alexaSmartScreenSDK::sssdkCommon::TestMediaPlayer;
 #endif
 
 /// Class to manage the top-level components of the AVS Client Application
@@ -87,6 +87,11 @@ public:
      */
     SampleAppReturnCode run();
 
+    /**
+     * @return The timing of the initialization phases as a JSON document, see @c StartupTaskGraph::getReport.
+     */
+    std::string getStartupReport() const;
+
     /// Destructor which manages the @c SampleApplication shutdown sequence.
     ~SampleApplication();
 #ifdef UWP_BUILD
@@ -241,6 +246,9 @@ private:
     /// The @c MediaPlayer used by @c NotificationsCapabilityAgent.
     std::shared_ptr<ApplicationMediaPlayer> m_ringtoneMediaPlayer;
 
+    /// The timing of the initialization phases.
+    std::string m_startupReport;
+
     /// The singleton map from @c playerId to @c SpeakerInterface::Type.
     static std::unordered_map<std::string, alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface::Type>
         m_playerToSpeakerTypeMap;
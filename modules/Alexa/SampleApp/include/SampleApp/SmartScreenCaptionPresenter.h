@@ -16,12 +16,22 @@
 #ifndef ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_SMARTSCREENCAPTIONPRESENTER_H_
 #define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_SMARTSCREENCAPTIONPRESENTER_H_
 
+#include <memory>
+#include <mutex>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include <SmartScreenSDKInterfaces/RenderCaptionsInterface.h>
 #include <Captions/CaptionPresenterInterface.h>
 
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
 
+/**
+ * Serializes caption frames and hands them to the @c RenderCaptionsInterface.  Frames are written straight into a
+ * buffer which is reused for every frame, without building an intermediate document.
+ */
 class SmartScreenCaptionPresenter : public alexaClientSDK::captions::CaptionPresenterInterface {
 public:
     explicit SmartScreenCaptionPresenter(
@@ -39,20 +49,19 @@ private:
     /// Pointer to the GUI Client interface
     std::shared_ptr<smartScreenSDKInterfaces::RenderCaptionsInterface> m_renderCaptionsInterface;
 
-    rapidjson::Document convertCaptionFrameToJson(const alexaClientSDK::captions::CaptionFrame& captionFrame);
-    rapidjson::Value convertCaptionLineToJson(
-        const alexaClientSDK::captions::CaptionLine& captionLine,
-        rapidjson::Document::AllocatorType& allocator);
-    rapidjson::Value convertTextStyleToJson(
-        alexaClientSDK::captions::TextStyle textStyle,
-        rapidjson::Document::AllocatorType& allocator);
-    rapidjson::Value convertStyleToJson(
-        alexaClientSDK::captions::Style style,
-        rapidjson::Document::AllocatorType& allocator);
-
-    rapidjson::Value convertCaptionLinesToJson(
-        const std::vector<alexaClientSDK::captions::CaptionLine>& captionLines,
-        rapidjson::Document::AllocatorType& allocator);
+    /// Serializes access to @c m_buffer and @c m_writer
+    std::mutex m_mutex;
+
+    /// Buffer holding the serialized frame, it keeps its capacity between frames
+    rapidjson::StringBuffer m_buffer;
+
+    /// Writer of the frames into @c m_buffer
+    rapidjson::Writer<rapidjson::StringBuffer> m_writer;
+
+    void writeCaptionFrame(const alexaClientSDK::captions::CaptionFrame& captionFrame);
+    void writeCaptionLine(const alexaClientSDK::captions::CaptionLine& captionLine);
+    void writeTextStyle(const alexaClientSDK::captions::TextStyle& textStyle);
+    void writeStyle(const alexaClientSDK::captions::Style& style);
 };
 
 }  // namespace sampleApp
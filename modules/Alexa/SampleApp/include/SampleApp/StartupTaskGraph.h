@@ -0,0 +1,181 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_STARTUPTASKGRAPH_H_
+#define ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_STARTUPTASKGRAPH_H_
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+/**
+ * Runs application startup steps, concurrently where they do not depend on each other, and records when each step
+ * started, how long it took and how much CPU time it used.
+ *
+ * Tasks are added with the names of the tasks they depend on and are executed by @c run.  Every task starts on its own
+ * thread as soon as all of its dependencies have succeeded; a task whose dependency failed is skipped.  Work which has
+ * to stay on the calling thread is timed with @c runStep, and points of interest such as the moment the device can
+ * react to the wake word are recorded with @c mark.  All times are relative to the construction of the graph.
+ *
+ * A step which spends much less CPU time than wall time is waiting, e.g. on disk I/O or on a lock, while a step whose
+ * CPU time is close to its duration is compute bound.
+ */
+class StartupTaskGraph {
+public:
+    /// A startup task, returns whether it succeeded.
+    using Task = std::function<bool()>;
+
+    /// Clock used for all timing.
+    using Clock = std::chrono::steady_clock;
+
+    /// Timing of an executed step.
+    struct StepTiming {
+        /// Name of the step
+        std::string name;
+
+        /// Start of the step relative to the construction of the graph
+        std::chrono::microseconds start;
+
+        /// Duration of the step, zero for marks
+        std::chrono::microseconds duration;
+
+        /// CPU time the thread executing the step spent in it, zero for marks and where the platform does not tell
+        std::chrono::microseconds threadCpuTime;
+
+        /// CPU time the whole process used from the construction of the graph until the step finished
+        std::chrono::microseconds processCpuTime;
+
+        /// Whether the step succeeded
+        bool succeeded;
+    };
+
+    /**
+     * Constructor
+     */
+    StartupTaskGraph();
+
+    /**
+     * Adds a task to be executed by the next call to @c run.
+     *
+     * @param name Unique name of the task
+     * @param task The task
+     * @param dependencies Names of the tasks which have to succeed before this task starts.  These must have been
+     * added before, either for the same or for an earlier @c run.
+     * @return Whether the task was added, false if the name is taken or a dependency is unknown
+     */
+    bool addTask(const std::string& name, Task task, const std::vector<std::string>& dependencies = {});
+
+    /**
+     * Executes all tasks added since the last call and waits for them to finish.
+     *
+     * @return Whether all tasks succeeded
+     */
+    bool run();
+
+    /**
+     * Executes a step on the calling thread and records its timing.
+     *
+     * @param name Name of the step
+     * @param task The step
+     * @return The result of the step
+     */
+    bool runStep(const std::string& name, Task task);
+
+    /**
+     * Records a point of interest in the timeline.
+     *
+     * @param name Name of the mark
+     * @return Time elapsed since the construction of the graph
+     */
+    std::chrono::microseconds mark(const std::string& name);
+
+    /**
+     * @return The timing of all executed steps and marks, ordered by start time
+     */
+    std::vector<StepTiming> getTimeline() const;
+
+    /**
+     * Logs the timeline.
+     */
+    void logTimeline() const;
+
+    /**
+     * @return The timeline as a JSON document, with all times in milliseconds
+     */
+    std::string getReport() const;
+
+private:
+    /// State of a task.
+    enum class State { PENDING, RUNNING, SUCCEEDED, FAILED, SKIPPED };
+
+    /// A task and its dependencies.
+    struct Node {
+        /// Name of the task
+        std::string name;
+
+        /// The task
+        Task task;
+
+        /// Indices of the tasks this task depends on
+        std::vector<size_t> dependencies;
+
+        /// State of the task
+        State state;
+    };
+
+    /**
+     * Records the timing of a step.
+     *
+     * @param name Name of the step
+     * @param start When the step started
+     * @param end When the step finished
+     * @param threadCpuTime CPU time the thread executing the step spent in it
+     * @param succeeded Whether the step succeeded
+     */
+    void record(
+        const std::string& name,
+        Clock::time_point start,
+        Clock::time_point end,
+        std::chrono::microseconds threadCpuTime,
+        bool succeeded);
+
+    /// Construction time of the graph
+    const Clock::time_point m_origin;
+
+    /// CPU time of the process at the construction of the graph
+    const std::chrono::microseconds m_originProcessCpuTime;
+
+    /// All tasks in the order they were added
+    std::vector<Node> m_nodes;
+
+    /// Index of the first task not executed yet
+    size_t m_firstPending;
+
+    /// Timings of executed steps and marks
+    std::vector<StepTiming> m_timeline;
+
+    /// Serializes access to the task states and the timeline
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_SAMPLEAPP_INCLUDE_SAMPLEAPP_STARTUPTASKGRAPH_H_
@@ -13,7 +13,7 @@
  * permissions and limitations under the License.
  */
 
-#include <AVSCommon/Utils/Timing/Timer.h>
+#include <APLClient/AplTrace.h>
 #include <SmartScreenSDKInterfaces/ActivityEvent.h>
 #include <SampleApp/Messages/GUIClientMessage.h>
 #include "SampleApp/AplClientBridge.h"
@@ -29,17 +29,56 @@ using namespace alexaClientSDK::avsCommon::avs::attachment;
 using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 using namespace alexaClientSDK::avsCommon::utils::libcurlUtils;
 using namespace alexaClientSDK::avsCommon::utils::sds;
-using namespace alexaClientSDK::avsCommon::utils::timing;
 using namespace smartScreenSDKInterfaces;
 
 /// Default string to attach to mainTemplate parameters.
 static const std::string DEFAULT_PARAM_VALUE = "{}";
 
+/// Section of a RenderDocument payload holding the APL document.
+static const std::string DOCUMENT_SECTION = "document";
+
+/// Section of a RenderDocument payload holding the data sources.
+static const std::string DATASOURCES_SECTION = "datasources";
+
+/// Section of a RenderDocument payload holding the supported viewport specifications.
+static const std::string SUPPORTED_VIEWPORTS_SECTION = "supportedViewports";
+
+/// Sections of a RenderDocument payload passed to the APL client.
+static const std::vector<std::string> RENDER_DOCUMENT_SECTIONS = {DOCUMENT_SECTION,
+                                                                  DATASOURCES_SECTION,
+                                                                  SUPPORTED_VIEWPORTS_SECTION};
+
+/**
+ * Maps an APL client log level to the level the message is logged at.
+ *
+ * @param level The APL client log level
+ * @return The Alexa Client SDK log level
+ */
+static alexaClientSDK::avsCommon::utils::logger::Level toSdkLogLevel(APLClient::LogLevel level) {
+    using alexaClientSDK::avsCommon::utils::logger::Level;
+    switch (level) {
+        case APLClient::LogLevel::CRITICAL:
+        case APLClient::LogLevel::ERROR:
+            return Level::ERROR;
+        case APLClient::LogLevel::WARN:
+            return Level::WARN;
+        case APLClient::LogLevel::INFO:
+            return Level::INFO;
+        case APLClient::LogLevel::DBG:
+            return Level::DEBUG0;
+        case APLClient::LogLevel::TRACE:
+            return Level::DEBUG9;
+    }
+    return Level::ERROR;
+}
+
 std::shared_ptr<AplClientBridge> AplClientBridge::create(
     std::shared_ptr<CachingDownloadManager> contentDownloadManager,
     std::shared_ptr<smartScreenSDKInterfaces::GUIClientInterface> guiClient,
-    AplClientBridgeParameter parameters) {
-    std::shared_ptr<AplClientBridge> renderer(new AplClientBridge(contentDownloadManager, guiClient, parameters));
+    AplClientBridgeParameter parameters,
+    std::shared_ptr<LocalPackageStore> packageStore) {
+    std::shared_ptr<AplClientBridge> renderer(
+        new AplClientBridge(contentDownloadManager, guiClient, parameters, packageStore));
     renderer->m_aplClient.reset(new APLClient::AplClientBinding(renderer));
     return renderer;
 }
@@ -47,8 +86,10 @@ std::shared_ptr<AplClientBridge> AplClientBridge::create(
 AplClientBridge::AplClientBridge(
     std::shared_ptr<CachingDownloadManager> contentDownloadManager,
     std::shared_ptr<smartScreenSDKInterfaces::GUIClientInterface> guiClient,
-    AplClientBridgeParameter parameters) :
+    AplClientBridgeParameter parameters,
+    std::shared_ptr<LocalPackageStore> packageStore) :
         m_contentDownloadManager{contentDownloadManager},
+        m_packageStore{packageStore},
         m_guiClient{guiClient},
         m_renderQueued{false},
         m_parameters{parameters} {
@@ -69,6 +110,10 @@ void AplClientBridge::resetViewhost(const std::string& token) {
 
 std::string AplClientBridge::downloadResource(const std::string& source) {
     ACSDK_DEBUG9(LX(__func__));
+    std::string content;
+    if (m_packageStore && m_packageStore->getPackageBySource(source, &content)) {
+        return content;
+    }
     return m_contentDownloadManager->retrieveContent(source);
 }
 
@@ -129,24 +174,15 @@ void AplClientBridge::onDataSourceFetchRequestEvent(const std::string& type, con
 }
 
 void AplClientBridge::logMessage(APLClient::LogLevel level, const std::string& source, const std::string& message) {
-    switch (level) {
-        case APLClient::LogLevel::CRITICAL:
-        case APLClient::LogLevel::ERROR:
-            ACSDK_ERROR(LX(source).m(message));
-            break;
-        case APLClient::LogLevel::WARN:
-            ACSDK_WARN(LX(source).m(message));
-            break;
-        case APLClient::LogLevel::INFO:
-            ACSDK_INFO(LX(source).m(message));
-            break;
-        case APLClient::LogLevel::DBG:
-            ACSDK_DEBUG0(LX(source).m(message));
-            break;
-        case APLClient::LogLevel::TRACE:
-            ACSDK_DEBUG9(LX(source).m(message));
-            break;
-    }
+    ACSDK_LOG(toSdkLogLevel(level), LX(source).m(message));
+}
+
+bool AplClientBridge::shouldLog(APLClient::LogLevel level, APLClient::LogSubsystem subsystem) {
+    auto sdkLevel = toSdkLogLevel(level);
+    auto subsystemLevel = APLClient::LogSubsystem::CORE_ENGINE == subsystem ? m_parameters.aplCoreEngineLogLevel
+                                                                             : m_parameters.aplClientLogLevel;
+    return sdkLevel >= subsystemLevel &&
+           alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION().shouldLog(sdkLevel);
 }
 
 void AplClientBridge::onConnectionOpened() {
@@ -155,8 +191,8 @@ void AplClientBridge::onConnectionOpened() {
     m_executor.submit([this] {
         m_updateTimer.start(
             std::chrono::milliseconds(16),
-            Timer::PeriodType::ABSOLUTE,
-            Timer::FOREVER,
+            sssdkCommon::WheelTimer::PeriodType::ABSOLUTE,
+            sssdkCommon::WheelTimer::FOREVER,
             std::bind(&AplClientBridge::onUpdateTimer, this));
     });
 }
@@ -182,6 +218,11 @@ void AplClientBridge::onUpdateTimer() {
     m_executor.submit([this] {
         m_renderQueued = false;
         m_aplClient->onUpdateTick();
+
+        if (!m_parameters.traceOutputPath.empty() &&
+            APLClient::AplTraceRecorder::getInstance().dumpIfRequested(m_parameters.traceOutputPath)) {
+            ACSDK_INFO(LX("aplTraceDumped").d("path", m_parameters.traceOutputPath));
+        }
     });
 }
 
@@ -197,15 +238,16 @@ void AplClientBridge::renderDocument(
     m_executor.submit([this, jsonPayload, token, windowId] {
         m_windowId = windowId;
 
-        rapidjson::Document document;
-        if (document.Parse(jsonPayload).HasParseError()) {
+        // The sections are passed on as they appear in the payload, APL Core parses them again anyway.
+        sssdkCommon::JsonMembers members;
+        if (!sssdkCommon::scanJsonMembers(jsonPayload, RENDER_DOCUMENT_SECTIONS, true, &members)) {
             ACSDK_ERROR(LX("renderDocumentFailed").d("reason", "Failed to parse document"));
             m_guiManager->handleRenderDocumentResult(token, false, "Unable to create content");
             return;
         }
 
         m_aplClient->renderDocument(
-            extractDocument(document), extractData(document), extractSupportedViewports(document), token);
+            extractDocument(members), extractData(members), extractSupportedViewports(members), token);
     });
 }
 
@@ -246,45 +288,34 @@ void AplClientBridge::onRenderingEvent(APLClient::AplRenderingEvent event) {
     m_executor.submit([this, event] { m_guiManager->handleAPLEvent(event); });
 }
 
-std::string AplClientBridge::extractDocument(const rapidjson::Document& document) {
-    if (!document.HasMember("document")) {
+std::string AplClientBridge::extractDocument(const sssdkCommon::JsonMembers& members) {
+    auto it = members.find(DOCUMENT_SECTION);
+    if (it == members.end()) {
         ACSDK_ERROR(LX("extractDocumentFailed").d("reason", "Failed to extract document"));
         return DEFAULT_PARAM_VALUE;
     }
 
-    rapidjson::StringBuffer sb;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-    document["document"].Accept(writer);
-    return sb.GetString();
+    return it->second.json;
 }
 
-std::string AplClientBridge::extractData(const rapidjson::Document& document) {
-    if (!document.HasMember("datasources")) {
+std::string AplClientBridge::extractData(const sssdkCommon::JsonMembers& members) {
+    auto it = members.find(DATASOURCES_SECTION);
+    if (it == members.end()) {
         ACSDK_WARN(LX("extractDataFailed").d("reason", "Failed to extract data"));
         return DEFAULT_PARAM_VALUE;
     }
 
-    rapidjson::StringBuffer sb;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-    document["datasources"].Accept(writer);
-    return sb.GetString();
-    return sb.GetString();
+    return it->second.json;
 }
 
-std::string AplClientBridge::extractSupportedViewports(const rapidjson::Document& document) {
-    std::string jsonData;
-    rapidjson::Value::ConstMemberIterator jsonIt;
-    if (!document.HasMember("supportedViewports")) {
+std::string AplClientBridge::extractSupportedViewports(const sssdkCommon::JsonMembers& members) {
+    auto it = members.find(SUPPORTED_VIEWPORTS_SECTION);
+    if (it == members.end()) {
         ACSDK_WARN(LX("extractSupportedViewportsFailed").d("reason", "Failed to retrieve supportedViewports data"));
-        jsonData = DEFAULT_PARAM_VALUE;
-    } else {
-        rapidjson::StringBuffer sb;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-        document["supportedViewports"].Accept(writer);
-        jsonData = sb.GetString();
+        return DEFAULT_PARAM_VALUE;
     }
 
-    return jsonData;
+    return it->second.json;
 }
 
 int AplClientBridge::getMaxNumberOfConcurrentDownloads() {
@@ -19,6 +19,7 @@
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 
 #include "SampleApp/CachingDownloadManager.h"
+#include "SampleApp/DownloadContentSink.h"
 
 #include <RegistrationManager/CustomerDataManager.h>
 
@@ -28,20 +29,12 @@ namespace sampleApp {
 static const std::string TAG{"CachingDownloadManager"};
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-using namespace alexaClientSDK::avsCommon::avs::attachment;
 using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 using namespace alexaClientSDK::avsCommon::utils::json;
 using namespace alexaClientSDK::avsCommon::utils::libcurlUtils;
-using namespace alexaClientSDK::avsCommon::utils::sds;
 
-/// Process attachment ID
-static const std::string PROCESS_ATTACHMENT_ID = "import_download:";
-/// A wait period for a polling loop that constantly check if a content fetcher finished fetching the payload or failed.
-static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT{100};
 /// Timeout to wait for am item to arrive from the content fetcher
 static const std::chrono::minutes FETCH_TIMEOUT{5};
-/// The number of bytes read from the attachment with each read in the read loop.
-static const size_t CHUNK_SIZE(1024);
 /// Component name for SmartScreenSampleApp
 static const std::string COMPONENT_NAME = "SmartScreenSampleApp";
 /// Table name for APL packages
@@ -56,11 +49,13 @@ CachingDownloadManager::CachingDownloadManager(
     unsigned long cachePeriodInSeconds,
     unsigned long maxCacheSize,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface> miscStorage,
-    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager) :
+    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+    size_t downloadChunkSize) :
         CustomerDataHandler{customerDataManager},
         m_contentFetcherFactory{httpContentFetcherInterfaceFactoryInterface},
         m_cachePeriod{std::chrono::seconds(cachePeriodInSeconds)},
         m_maxCacheSize{maxCacheSize},
+        m_downloadChunkSize{downloadChunkSize},
         m_miscStorage(miscStorage) {
     bool doesTableExist = false;
     if (!m_miscStorage->tableExists(COMPONENT_NAME, TABLE_NAME, &doesTableExist)) {
@@ -206,76 +201,31 @@ std::string CachingDownloadManager::downloadFromSource(const std::string& source
                      .sensitive("url", source)
                      .m("headersReceived"));
 
-    auto stream = std::make_shared<InProcessAttachment>(PROCESS_ATTACHMENT_ID);
-    std::shared_ptr<AttachmentWriter> streamWriter = stream->createWriter(WriterPolicy::BLOCKING);
+    size_t expectedSize = header.contentLength > 0 ? static_cast<size_t>(header.contentLength) : 0;
+    auto sink = std::make_shared<DownloadContentSink>(expectedSize, m_downloadChunkSize);
+    auto bodyDone = sink->getCompletionFuture();
 
-    if (!contentFetcher->getBody(streamWriter)) {
+    if (!contentFetcher->getBody(sink)) {
         ACSDK_ERROR(LX("downloadFromSourceFailed").d("reason", "getBodyFailed"));
         return "";
     }
 
-    auto startTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::steady_clock::now() - startTime;
-    HTTPContentFetcherInterface::State contentFetcherState = contentFetcher->getState();
-    while ((FETCH_TIMEOUT > elapsedTime) && (HTTPContentFetcherInterface::State::BODY_DONE != contentFetcherState) &&
-           (HTTPContentFetcherInterface::State::ERROR != contentFetcherState)) {
-        std::this_thread::sleep_for(WAIT_FOR_ACTIVITY_TIMEOUT);
-        elapsedTime = std::chrono::steady_clock::now() - startTime;
-        contentFetcherState = contentFetcher->getState();
-    }
-
-    if (FETCH_TIMEOUT <= elapsedTime) {
+    // The fetcher closes its writer when the transfer ends, whether it succeeded or failed.
+    if (bodyDone.wait_for(FETCH_TIMEOUT) != std::future_status::ready) {
         ACSDK_ERROR(LX("downloadFromSourceFailed").d("reason", "waitTimeout"));
         return "";
     }
 
-    if (HTTPContentFetcherInterface::State::ERROR == contentFetcherState) {
+    if (DownloadContentSink::Status::COMPLETE != bodyDone.get()) {
         ACSDK_ERROR(LX("downloadFromSourceFailed").d("reason", "receivingBodyFailed"));
         return "";
     }
 
-    std::unique_ptr<AttachmentReader> reader = stream->createReader(ReaderPolicy::NONBLOCKING);
-
-    std::string content;
-    auto readStatus = AttachmentReader::ReadStatus::OK;
-    std::vector<char> buffer(CHUNK_SIZE, 0);
-    bool streamClosed = false;
-    AttachmentReader::ReadStatus previousStatus = AttachmentReader::ReadStatus::OK_TIMEDOUT;
-    ssize_t bytesReadSoFar = 0;
-    ssize_t bytesRead = -1;
-    while (!streamClosed && bytesRead != 0) {
-        bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
-        bytesReadSoFar += bytesRead;
-        if (previousStatus != readStatus) {
-            ACSDK_DEBUG9(LX(__func__).d("readStatus", readStatus));
-            previousStatus = readStatus;
-        }
-        switch (readStatus) {
-            case AttachmentReader::ReadStatus::CLOSED:
-                streamClosed = true;
-                if (bytesRead == 0) {
-                    break;
-                }
-                /* FALL THROUGH - to add any data received even if closed */
-            case AttachmentReader::ReadStatus::OK:
-            case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
-            case AttachmentReader::ReadStatus::OK_TIMEDOUT:
-                content.append(buffer.data(), bytesRead);
-                break;
-            case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
-                // Current AttachmentReader policy renders this outcome impossible.
-                ACSDK_ERROR(LX("downloadFromSourceFailed").d("reason", "overrunReset"));
-                break;
-            case AttachmentReader::ReadStatus::ERROR_OVERRUN:
-            case AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
-            case AttachmentReader::ReadStatus::ERROR_INTERNAL:
-                ACSDK_ERROR(LX("downloadFromSourceFailed").d("reason", "readError"));
-                return "";
-        }
-        if (0 == bytesRead) {
-            ACSDK_DEBUG9(LX("downloadFromSource").m("alreadyReadAllBytes"));
-        }
-    }
+    auto content = sink->takeContent();
+    ACSDK_DEBUG9(LX("downloadFromSource")
+                     .d("expectedSize", header.contentLength)
+                     .d("receivedSize", content.size())
+                     .m("bodyReceived"));
 
     ACSDK_DEBUG9(LX("downloadFromSource").d("URL", contentFetcher->getUrl()));
 
@@ -0,0 +1,98 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "SampleApp/DownloadContentSink.h"
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+static const std::string TAG{"DownloadContentSink"};
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+DownloadContentSink::DownloadContentSink(size_t expectedSize, size_t chunkSize) :
+        m_expectedSize{expectedSize},
+        m_chunkSize{std::max<size_t>(chunkSize, 1)},
+        m_closed{false},
+        m_completionFuture{m_completionPromise.get_future().share()} {
+    m_content.reserve(expectedSize > 0 ? expectedSize : m_chunkSize);
+}
+
+DownloadContentSink::~DownloadContentSink() {
+    close();
+}
+
+std::size_t DownloadContentSink::write(
+    const void* buf,
+    std::size_t numBytes,
+    WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_closed) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "sinkClosed"));
+        if (writeStatus) {
+            *writeStatus = WriteStatus::CLOSED;
+        }
+        return 0;
+    }
+
+    auto required = m_content.size() + numBytes;
+    if (required > m_content.capacity()) {
+        m_content.reserve(std::max(required, m_content.capacity() + m_chunkSize));
+    }
+    m_content.append(static_cast<const char*>(buf), numBytes);
+
+    if (writeStatus) {
+        *writeStatus = WriteStatus::OK;
+    }
+    return numBytes;
+}
+
+void DownloadContentSink::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_closed) {
+        return;
+    }
+    m_closed = true;
+    // The fetcher closes the writer on failures too, so a body of a known size must have fully arrived.
+    auto status = m_content.size() < m_expectedSize ? Status::INCOMPLETE : Status::COMPLETE;
+    if (Status::INCOMPLETE == status) {
+        ACSDK_WARN(LX("closed")
+                       .d("reason", "bodyIncomplete")
+                       .d("expectedSize", m_expectedSize)
+                       .d("receivedSize", m_content.size()));
+    }
+    m_completionPromise.set_value(status);
+}
+
+std::shared_future<DownloadContentSink::Status> DownloadContentSink::getCompletionFuture() const {
+    return m_completionFuture;
+}
+
+std::string DownloadContentSink::takeContent() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::move(m_content);
+}
+
+size_t DownloadContentSink::getBytesWritten() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_content.size();
+}
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
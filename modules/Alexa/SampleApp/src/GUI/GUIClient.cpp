@@ -13,8 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <APLClient/AplTrace.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
-#include <AVSCommon/Utils/Timing/Timer.h>
 
 #include <Utils/SmartScreenSDKVersion.h>
 #include <RegistrationManager/CustomerDataManager.h>
@@ -112,6 +112,9 @@ static const std::string EVENT_TAG("event");
 /// The drop frame count json key in the message.
 static const std::string DROP_FRAME_COUNT_TAG("dropFrameCount");
 
+/// The audioItemId json key in the RenderPlayerInfo payload.
+static const std::string AUDIO_ITEM_ID_TAG("audioItemId");
+
 /// Interface name to use for focus requests.
 static const std::string APL_INTERFACE("Alexa.Presentation.APL");
 
@@ -139,18 +142,22 @@ static const std::string APPCONFIG_CONFIGURATION_ROOT_KEY = "appConfig";
 /// One second Autorelease timeout
 static const std::chrono::seconds AUTORELEASE_DURATION{1};
 
+/// Number of initRequests sent on a connection before they are no longer repeated.
+static const int MAX_INIT_REQUEST_ATTEMPTS = 5;
+
 namespace alexaSmartScreenSDK {
 namespace sampleApp {
 namespace gui {
 
 using namespace alexaClientSDK::avsCommon::utils::json;
-using namespace alexaClientSDK::avsCommon::utils::timing;
 using namespace alexaClientSDK::avsCommon::sdkInterfaces::storage;
 
 using namespace smartScreenSDKInterfaces;
 using namespace smartScreenCapabilityAgents::alexaPresentation;
 using namespace smartScreenCapabilityAgents::templateRuntime;
 
+const std::chrono::milliseconds GUIClient::DEFAULT_INIT_RESPONSE_TIMEOUT{2000};
+
 /**
  * Save APLMaxVersion persistently.
  *
@@ -222,10 +229,55 @@ static std::string getAPLMaxVersionFromStorage(const std::shared_ptr<MiscStorage
     return APLMaxVersion;
 }
 
+/**
+ * Finds the top level members of a RenderPlayerInfo payload which differ from the previous payload for the same audio
+ * item.
+ *
+ * @param previousPayload The previous payload.
+ * @param payload The new payload.
+ * @param[out] changedMembers The changed members as a JSON object, empty if no member changed.
+ * @return @c false if the payloads cannot be compared, or a member of the previous payload is missing from the new one.
+ */
+static bool getChangedPayloadMembers(
+    const std::string& previousPayload,
+    const rapidjson::Value& payload,
+    std::string* changedMembers) {
+    rapidjson::Document previous;
+    if (previous.Parse(previousPayload).HasParseError() || !previous.IsObject()) {
+        return false;
+    }
+    for (auto& member : previous.GetObject()) {
+        if (!payload.HasMember(member.name)) {
+            return false;
+        }
+    }
+
+    rapidjson::Document changed(rapidjson::kObjectType);
+    for (auto& member : payload.GetObject()) {
+        auto previousMember = previous.FindMember(member.name);
+        if (previousMember == previous.MemberEnd() || previousMember->value != member.value) {
+            changed.AddMember(
+                rapidjson::Value(member.name, changed.GetAllocator()),
+                rapidjson::Value(member.value, changed.GetAllocator()),
+                changed.GetAllocator());
+        }
+    }
+
+    changedMembers->clear();
+    if (changed.MemberCount() > 0) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        changed.Accept(writer);
+        changedMembers->assign(buffer.GetString(), buffer.GetSize());
+    }
+    return true;
+}
+
 std::shared_ptr<GUIClient> GUIClient::create(
     std::shared_ptr<MessagingServerInterface> serverImplementation,
     const std::shared_ptr<MiscStorageInterface>& miscStorage,
-    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager) {
+    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+    std::chrono::milliseconds initResponseTimeout) {
     if (!serverImplementation) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullServerImplementation"));
         return nullptr;
@@ -246,20 +298,24 @@ std::shared_ptr<GUIClient> GUIClient::create(
     }
 
     return std::shared_ptr<GUIClient>(
-        new GUIClient(serverImplementation, miscStorage, APLMaxVersion, customerDataManager));
+        new GUIClient(serverImplementation, miscStorage, APLMaxVersion, customerDataManager, initResponseTimeout));
 }
 
 GUIClient::GUIClient(
     std::shared_ptr<MessagingServerInterface> serverImplementation,
     const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface>& miscStorage,
     const std::string& APLMaxVersion,
-    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager) :
+    const std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManager> customerDataManager,
+    std::chrono::milliseconds initResponseTimeout) :
         RequiresShutdown{"GUIClient"},
         CustomerDataHandler{customerDataManager},
         m_serverImplementation{serverImplementation},
         m_hasServerStarted{false},
         m_initMessageReceived{false},
         m_errorState{false},
+        m_initHandshakePending{false},
+        m_initRequestAttempts{0},
+        m_initResponseTimeout{initResponseTimeout},
         m_APLMaxVersion{APLMaxVersion},
         m_shouldRestart{false},
         m_miscStorage{miscStorage},
@@ -304,6 +360,7 @@ GUIClient::GUIClient(
 void GUIClient::doShutdown() {
     ACSDK_DEBUG3(LX(__func__));
     stop();
+    m_initResponseTimer.stop();
     m_executor.shutdown();
     m_guiManager.reset();
     m_aplClientBridge.reset();
@@ -753,12 +810,14 @@ void GUIClient::setObserver(const std::shared_ptr<MessagingServerObserverInterfa
 
 void GUIClient::onConnectionOpened() {
     ACSDK_DEBUG3(LX("onConnectionOpened"));
+    // A newly connected client displays no player info card yet.
+    resetPlayerInfoCard();
     m_executor.submit([this]() {
-        if (!m_initThread.joinable()) {
-            m_initThread = std::thread(&GUIClient::sendInitRequestAndWait, this);
-        } else {
-            ACSDK_INFO(LX("onConnectionOpened").m("init thread is not avilable"));
-        }
+        // The connection is established, so the handshake starts right away and answers arrive on the executor.
+        m_initHandshakeStart = std::chrono::steady_clock::now();
+        m_initHandshakePending = true;
+        m_initRequestAttempts = 0;
+        executeSendInitRequest();
 
         if (m_observer) {
             m_observer->onConnectionOpened();
@@ -773,9 +832,8 @@ void GUIClient::onConnectionClosed() {
             m_initMessageReceived = false;
         }
 
-        if (m_initThread.joinable()) {
-            m_initThread.join();
-        }
+        m_initHandshakePending = false;
+        m_initResponseTimer.stop();
 
         if (m_observer) {
             m_observer->onConnectionClosed();
@@ -827,12 +885,47 @@ void GUIClient::renderPlayerInfoCard(
     const std::string& jsonPayload,
     smartScreenSDKInterfaces::AudioPlayerInfo info,
     alexaClientSDK::avsCommon::avs::FocusState focusState) {
-    auto message = messages::RenderPlayerInfoMessage(jsonPayload, info);
-    sendMessage(message);
+    std::unique_lock<std::mutex> lock{m_playerInfoMutex};
+    if (!m_playerInfoAudioItemId.empty() && jsonPayload == m_playerInfoPayload) {
+        // Only the state or offset changed, the client already has the rest of the card.
+        auto message = messages::PlayerInfoUpdateMessage(m_playerInfoAudioItemId, info, "");
+        lock.unlock();
+        sendMessage(message);
+        return;
+    }
+
+    std::string audioItemId;
+    std::string changedMembers;
+    rapidjson::Document payload;
+    bool isSameItem = false;
+    if (!payload.Parse(jsonPayload).HasParseError() && payload.IsObject()) {
+        jsonUtils::retrieveValue(payload, AUDIO_ITEM_ID_TAG, &audioItemId);
+        isSameItem = !audioItemId.empty() && audioItemId == m_playerInfoAudioItemId &&
+                     getChangedPayloadMembers(m_playerInfoPayload, payload, &changedMembers);
+    }
+    m_playerInfoAudioItemId = audioItemId;
+    m_playerInfoPayload = jsonPayload;
+    lock.unlock();
+
+    if (isSameItem) {
+        // A new RenderPlayerInfo for the displayed item, e.g. after a control was toggled or the metadata changed.
+        auto message = messages::PlayerInfoUpdateMessage(audioItemId, info, changedMembers);
+        sendMessage(message);
+    } else {
+        auto message = messages::RenderPlayerInfoMessage(jsonPayload, info);
+        sendMessage(message);
+    }
+}
+
+void GUIClient::resetPlayerInfoCard() {
+    std::lock_guard<std::mutex> lock{m_playerInfoMutex};
+    m_playerInfoAudioItemId.clear();
+    m_playerInfoPayload.clear();
 }
 
 void GUIClient::clearPlayerInfoCard() {
     ACSDK_DEBUG5(LX("clearPlayerInfoCard"));
+    resetPlayerInfoCard();
 
     auto message = messages::ClearPlayerInfoCardMessage();
     sendMessage(message);
@@ -865,29 +958,32 @@ SampleAppReturnCode GUIClient::run() {
                            : (m_errorState ? SampleAppReturnCode::ERROR : SampleAppReturnCode::OK);
 }
 
-void GUIClient::sendInitRequestAndWait() {
-    // Wait for server to be ready
-    ACSDK_DEBUG9(LX("sendInitRequestAndWait").m("waiting for server to be ready"));
-    while (!m_serverImplementation->isReady()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
+void GUIClient::executeSendInitRequest() {
+    // The timer may still be finishing the previous timeout, it only restarts once stopped.
+    m_initResponseTimer.stop();
 
-    // Send init request message.
+    m_initRequestAttempts++;
+    ACSDK_DEBUG3(LX("executeSendInitRequest").d("attempt", m_initRequestAttempts));
     auto message = messages::InitRequestMessage(alexaSmartScreenSDK::utils::smartScreenSDKVersion::getCurrentVersion());
-    sendMessage(message);
+    executeSendMessage(message);
 
-    // Wait for response
-    std::unique_lock<std::mutex> lock(m_mutex);
-    ACSDK_DEBUG3(LX("start").m("waiting for InitResponse"));
-    m_cond.wait(lock, [this] {
-        ACSDK_DEBUG9(LX("sendInitRequestAndWait")
-                         .d("errorState", m_errorState)
-                         .d("initMessage received", m_initMessageReceived));
-        return m_errorState || m_initMessageReceived;
-    });
+    m_initResponseTimer.start(
+        m_initResponseTimeout, [this]() { m_executor.submit([this]() { executeOnInitResponseTimeout(); }); });
+}
+
+void GUIClient::executeOnInitResponseTimeout() {
+    if (!m_initHandshakePending) {
+        return;
+    }
+
+    if (m_initRequestAttempts >= MAX_INIT_REQUEST_ATTEMPTS) {
+        // The handshake stays pending, so an initResponse arriving later still completes it.
+        ACSDK_ERROR(LX("initRequestFailed").d("reason", "initResponseTimedOut").d("attempts", m_initRequestAttempts));
+        return;
+    }
 
-    ACSDK_DEBUG3(LX("start").m("InitResponse received"));
-    m_aplClientBridge->onConnectionOpened();
+    ACSDK_WARN(LX("initResponseTimedOut").d("attempt", m_initRequestAttempts));
+    executeSendInitRequest();
 }
 
 void GUIClient::executeSendGuiConfiguration() {
@@ -920,6 +1016,9 @@ void GUIClient::executeSendGuiConfiguration() {
 }
 
 bool GUIClient::executeProcessInitResponse(const rapidjson::Document& message) {
+    // Any answer stops the initRequest from being repeated, a rejected one is not asked again.
+    m_initResponseTimer.stop();
+
     bool isSupported;
     if (!jsonUtils::retrieveValue(message, IS_SUPPORTED_TAG, &isSupported)) {
         ACSDK_ERROR(LX("processInitResponseFailed").d("reason", "isSupportedNotFound"));
@@ -958,8 +1057,15 @@ bool GUIClient::executeProcessInitResponse(const rapidjson::Document& message) {
 
     ACSDK_INFO(LX("executeProcessInitResponse").d("APL Max Version", m_APLMaxVersion));
     m_cond.notify_all();
-    if (m_initThread.joinable()) {
-        m_initThread.join();
+    if (m_initHandshakePending) {
+        m_initHandshakePending = false;
+        ACSDK_INFO(LX("guiInitHandshake")
+                       .d("durationMs",
+                          std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - m_initHandshakeStart)
+                              .count())
+                       .d("attempts", m_initRequestAttempts));
+        m_aplClientBridge->onConnectionOpened();
     }
     executeSendGuiConfiguration();
     return true;
@@ -994,8 +1100,7 @@ void GUIClient::ProxyFocusObserver::onFocusChanged(
 }
 
 void GUIClient::startAutoreleaseTimer(const APLToken token, const std::string& channelName) {
-    std::shared_ptr<alexaClientSDK::avsCommon::utils::timing::Timer> timer =
-        std::make_shared<alexaClientSDK::avsCommon::utils::timing::Timer>();
+    auto timer = std::make_shared<sssdkCommon::WheelTimer>();
     {
         std::lock_guard<std::mutex> lock{m_mapMutex};
         m_autoReleaseTimers[token] = timer;
@@ -1008,7 +1113,7 @@ void GUIClient::autoRelease(const APLToken token, const std::string& channelName
     ACSDK_DEBUG5(LX("autoRelease").d("token", token).d("channelName", channelName));
     m_executor.submit([this, token, channelName]() {
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ChannelObserverInterface> focusObserver;
-        std::shared_ptr<alexaClientSDK::avsCommon::utils::timing::Timer> autoReleaseTimer;
+        std::shared_ptr<sssdkCommon::WheelTimer> autoReleaseTimer;
         {
             std::lock_guard<std::mutex> lock{m_mapMutex};
             focusObserver = m_focusObservers[token];
@@ -1051,6 +1156,7 @@ void GUIClient::writeMessage(const std::string& payload) {
 }
 
 void GUIClient::executeWriteMessage(const std::string& payload) {
+    APL_TRACE_SCOPE("webSocketSend", "gui");
     m_serverImplementation->writeMessage(payload);
 }
 
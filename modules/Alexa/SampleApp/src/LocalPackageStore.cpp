@@ -0,0 +1,250 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include <APLClient/AplImportSource.h>
+
+#include "SampleApp/LocalPackageStore.h"
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+static const std::string TAG{"LocalPackageStore"};
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+const std::string LocalPackageStore::DEFAULT_IMPORT_BASE_URL = APLClient::ALEXA_IMPORT_BASE_URL;
+
+/// Scheme prefix for local file sources.
+static const std::string FILE_SCHEME = "file://";
+/// File name of a package document inside its versioned directory.
+static const std::string PACKAGE_DOCUMENT_NAME = APLClient::ALEXA_IMPORT_DOCUMENT_NAME;
+/// Path separator.
+static const char PATH_SEPARATOR = '/';
+/// Permissions for directories created by the store.
+static const mode_t DIRECTORY_PERMISSIONS = 0755;
+/// Bundle key for the package array.
+static const char BUNDLE_PACKAGES_KEY[] = "packages";
+/// Bundle key for the package name.
+static const char BUNDLE_NAME_KEY[] = "name";
+/// Bundle key for the package version.
+static const char BUNDLE_VERSION_KEY[] = "version";
+/// Bundle key for the package document.
+static const char BUNDLE_DOCUMENT_KEY[] = "document";
+
+/**
+ * Checks that a string is usable as a single path segment, i.e. it is not empty, does not contain separators and does
+ * not refer to a parent directory.
+ *
+ * @param segment The string to check.
+ * @return Whether the string is a valid path segment.
+ */
+static bool isValidPathSegment(const std::string& segment) {
+    return !segment.empty() && segment != "." && segment != ".." && segment.find(PATH_SEPARATOR) == std::string::npos &&
+           segment.find('\\') == std::string::npos;
+}
+
+/**
+ * Creates a directory if it does not already exist.
+ *
+ * @param path The directory path.
+ * @return Whether the directory exists after the call.
+ */
+static bool makeDirectory(const std::string& path) {
+    if (mkdir(path.c_str(), DIRECTORY_PERMISSIONS) == 0 || errno == EEXIST) {
+        return true;
+    }
+    ACSDK_ERROR(LX("makeDirectoryFailed").d("path", path).d("errno", errno));
+    return false;
+}
+
+std::shared_ptr<LocalPackageStore> LocalPackageStore::create(
+    const std::string& rootPath,
+    const std::string& importBaseUrl) {
+    if (rootPath.empty()) {
+        ACSDK_DEBUG5(LX("createFailed").d("reason", "emptyRootPath"));
+        return nullptr;
+    }
+
+    std::string normalizedRoot = rootPath;
+    while (normalizedRoot.size() > 1 && normalizedRoot.back() == PATH_SEPARATOR) {
+        normalizedRoot.pop_back();
+    }
+
+    if (!makeDirectory(normalizedRoot)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unableToCreateRoot").d("path", normalizedRoot));
+        return nullptr;
+    }
+
+    return std::shared_ptr<LocalPackageStore>(new LocalPackageStore(normalizedRoot, importBaseUrl));
+}
+
+LocalPackageStore::LocalPackageStore(const std::string& rootPath, const std::string& importBaseUrl) :
+        m_rootPath{rootPath},
+        m_importBaseUrl{importBaseUrl} {
+}
+
+bool LocalPackageStore::getPackageBySource(const std::string& source, std::string* content) {
+    if (source.compare(0, FILE_SCHEME.size(), FILE_SCHEME) == 0) {
+        auto path = source.substr(FILE_SCHEME.size());
+        auto rootPrefix = m_rootPath + PATH_SEPARATOR;
+        if (path.compare(0, rootPrefix.size(), rootPrefix) != 0 || path.find("/../") != std::string::npos) {
+            ACSDK_WARN(LX("getPackageBySourceFailed").d("reason", "fileOutsideStore").sensitive("source", source));
+            return false;
+        }
+        return readFile(path, content);
+    }
+
+    if (m_importBaseUrl.empty() || source.compare(0, m_importBaseUrl.size(), m_importBaseUrl) != 0) {
+        return false;
+    }
+
+    // Expecting "<name>/<version>/document.json" after the base URL.
+    auto relative = source.substr(m_importBaseUrl.size());
+    auto nameEnd = relative.find(PATH_SEPARATOR);
+    if (nameEnd == std::string::npos) {
+        return false;
+    }
+    auto versionEnd = relative.find(PATH_SEPARATOR, nameEnd + 1);
+    if (versionEnd == std::string::npos || relative.substr(versionEnd + 1) != PACKAGE_DOCUMENT_NAME) {
+        return false;
+    }
+
+    return getPackage(
+        relative.substr(0, nameEnd), relative.substr(nameEnd + 1, versionEnd - nameEnd - 1), content);
+}
+
+bool LocalPackageStore::getPackage(const std::string& name, const std::string& version, std::string* content) {
+    std::string path;
+    if (!getPackagePath(name, version, &path)) {
+        return false;
+    }
+
+    if (!readFile(path, content)) {
+        ACSDK_DEBUG9(LX("getPackage").d("name", name).d("version", version).m("notInStore"));
+        return false;
+    }
+
+    ACSDK_DEBUG9(LX("getPackage").d("name", name).d("version", version).m("resolvedFromStore"));
+    return true;
+}
+
+bool LocalPackageStore::putPackage(const std::string& name, const std::string& version, const std::string& content) {
+    std::string path;
+    if (!getPackagePath(name, version, &path)) {
+        ACSDK_ERROR(LX("putPackageFailed").d("reason", "invalidNameOrVersion").d("name", name).d("version", version));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto packageDirectory = m_rootPath + PATH_SEPARATOR + name;
+    auto versionDirectory = packageDirectory + PATH_SEPARATOR + version;
+    if (!makeDirectory(packageDirectory) || !makeDirectory(versionDirectory)) {
+        return false;
+    }
+
+    // Write to a temporary file first so readers never observe a partially written package.
+    auto temporaryPath = path + ".tmp";
+    {
+        std::ofstream outputFile(temporaryPath, std::ofstream::binary | std::ofstream::trunc);
+        if (!outputFile.good()) {
+            ACSDK_ERROR(LX("putPackageFailed").d("reason", "openFailed").d("path", temporaryPath));
+            return false;
+        }
+        outputFile.write(content.data(), content.size());
+        if (!outputFile.good()) {
+            ACSDK_ERROR(LX("putPackageFailed").d("reason", "writeFailed").d("path", temporaryPath));
+            return false;
+        }
+    }
+
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        ACSDK_ERROR(LX("putPackageFailed").d("reason", "renameFailed").d("path", path));
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+
+    ACSDK_DEBUG5(LX("putPackage").d("name", name).d("version", version));
+    return true;
+}
+
+int LocalPackageStore::importBundle(const std::string& bundlePath) {
+    std::string bundleContent;
+    if (!readFile(bundlePath, &bundleContent)) {
+        ACSDK_ERROR(LX("importBundleFailed").d("reason", "unableToReadBundle").d("path", bundlePath));
+        return 0;
+    }
+
+    rapidjson::Document bundle;
+    if (bundle.Parse(bundleContent).HasParseError() || !bundle.IsObject() || !bundle.HasMember(BUNDLE_PACKAGES_KEY) ||
+        !bundle[BUNDLE_PACKAGES_KEY].IsArray()) {
+        ACSDK_ERROR(LX("importBundleFailed").d("reason", "invalidBundle").d("path", bundlePath));
+        return 0;
+    }
+
+    int imported = 0;
+    for (auto& package : bundle[BUNDLE_PACKAGES_KEY].GetArray()) {
+        if (!package.IsObject() || !package.HasMember(BUNDLE_NAME_KEY) || !package[BUNDLE_NAME_KEY].IsString() ||
+            !package.HasMember(BUNDLE_VERSION_KEY) || !package[BUNDLE_VERSION_KEY].IsString() ||
+            !package.HasMember(BUNDLE_DOCUMENT_KEY) || !package[BUNDLE_DOCUMENT_KEY].IsObject()) {
+            ACSDK_WARN(LX("importBundle").d("reason", "invalidPackageEntry").m("skipping"));
+            continue;
+        }
+
+        rapidjson::StringBuffer sb;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+        package[BUNDLE_DOCUMENT_KEY].Accept(writer);
+
+        if (putPackage(package[BUNDLE_NAME_KEY].GetString(), package[BUNDLE_VERSION_KEY].GetString(), sb.GetString())) {
+            imported++;
+        }
+    }
+
+    ACSDK_INFO(LX("importBundle").d("path", bundlePath).d("imported", imported));
+    return imported;
+}
+
+bool LocalPackageStore::getPackagePath(const std::string& name, const std::string& version, std::string* path) {
+    if (!isValidPathSegment(name) || !isValidPathSegment(version)) {
+        return false;
+    }
+    *path = m_rootPath + PATH_SEPARATOR + name + PATH_SEPARATOR + version + PATH_SEPARATOR + PACKAGE_DOCUMENT_NAME;
+    return true;
+}
+
+bool LocalPackageStore::readFile(const std::string& path, std::string* content) {
+    std::ifstream inputFile(path, std::ifstream::binary);
+    if (!inputFile.good()) {
+        return false;
+    }
+
+    std::ostringstream buffer;
+    buffer << inputFile.rdbuf();
+    *content = buffer.str();
+    return !content->empty();
+}
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <cstring>
 #include <string>
 
@@ -20,6 +21,7 @@
 
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <SSSDKCommon/AudioFileUtil.h>
 #include "SampleApp/PortAudioMicrophoneWrapper.h"
 #include "SampleApp/ConsolePrinter.h"
 
@@ -37,6 +39,30 @@ static const unsigned long PREFERRED_SAMPLES_PER_CALLBACK = paFramesPerBufferUns
 static const std::string SAMPLE_APP_CONFIG_ROOT_KEY("sampleApp");
 static const std::string PORTAUDIO_CONFIG_ROOT_KEY("portAudio");
 static const std::string PORTAUDIO_CONFIG_SUGGESTED_LATENCY_KEY("suggestedLatency");
+static const std::string PORTAUDIO_CONFIG_FRAMES_PER_BUFFER_KEY("framesPerBuffer");
+static const std::string PORTAUDIO_CONFIG_RING_BUFFER_SAMPLES_KEY("ringBufferSamples");
+static const std::string PORTAUDIO_CONFIG_REPLAY_FILE_KEY("replayFile");
+
+/// Default size of the staging ring, one second of audio.
+static const int DEFAULT_RING_BUFFER_SAMPLES = 16000;
+
+/// Number of samples per millisecond.
+static const unsigned long SAMPLES_PER_MS = 16;
+
+/// Samples per buffer of the replayed file when the frames per buffer are unspecified, 10 ms of audio.
+static const unsigned long DEFAULT_REPLAY_SAMPLES_PER_BUFFER = 160;
+
+/// Feeder interval when the frames per buffer are unspecified.
+static const std::chrono::microseconds DEFAULT_FEEDER_INTERVAL{5000};
+
+/// Shortest feeder interval.
+static const std::chrono::microseconds MIN_FEEDER_INTERVAL{1000};
+
+/// Number of replayed buffers whose capture times are kept until they reach the shared data stream.
+static const size_t REPLAY_CAPTURE_TIMES = 1024;
+
+/// Duration type of the measured latencies.
+using Microseconds = std::chrono::duration<double, std::micro>;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("PortAudioMicrophoneWrapper");
@@ -63,13 +89,75 @@ std::unique_ptr<PortAudioMicrophoneWrapper> PortAudioMicrophoneWrapper::create(
 }
 
 PortAudioMicrophoneWrapper::PortAudioMicrophoneWrapper(std::shared_ptr<AudioInputStream> stream) :
-        m_audioInputStream{stream}, m_paStream{nullptr}, m_isStreaming{false} {
+        m_audioInputStream{stream},
+        m_paStream{nullptr},
+        m_isStreaming{false},
+        m_framesPerBuffer{PREFERRED_SAMPLES_PER_CALLBACK},
+        m_feederInterval{DEFAULT_FEEDER_INTERVAL},
+        m_isFeederRunning{false},
+        m_ringOverruns{0},
+        m_droppedSamples{0},
+        m_inputOverflows{0},
+        m_inputUnderflows{0},
+        m_streamWriteFailures{0},
+        m_isReplayRunning{false},
+        m_capturedSamples{0},
+        m_writtenSamples{0},
+        m_hasPendingCaptureTime{false} {
 }
 
 PortAudioMicrophoneWrapper::~PortAudioMicrophoneWrapper() {
-    Pa_StopStream(m_paStream);
-    Pa_CloseStream(m_paStream);
-    Pa_Terminate();
+    if (m_replaySamples.empty()) {
+        Pa_StopStream(m_paStream);
+        Pa_CloseStream(m_paStream);
+        Pa_Terminate();
+    } else {
+        m_isReplayRunning = false;
+        if (m_replayThread.joinable()) {
+            m_replayThread.join();
+        }
+    }
+    stopFeeder();
+}
+
+void PortAudioMicrophoneWrapper::readConfig() {
+    auto config = avsCommon::utils::configuration::ConfigurationNode::getRoot()[SAMPLE_APP_CONFIG_ROOT_KEY]
+                                                                               [PORTAUDIO_CONFIG_ROOT_KEY];
+    int framesPerBuffer = 0;
+    config.getInt(PORTAUDIO_CONFIG_FRAMES_PER_BUFFER_KEY, &framesPerBuffer, 0);
+    if (framesPerBuffer > 0) {
+        m_framesPerBuffer = static_cast<unsigned long>(framesPerBuffer);
+        // Wake up twice per callback, so a buffer never waits in the ring for longer than half a callback period.
+        m_feederInterval = std::max(
+            MIN_FEEDER_INTERVAL, std::chrono::microseconds(m_framesPerBuffer * 1000 / SAMPLES_PER_MS / 2));
+    }
+
+    int ringBufferSamples = DEFAULT_RING_BUFFER_SAMPLES;
+    config.getInt(PORTAUDIO_CONFIG_RING_BUFFER_SAMPLES_KEY, &ringBufferSamples, DEFAULT_RING_BUFFER_SAMPLES);
+    if (ringBufferSamples > 0) {
+        m_ring.reset(new sssdkCommon::SpscRingBuffer<int16_t>(ringBufferSamples));
+        m_feederBuffer.resize(m_ring->capacity());
+    }
+
+    std::string replayFile;
+    config.getString(PORTAUDIO_CONFIG_REPLAY_FILE_KEY, &replayFile);
+    if (!replayFile.empty()) {
+        bool errorOccurred = false;
+        m_replaySamples = sssdkCommon::AudioFileUtil::readAudioFromFile(replayFile, errorOccurred);
+        if (errorOccurred || m_replaySamples.empty()) {
+            ACSDK_ERROR(LX("readConfigFailed").d("reason", "replayFileNotRead").d("replayFile", replayFile));
+            m_replaySamples.clear();
+        } else {
+            m_replayCaptureTimes.reset(
+                new sssdkCommon::SpscRingBuffer<std::pair<uint64_t, std::chrono::steady_clock::time_point>>(
+                    REPLAY_CAPTURE_TIMES));
+        }
+    }
+
+    ACSDK_INFO(LX("readConfig")
+                   .d("framesPerBuffer", m_framesPerBuffer)
+                   .d("ringBufferSamples", m_ring ? m_ring->capacity() : 0)
+                   .d("replayFile", replayFile));
 }
 
 bool PortAudioMicrophoneWrapper::initialize() {
@@ -78,6 +166,13 @@ bool PortAudioMicrophoneWrapper::initialize() {
         ACSDK_CRITICAL(LX("Failed to create stream writer"));
         return false;
     }
+
+    readConfig();
+    if (!m_replaySamples.empty()) {
+        // The replayed file takes the place of the device, PortAudio is not needed.
+        return true;
+    }
+
     PaError err;
     err = Pa_Initialize();
     if (err != paNoError) {
@@ -95,7 +190,7 @@ bool PortAudioMicrophoneWrapper::initialize() {
             NUM_OUTPUT_CHANNELS,
             paInt16,
             SAMPLE_RATE,
-            PREFERRED_SAMPLES_PER_CALLBACK,
+            m_framesPerBuffer,
             PortAudioCallback,
             this);
     } else {
@@ -115,7 +210,7 @@ bool PortAudioMicrophoneWrapper::initialize() {
             &inputParameters,
             nullptr,
             SAMPLE_RATE,
-            PREFERRED_SAMPLES_PER_CALLBACK,
+            m_framesPerBuffer,
             paNoFlag,
             PortAudioCallback,
             this);
@@ -131,11 +226,22 @@ bool PortAudioMicrophoneWrapper::initialize() {
 bool PortAudioMicrophoneWrapper::startStreamingMicrophoneData() {
     ACSDK_DEBUG0(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_replaySamples.empty()) {
+        startFeeder();
+        if (!m_isReplayRunning) {
+            m_isReplayRunning = true;
+            m_replayThread = std::thread(&PortAudioMicrophoneWrapper::replayLoop, this);
+        }
+        m_isStreaming = true;
+        return true;
+    }
     PaError err = Pa_StartStream(m_paStream);
     if (err != paNoError) {
         ACSDK_CRITICAL(LX("Failed to start PortAudio stream"));
         return false;
     }
+    // Samples captured before the feeder runs wait in the ring buffer.
+    startFeeder();
     m_isStreaming = true;
     return true;
 }
@@ -143,11 +249,29 @@ bool PortAudioMicrophoneWrapper::startStreamingMicrophoneData() {
 bool PortAudioMicrophoneWrapper::stopStreamingMicrophoneData() {
     ACSDK_DEBUG0(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_replaySamples.empty()) {
+        m_isReplayRunning = false;
+        if (m_replayThread.joinable()) {
+            m_replayThread.join();
+        }
+        stopFeeder();
+        logReplayLatency();
+        m_isStreaming = false;
+        return true;
+    }
     PaError err = Pa_StopStream(m_paStream);
     if (err != paNoError) {
         ACSDK_CRITICAL(LX("Failed to stop PortAudio stream"));
         return false;
     }
+    stopFeeder();
+    auto statistics = getStatistics();
+    ACSDK_DEBUG0(LX(__func__)
+                     .d("ringOverruns", statistics.ringOverruns)
+                     .d("droppedSamples", statistics.droppedSamples)
+                     .d("inputOverflows", statistics.inputOverflows)
+                     .d("inputUnderflows", statistics.inputUnderflows)
+                     .d("streamWriteFailures", statistics.streamWriteFailures));
     m_isStreaming = false;
     return true;
 }
@@ -156,6 +280,16 @@ bool PortAudioMicrophoneWrapper::isStreaming() {
     return m_isStreaming;
 }
 
+PortAudioMicrophoneWrapper::Statistics PortAudioMicrophoneWrapper::getStatistics() const {
+    Statistics statistics;
+    statistics.ringOverruns = m_ringOverruns;
+    statistics.droppedSamples = m_droppedSamples;
+    statistics.inputOverflows = m_inputOverflows;
+    statistics.inputUnderflows = m_inputUnderflows;
+    statistics.streamWriteFailures = m_streamWriteFailures;
+    return statistics;
+}
+
 int PortAudioMicrophoneWrapper::PortAudioCallback(
     const void* inputBuffer,
     void* outputBuffer,
@@ -164,14 +298,143 @@ int PortAudioMicrophoneWrapper::PortAudioCallback(
     PaStreamCallbackFlags statusFlags,
     void* userData) {
     PortAudioMicrophoneWrapper* wrapper = static_cast<PortAudioMicrophoneWrapper*>(userData);
-    ssize_t returnCode = wrapper->m_writer->write(inputBuffer, numSamples);
-    if (returnCode <= 0) {
-        ACSDK_CRITICAL(LX("Failed to write to stream."));
+    if (statusFlags & paInputOverflow) {
+        wrapper->m_inputOverflows.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (statusFlags & paInputUnderflow) {
+        wrapper->m_inputUnderflows.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!wrapper->onSamplesCaptured(static_cast<const int16_t*>(inputBuffer), numSamples)) {
         return paAbort;
     }
     return paContinue;
 }
 
+bool PortAudioMicrophoneWrapper::onSamplesCaptured(const int16_t* samples, unsigned long numSamples) {
+    auto captureTime = std::chrono::steady_clock::now();
+    if (!m_ring) {
+        ssize_t returnCode = m_writer->write(samples, numSamples);
+        if (returnCode <= 0) {
+            m_streamWriteFailures.fetch_add(1, std::memory_order_relaxed);
+            ACSDK_CRITICAL(LX("Failed to write to stream."));
+            return false;
+        }
+        if (m_replayCaptureTimes) {
+            m_replayLatencies.push_back(Microseconds(std::chrono::steady_clock::now() - captureTime).count());
+        }
+        return true;
+    }
+
+    // Never block the capture thread, samples which do not fit are dropped and counted.
+    auto pushed = m_ring->push(samples, numSamples);
+    if (pushed < numSamples) {
+        m_ringOverruns.fetch_add(1, std::memory_order_relaxed);
+        m_droppedSamples.fetch_add(numSamples - pushed, std::memory_order_relaxed);
+    }
+    if (m_replayCaptureTimes && pushed > 0) {
+        m_capturedSamples += pushed;
+        auto capture = std::make_pair(m_capturedSamples, captureTime);
+        m_replayCaptureTimes->push(&capture, 1);
+    }
+    return true;
+}
+
+void PortAudioMicrophoneWrapper::feederLoop() {
+    while (m_isFeederRunning) {
+        drainRing();
+        std::this_thread::sleep_for(m_feederInterval);
+    }
+    drainRing();
+}
+
+void PortAudioMicrophoneWrapper::drainRing() {
+    size_t count;
+    while ((count = m_ring->pop(m_feederBuffer.data(), m_feederBuffer.size())) > 0) {
+        ssize_t returnCode = m_writer->write(m_feederBuffer.data(), count);
+        if (returnCode <= 0) {
+            m_streamWriteFailures.fetch_add(1, std::memory_order_relaxed);
+            ACSDK_ERROR(LX("drainRingFailed").d("reason", "writeFailed").d("returnCode", returnCode));
+        }
+        if (m_replayCaptureTimes) {
+            m_writtenSamples += count;
+            recordReplayLatencies();
+        }
+    }
+}
+
+void PortAudioMicrophoneWrapper::recordReplayLatencies() {
+    auto now = std::chrono::steady_clock::now();
+    // A buffer is timed once its last sample reached the stream, so the capture time of a buffer which was only
+    // partly written is kept for the next write.
+    while (m_hasPendingCaptureTime || m_replayCaptureTimes->pop(&m_pendingCaptureTime, 1)) {
+        if (m_pendingCaptureTime.first > m_writtenSamples) {
+            m_hasPendingCaptureTime = true;
+            return;
+        }
+        m_hasPendingCaptureTime = false;
+        m_replayLatencies.push_back(Microseconds(now - m_pendingCaptureTime.second).count());
+    }
+}
+
+void PortAudioMicrophoneWrapper::replayLoop() {
+    auto samplesPerBuffer =
+        PREFERRED_SAMPLES_PER_CALLBACK == m_framesPerBuffer ? DEFAULT_REPLAY_SAMPLES_PER_BUFFER : m_framesPerBuffer;
+    auto bufferDuration = std::chrono::microseconds(samplesPerBuffer * 1000 / SAMPLES_PER_MS);
+    // The file is followed by silence, like a microphone in a quiet room.
+    std::vector<int16_t> silence(samplesPerBuffer, 0);
+    size_t position = 0;
+    auto nextBufferTime = std::chrono::steady_clock::now();
+    while (m_isReplayRunning) {
+        const int16_t* samples = silence.data();
+        unsigned long numSamples = samplesPerBuffer;
+        if (position < m_replaySamples.size()) {
+            samples = m_replaySamples.data() + position;
+            numSamples = std::min<unsigned long>(samplesPerBuffer, m_replaySamples.size() - position);
+            position += numSamples;
+        }
+        if (!onSamplesCaptured(samples, numSamples)) {
+            return;
+        }
+        nextBufferTime += bufferDuration;
+        std::this_thread::sleep_until(nextBufferTime);
+    }
+}
+
+void PortAudioMicrophoneWrapper::startFeeder() {
+    if (m_ring && !m_isFeederRunning) {
+        m_isFeederRunning = true;
+        m_feederThread = std::thread(&PortAudioMicrophoneWrapper::feederLoop, this);
+    }
+}
+
+void PortAudioMicrophoneWrapper::stopFeeder() {
+    m_isFeederRunning = false;
+    if (m_feederThread.joinable()) {
+        m_feederThread.join();
+    }
+}
+
+void PortAudioMicrophoneWrapper::logReplayLatency() {
+    if (m_replayLatencies.empty()) {
+        return;
+    }
+    std::sort(m_replayLatencies.begin(), m_replayLatencies.end());
+    double total = 0;
+    for (auto latency : m_replayLatencies) {
+        total += latency;
+    }
+    auto statistics = getStatistics();
+    ACSDK_INFO(LX("replayLatency")
+                   .d("buffers", m_replayLatencies.size())
+                   .d("meanUs", total / m_replayLatencies.size())
+                   .d("p50Us", m_replayLatencies[m_replayLatencies.size() / 2])
+                   .d("p95Us", m_replayLatencies[m_replayLatencies.size() * 95 / 100])
+                   .d("maxUs", m_replayLatencies.back())
+                   .d("droppedSamples", statistics.droppedSamples)
+                   .d("streamWriteFailures", statistics.streamWriteFailures));
+    m_replayLatencies.clear();
+}
+
 bool PortAudioMicrophoneWrapper::getConfigSuggestedLatency(PaTime& suggestedLatency) {
     bool latencyInConfig = false;
     auto config = avsCommon::utils::configuration::ConfigurationNode::getRoot()[SAMPLE_APP_CONFIG_ROOT_KEY]
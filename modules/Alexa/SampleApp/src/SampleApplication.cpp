@@ -25,7 +25,9 @@
 #include "SampleApp/ConnectionObserver.h"
 #include "SampleApp/KeywordObserver.h"
 #include "SampleApp/LocaleAssetsManager.h"
+#include "SampleApp/LocalPackageStore.h"
 #include "SampleApp/SampleApplication.h"
+#include "SampleApp/StartupTaskGraph.h"
 
 #ifdef ENABLE_REVOKE_AUTH
 #include "SampleApp/RevokeAuthorizationObserver.h"
@@ -44,16 +46,16 @@
 #include <KWDProvider/KeywordDetectorProvider.h>
 #endif
 
-#ifdef PORTAUDIO
-#include <SampleApp/PortAudioMicrophoneWrapper.h>
-#elif defined(UWP_BUILD)
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
 #include "SSSDKCommon/NullMicrophone.h"
+#elif defined(PORTAUDIO)
+#include <SampleApp/PortAudioMicrophoneWrapper.h>
 #endif
 
-#ifdef GSTREAMER_MEDIA_PLAYER
-#include <MediaPlayer/MediaPlayer.h>
-#elif defined(UWP_BUILD)
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
 #include <SSSDKCommon/NullMediaSpeaker.h>
+#elif defined(GSTREAMER_MEDIA_PLAYER)
+#include <MediaPlayer/MediaPlayer.h>
 #endif
 
 #ifdef ANDROID
@@ -123,6 +125,8 @@
 #include <EqualizerImplementations/MiscDBEqualizerStorage.h>
 #include <EqualizerImplementations/SDKConfigEqualizerConfiguration.h>
 
+#include <APLClient/AplTrace.h>
+
 #include <algorithm>
 #include <cctype>
 #include <csignal>
@@ -221,6 +225,30 @@ static const std::string CONTENT_CACHE_MAX_SIZE_KEY("contentCacheMaxSize");
 /// Default value for max number of cache entries for imported packages.
 static const std::string DEFAULT_CONTENT_CACHE_MAX_SIZE("50");
 
+/// Key for the minimum number of bytes the content download buffer grows by.
+static const std::string CONTENT_DOWNLOAD_CHUNK_SIZE_KEY("contentDownloadChunkSize");
+
+/// Key for the directory of the local APL package store.
+static const std::string APL_PACKAGE_STORE_PATH_KEY("aplPackageStorePath");
+
+/// Key for an APL package bundle to import into the local package store on startup.
+static const std::string APL_PACKAGE_BUNDLE_KEY("aplPackageBundle");
+
+/// Key for the number of APL trace spans kept in memory, tracing is disabled when 0.
+static const std::string APL_TRACE_BUFFER_SIZE_KEY("aplTraceBufferSize");
+
+/// Key for the file the APL trace is written to on SIGUSR1.
+static const std::string APL_TRACE_OUTPUT_PATH_KEY("aplTraceOutputPath");
+
+/// Default file the APL trace is written to.
+static const std::string DEFAULT_APL_TRACE_OUTPUT_PATH("/tmp/aplTrace.json");
+
+/// Key for the most verbose level logged for the APL client binding.
+static const std::string APL_CLIENT_LOG_LEVEL_KEY("aplClientLogLevel");
+
+/// Key for the most verbose level logged for the APL core engine.
+static const std::string APL_CORE_ENGINE_LOG_LEVEL_KEY("aplCoreEngineLogLevel");
+
 /// The key in our config file to find the maxNumberOfConcurrentDownloads configuration.
 static const std::string MAX_NUMBER_OF_CONCURRENT_DOWNLOAD_CONFIGURATION_KEY = "maxNumberOfConcurrentDownloads";
 
@@ -278,6 +306,28 @@ static alexaClientSDK::avsCommon::utils::logger::Level getLogLevelFromUserInput(
     return alexaClientSDK::avsCommon::utils::logger::convertNameToLevel(userInputLogLevel);
 }
 
+/**
+ * Reads the most verbose level logged for a subsystem.
+ *
+ * @param config The configuration node the level is read from.
+ * @param key The key of the level.
+ * @return The level, @c Level::DEBUG9 if it is not configured or invalid, so only the Sample App log level applies.
+ */
+static avsCommon::utils::logger::Level getSubsystemLogLevel(
+    const avsCommon::utils::configuration::ConfigurationNode& config,
+    const std::string& key) {
+    std::string name;
+    if (!config.getString(key, &name)) {
+        return avsCommon::utils::logger::Level::DEBUG9;
+    }
+    auto level = getLogLevelFromUserInput(name);
+    if (avsCommon::utils::logger::Level::UNKNOWN == level) {
+        ACSDK_WARN(LX("invalidLogLevel").d("key", key).d("value", name));
+        return avsCommon::utils::logger::Level::DEBUG9;
+    }
+    return level;
+}
+
 /**
  * Allows the process to ignore the SIGPIPE signal.
  * The SIGPIPE signal may be received when the application performs a write to a closed socket.
@@ -294,6 +344,16 @@ static bool ignoreSigpipeSignals() {
     return true;
 }
 
+#ifdef SIGUSR1
+/**
+ * Requests a dump of the APL trace, which is written on the next APL update tick.  Handles @c SIGUSR1 only, so the
+ * signal number is not needed.
+ */
+static void requestAplTraceDump(int) {
+    APLClient::AplTraceRecorder::getInstance().requestDump();
+}
+#endif
+
 std::unique_ptr<SampleApplication> SampleApplication::create(
     const std::vector<std::string>& configFiles,
     const std::string& pathToInputFolder,
@@ -336,6 +396,10 @@ SampleAppReturnCode SampleApplication::run() {
     return m_guiClient->run();
 }
 
+std::string SampleApplication::getStartupReport() const {
+    return m_startupReport;
+}
+
 SampleApplication::~SampleApplication() {
     if (m_guiManager) {
         m_guiManager->shutdown();
@@ -430,6 +494,9 @@ bool SampleApplication::initialize(
     const std::string& pathToInputFolder,
     const std::string& logLevel,
     std::shared_ptr<avsCommon::sdkInterfaces::diagnostics::DiagnosticsInterface> diagnostics) {
+    // Runs the independent construction steps and records the startup timeline relative to this point.
+    StartupTaskGraph startupGraph;
+
     /*
      * Set up the SDK logging system to write to the SampleApp's ConsolePrinter.  Also adjust the logging level
      * if requested.
@@ -484,7 +551,11 @@ bool SampleApplication::initialize(
     // add the InterruptModel Configuration
     configJsonStreams.push_back(alexaClientSDK::afml::interruptModel::InterruptModelConfiguration::getConfig());
 
-    if (!avsCommon::avs::initialization::AlexaClientSDKInit::initialize(configJsonStreams)) {
+    // Parses the configuration files.
+    bool sdkInitialized = startupGraph.runStep("sdkInitialize", [&]() {
+        return avsCommon::avs::initialization::AlexaClientSDKInit::initialize(configJsonStreams);
+    });
+    if (!sdkInitialized) {
         ACSDK_CRITICAL(LX("Failed to initialize SDK!"));
         return false;
     }
@@ -495,8 +566,11 @@ bool SampleApplication::initialize(
     auto httpContentFetcherFactory = std::make_shared<avsCommon::utils::libcurlUtils::HTTPContentFetcherFactory>();
 
     // Creating the misc DB object to be used by various components.
-    std::shared_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteMiscStorage> miscStorage =
-        alexaClientSDK::storage::sqliteStorage::SQLiteMiscStorage::create(config);
+    std::shared_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteMiscStorage> miscStorage;
+    startupGraph.runStep("miscStorage", [&]() {
+        miscStorage = alexaClientSDK::storage::sqliteStorage::SQLiteMiscStorage::create(config);
+        return nullptr != miscStorage;
+    });
     if (!miscStorage) {
         ACSDK_CRITICAL(LX("Failed to create misc storage"));
         return false;
@@ -529,151 +603,208 @@ bool SampleApplication::initialize(
     }
 #endif
 
+    /*
+     * Independent construction steps run concurrently as a startup task graph.  The media players, the SQLite storages,
+     * the locale assets and the microphone only depend on the configuration, and opening audio devices and databases
+     * makes up a large part of the time until the device reacts to the wake word.
+     *
+     * The storages each open a database file of their own through a connection of their own, which SQLite supports
+     * from any thread.  The audio stack is initialized in sequence: the media players initialize GStreamer and its
+     * audio sinks, which load the same ALSA and PulseAudio configuration as PortAudio, and that loading is not thread
+     * safe.  The microphone is therefore only created once the media players are.
+     */
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> speakSpeaker;
-    std::tie(m_speakMediaPlayer, speakSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "SpeakMediaPlayer");
-    if (!m_speakMediaPlayer || !speakSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for speech!"));
-        return false;
-    }
-
-    int poolSize;
-    sampleAppConfig.getInt(AUDIO_MEDIAPLAYER_POOL_SIZE_KEY, &poolSize, AUDIO_MEDIAPLAYER_POOL_SIZE_DEFAULT);
     std::vector<std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface>> audioSpeakers;
-
-    for (int index = 0; index < poolSize; index++) {
-        std::shared_ptr<ApplicationMediaPlayer> mediaPlayer;
-        std::shared_ptr<avsCommon::sdkInterfaces::SpeakerInterface> speaker;
-
-        std::tie(mediaPlayer, speaker) =
-            createApplicationMediaPlayer(httpContentFetcherFactory, equalizerEnabled, "AudioMediaPlayer");
-        if (!mediaPlayer || !speaker) {
-            ACSDK_CRITICAL(LX("Failed to create media player for audio!"));
-            return false;
-        }
-        m_audioMediaPlayerPool.push_back(mediaPlayer);
-        audioSpeakers.push_back(speaker);
-        // Creating equalizers
-        if (nullptr != equalizerRuntimeSetup) {
-            equalizerRuntimeSetup->addEqualizer(mediaPlayer);
-        }
-    }
-
-    std::vector<std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface>> pool(
-        m_audioMediaPlayerPool.begin(), m_audioMediaPlayerPool.end());
-    m_audioMediaPlayerFactory = mediaPlayer::PooledMediaPlayerFactory::create(pool);
-    if (!m_audioMediaPlayerFactory) {
-        ACSDK_CRITICAL(LX("Failed to create media player factory for content!"));
-        return false;
-    }
-
+    std::vector<std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface>> pool;
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> notificationsSpeaker;
-    std::tie(m_notificationsMediaPlayer, notificationsSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "NotificationsMediaPlayer");
-    if (!m_notificationsMediaPlayer || !notificationsSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for notifications!"));
-        return false;
-    }
-
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> bluetoothSpeaker;
-    std::tie(m_bluetoothMediaPlayer, bluetoothSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "BluetoothMediaPlayer");
-
-    if (!m_bluetoothMediaPlayer || !bluetoothSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for bluetooth!"));
-        return false;
-    }
-
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> ringtoneSpeaker;
-    std::tie(m_ringtoneMediaPlayer, ringtoneSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "RingtoneMediaPlayer");
-    if (!m_ringtoneMediaPlayer || !ringtoneSpeaker) {
-        alexaSmartScreenSDK::sampleApp::ConsolePrinter::simplePrint("Failed to create media player for ringtones!");
-        return false;
-    }
-
 #ifdef ENABLE_COMMS_AUDIO_PROXY
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> commsSpeaker;
-    std::tie(m_commsMediaPlayer, commsSpeaker) = createApplicationMediaPlayer(
-        httpContentFetcherFactory,
-        false,
-        avsCommon::sdkInterfaces::ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME,
-        "CommsMediaPlayer",
-        true);
-    if (!m_commsMediaPlayer || !commsSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for comms!"));
-        return false;
-    }
 #endif
-
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> alertsSpeaker;
-    std::tie(m_alertsMediaPlayer, alertsSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "AlertsMediaPlayer");
-    if (!m_alertsMediaPlayer || !alertsSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for alerts!"));
-        return false;
-    }
-
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> systemSoundSpeaker;
-    std::tie(m_systemSoundMediaPlayer, systemSoundSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "SystemSoundMediaPlayer");
-    if (!m_systemSoundMediaPlayer || !systemSoundSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for system sound player!"));
-        return false;
-    }
-
 #ifdef ENABLE_PCC
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> phoneSpeaker;
-    std::tie(m_phoneMediaPlayer, phoneSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "PhoneMediaPlayer");
-
-    if (!m_phoneMediaPlayer || !phoneSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for phone!"));
-        return false;
-    }
 #endif
-
 #ifdef ENABLE_MCC
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> meetingSpeaker;
     std::shared_ptr<ApplicationMediaPlayer> meetingMediaPlayer;
-    std::tie(meetingMediaPlayer, meetingSpeaker) =
-        createApplicationMediaPlayer(httpContentFetcherFactory, false, "MeetingMediaPlayer");
-
-    if (!meetingMediaPlayer || !meetingSpeaker) {
-        ACSDK_CRITICAL(LX("Failed to create media player for meeting client!"));
-        return false;
-    }
 #endif
-
     std::multimap<
         avsCommon::sdkInterfaces::ChannelVolumeInterface::Type,
         std::shared_ptr<avsCommon::sdkInterfaces::SpeakerInterface>>
         additionalSpeakers;
-    if (!createMediaPlayersForAdapters(httpContentFetcherFactory, equalizerRuntimeSetup, additionalSpeakers)) {
-        ACSDK_CRITICAL(LX("Could not create mediaPlayers for adapters"));
-        return false;
-    }
 
-    auto audioFactory = std::make_shared<alexaClientSDK::applicationUtilities::resources::audio::AudioFactory>();
+    startupGraph.addTask("mediaPlayers", [&]() {
+        std::tie(m_speakMediaPlayer, speakSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "SpeakMediaPlayer");
+        if (!m_speakMediaPlayer || !speakSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for speech!"));
+            return false;
+        }
+
+        int poolSize;
+        sampleAppConfig.getInt(AUDIO_MEDIAPLAYER_POOL_SIZE_KEY, &poolSize, AUDIO_MEDIAPLAYER_POOL_SIZE_DEFAULT);
 
-    // Creating the alert storage object to be used for rendering and storing alerts.
-    auto alertStorage =
-        alexaClientSDK::acsdkAlerts::storage::SQLiteAlertStorage::create(config, audioFactory->alerts());
+        for (int index = 0; index < poolSize; index++) {
+            std::shared_ptr<ApplicationMediaPlayer> mediaPlayer;
+            std::shared_ptr<avsCommon::sdkInterfaces::SpeakerInterface> speaker;
+
+            std::tie(mediaPlayer, speaker) =
+                createApplicationMediaPlayer(httpContentFetcherFactory, equalizerEnabled, "AudioMediaPlayer");
+            if (!mediaPlayer || !speaker) {
+                ACSDK_CRITICAL(LX("Failed to create media player for audio!"));
+                return false;
+            }
+            m_audioMediaPlayerPool.push_back(mediaPlayer);
+            audioSpeakers.push_back(speaker);
+            // Creating equalizers
+            if (nullptr != equalizerRuntimeSetup) {
+                equalizerRuntimeSetup->addEqualizer(mediaPlayer);
+            }
+        }
 
-    // Creating the message storage object to be used for storing message to be sent later.
-    auto messageStorage = alexaClientSDK::certifiedSender::SQLiteMessageStorage::create(config);
+        pool.assign(m_audioMediaPlayerPool.begin(), m_audioMediaPlayerPool.end());
+        m_audioMediaPlayerFactory = mediaPlayer::PooledMediaPlayerFactory::create(pool);
+        if (!m_audioMediaPlayerFactory) {
+            ACSDK_CRITICAL(LX("Failed to create media player factory for content!"));
+            return false;
+        }
 
-    // Creating notifications storage object to be used for storing notification indicators.
+        std::tie(m_notificationsMediaPlayer, notificationsSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "NotificationsMediaPlayer");
+        if (!m_notificationsMediaPlayer || !notificationsSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for notifications!"));
+            return false;
+        }
 
-    auto notificationsStorage = alexaClientSDK::acsdkNotifications::SQLiteNotificationsStorage::create(config);
+        std::tie(m_bluetoothMediaPlayer, bluetoothSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "BluetoothMediaPlayer");
 
-    // Creating new device settings storage object to be used for storing AVS Settings.
+        if (!m_bluetoothMediaPlayer || !bluetoothSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for bluetooth!"));
+            return false;
+        }
 
-    auto deviceSettingsStorage = alexaClientSDK::settings::storage::SQLiteDeviceSettingStorage::create(config);
+        std::tie(m_ringtoneMediaPlayer, ringtoneSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "RingtoneMediaPlayer");
+        if (!m_ringtoneMediaPlayer || !ringtoneSpeaker) {
+            alexaSmartScreenSDK::sampleApp::ConsolePrinter::simplePrint("Failed to create media player for ringtones!");
+            return false;
+        }
 
-    // Creating bluetooth storage object to be used for storing uuid to mac mappings for devices.
+#ifdef ENABLE_COMMS_AUDIO_PROXY
+        std::tie(m_commsMediaPlayer, commsSpeaker) = createApplicationMediaPlayer(
+            httpContentFetcherFactory,
+            false,
+            avsCommon::sdkInterfaces::ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME,
+            "CommsMediaPlayer",
+            true);
+        if (!m_commsMediaPlayer || !commsSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for comms!"));
+            return false;
+        }
+#endif
 
-    auto bluetoothStorage = alexaClientSDK::acsdkBluetooth::SQLiteBluetoothStorage::create(config);
+        std::tie(m_alertsMediaPlayer, alertsSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "AlertsMediaPlayer");
+        if (!m_alertsMediaPlayer || !alertsSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for alerts!"));
+            return false;
+        }
+
+        std::tie(m_systemSoundMediaPlayer, systemSoundSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "SystemSoundMediaPlayer");
+        if (!m_systemSoundMediaPlayer || !systemSoundSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for system sound player!"));
+            return false;
+        }
+
+#ifdef ENABLE_PCC
+        std::tie(m_phoneMediaPlayer, phoneSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "PhoneMediaPlayer");
+
+        if (!m_phoneMediaPlayer || !phoneSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for phone!"));
+            return false;
+        }
+#endif
+
+#ifdef ENABLE_MCC
+        std::tie(meetingMediaPlayer, meetingSpeaker) =
+            createApplicationMediaPlayer(httpContentFetcherFactory, false, "MeetingMediaPlayer");
+
+        if (!meetingMediaPlayer || !meetingSpeaker) {
+            ACSDK_CRITICAL(LX("Failed to create media player for meeting client!"));
+            return false;
+        }
+#endif
+
+        if (!createMediaPlayersForAdapters(httpContentFetcherFactory, equalizerRuntimeSetup, additionalSpeakers)) {
+            ACSDK_CRITICAL(LX("Could not create mediaPlayers for adapters"));
+            return false;
+        }
+
+        return true;
+    });
+
+    auto audioFactory = std::make_shared<alexaClientSDK::applicationUtilities::resources::audio::AudioFactory>();
+
+    std::shared_ptr<alexaClientSDK::acsdkAlerts::storage::AlertStorageInterface> alertStorage;
+    startupGraph.addTask("alertStorage", [&]() {
+        // Creating the alert storage object to be used for rendering and storing alerts.
+        alertStorage = alexaClientSDK::acsdkAlerts::storage::SQLiteAlertStorage::create(config, audioFactory->alerts());
+        if (!alertStorage) {
+            ACSDK_CRITICAL(LX("Failed to create alert storage!"));
+            return false;
+        }
+        return true;
+    });
+
+    std::shared_ptr<alexaClientSDK::certifiedSender::MessageStorageInterface> messageStorage;
+    startupGraph.addTask("messageStorage", [&]() {
+        // Creating the message storage object to be used for storing message to be sent later.
+        messageStorage = alexaClientSDK::certifiedSender::SQLiteMessageStorage::create(config);
+        if (!messageStorage) {
+            ACSDK_CRITICAL(LX("Failed to create message storage!"));
+            return false;
+        }
+        return true;
+    });
+
+    std::shared_ptr<alexaClientSDK::acsdkNotificationsInterfaces::NotificationsStorageInterface> notificationsStorage;
+    startupGraph.addTask("notificationsStorage", [&]() {
+        // Creating notifications storage object to be used for storing notification indicators.
+        notificationsStorage = alexaClientSDK::acsdkNotifications::SQLiteNotificationsStorage::create(config);
+        if (!notificationsStorage) {
+            ACSDK_CRITICAL(LX("Failed to create notifications storage!"));
+            return false;
+        }
+        return true;
+    });
+
+    std::unique_ptr<alexaClientSDK::settings::storage::DeviceSettingStorageInterface> deviceSettingsStorage;
+    startupGraph.addTask("deviceSettingsStorage", [&]() {
+        // Creating new device settings storage object to be used for storing AVS Settings.
+        deviceSettingsStorage = alexaClientSDK::settings::storage::SQLiteDeviceSettingStorage::create(config);
+        if (!deviceSettingsStorage) {
+            ACSDK_CRITICAL(LX("Failed to create device settings storage!"));
+            return false;
+        }
+        return true;
+    });
+
+    std::shared_ptr<alexaClientSDK::acsdkBluetooth::BluetoothStorageInterface> bluetoothStorage;
+    startupGraph.addTask("bluetoothStorage", [&]() {
+        // Creating bluetooth storage object to be used for storing uuid to mac mappings for devices.
+        bluetoothStorage = alexaClientSDK::acsdkBluetooth::SQLiteBluetoothStorage::create(config);
+        if (!bluetoothStorage) {
+            ACSDK_CRITICAL(LX("Failed to create bluetooth storage!"));
+            return false;
+        }
+        return true;
+    });
 
 #ifdef KWD
     bool wakeWordEnabled = true;
@@ -681,12 +812,61 @@ bool SampleApplication::initialize(
     bool wakeWordEnabled = false;
 #endif
 
-    /*
-     * Create sample locale asset manager.
-     */
-    auto localeAssetsManager = LocaleAssetsManager::create(wakeWordEnabled);
-    if (!localeAssetsManager) {
-        ACSDK_CRITICAL(LX("Failed to create Locale Assets Manager!"));
+    std::shared_ptr<LocaleAssetsManager> localeAssetsManager;
+    startupGraph.addTask("localeAssetsManager", [&]() {
+        /*
+         * Create sample locale asset manager.
+         */
+        localeAssetsManager = LocaleAssetsManager::create(wakeWordEnabled);
+        if (!localeAssetsManager) {
+            ACSDK_CRITICAL(LX("Failed to create Locale Assets Manager!"));
+            return false;
+        }
+        return true;
+    });
+
+    // Creating the buffer (Shared Data Stream) that will hold user audio data. This is the main input into the SDK.
+
+    size_t bufferSize = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
+        BUFFER_SIZE_IN_SAMPLES, WORD_SIZE, MAX_READERS);
+    auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(bufferSize);
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> sharedDataStream =
+        alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, WORD_SIZE, MAX_READERS);
+
+    if (!sharedDataStream) {
+        ACSDK_CRITICAL(LX("Failed to create shared data stream!"));
+        return false;
+    }
+
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
+    std::shared_ptr<alexaSmartScreenSDK::sssdkCommon::NullMicrophone> micWrapper;
+#elif defined(PORTAUDIO)
+    std::shared_ptr<PortAudioMicrophoneWrapper> micWrapper;
+#elif defined(ANDROID_MICROPHONE)
+    std::shared_ptr<applicationUtilities::androidUtilities::AndroidSLESMicrophone> micWrapper;
+#else
+#error "No audio input provided"
+#endif
+    startupGraph.addTask(
+        "microphone",
+        [&]() {
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
+            micWrapper = std::make_shared<alexaSmartScreenSDK::sssdkCommon::NullMicrophone>(sharedDataStream);
+#elif defined(PORTAUDIO)
+            micWrapper = PortAudioMicrophoneWrapper::create(sharedDataStream);
+#elif defined(ANDROID_MICROPHONE)
+            micWrapper = m_openSlEngine->createAndroidMicrophone(sharedDataStream);
+#endif
+            if (!micWrapper) {
+                ACSDK_CRITICAL(LX("Failed to create PortAudioMicrophoneWrapper!"));
+                return false;
+            }
+            return true;
+        },
+        {"mediaPlayers"});
+
+    if (!startupGraph.run()) {
+        ACSDK_CRITICAL(LX("Failed to run startup tasks!"));
         return false;
     }
 
@@ -702,7 +882,12 @@ bool SampleApplication::initialize(
 #ifdef UWP_BUILD
     auto webSocketServer = std::make_shared<NullSocketServer>();
 #else
-    auto webSocketServer = std::make_shared<communication::WebSocketServer>(websocketInterface, websocketPortNumber);
+    std::shared_ptr<communication::WebSocketServer> webSocketServer;
+    startupGraph.runStep("webSocketServer", [&]() {
+        // Binds the listening socket.
+        webSocketServer = std::make_shared<communication::WebSocketServer>(websocketInterface, websocketPortNumber);
+        return true;
+    });
 
 #ifdef ENABLE_WEBSOCKET_SSL
     std::string sslCaFile;
@@ -741,12 +926,21 @@ bool SampleApplication::initialize(
         DEFAULT_CONTENT_CACHE_REUSE_PERIOD_IN_SECONDS);
     sampleAppConfig.getString(CONTENT_CACHE_MAX_SIZE_KEY, &maxCacheSize, DEFAULT_CONTENT_CACHE_MAX_SIZE);
 
+    int downloadChunkSize;
+    sampleAppConfig.getInt(
+        CONTENT_DOWNLOAD_CHUNK_SIZE_KEY, &downloadChunkSize, CachingDownloadManager::DEFAULT_DOWNLOAD_CHUNK_SIZE);
+    if (1 > downloadChunkSize) {
+        downloadChunkSize = CachingDownloadManager::DEFAULT_DOWNLOAD_CHUNK_SIZE;
+        ACSDK_ERROR(LX("Invalid value for contentDownloadChunkSize"));
+    }
+
     auto contentDownloadManager = std::make_shared<CachingDownloadManager>(
         httpContentFetcherFactory,
         std::stol(cachePeriodInSeconds),
         std::stol(maxCacheSize),
         miscStorage,
-        customerDataManager);
+        customerDataManager,
+        downloadChunkSize);
 
     int maxNumberOfConcurrentDownloads;
     sampleAppConfig.getInt(
@@ -759,14 +953,43 @@ bool SampleApplication::initialize(
         ACSDK_ERROR(LX("Invalid values for maxNumberOfConcurrentDownloads"));
     }
 
-    auto parameters = AplClientBridgeParameter{maxNumberOfConcurrentDownloads};
-    auto aplRenderer = AplClientBridge::create(contentDownloadManager, m_guiClient, parameters);
+    std::string packageStorePath;
+    sampleAppConfig.getString(APL_PACKAGE_STORE_PATH_KEY, &packageStorePath);
+    auto packageStore = LocalPackageStore::create(packageStorePath);
+
+    std::string packageBundle;
+    if (sampleAppConfig.getString(APL_PACKAGE_BUNDLE_KEY, &packageBundle) && !packageBundle.empty()) {
+        if (packageStore) {
+            packageStore->importBundle(packageBundle);
+        } else {
+            ACSDK_WARN(LX("aplPackageBundleIgnored").d("reason", "noPackageStoreConfigured"));
+        }
+    }
+
+    int traceBufferSize = 0;
+    sampleAppConfig.getInt(APL_TRACE_BUFFER_SIZE_KEY, &traceBufferSize, 0);
+    std::string traceOutputPath;
+    if (traceBufferSize > 0) {
+        sampleAppConfig.getString(APL_TRACE_OUTPUT_PATH_KEY, &traceOutputPath, DEFAULT_APL_TRACE_OUTPUT_PATH);
+        APLClient::AplTraceRecorder::getInstance().enable(traceBufferSize);
+#ifdef SIGUSR1
+        std::signal(SIGUSR1, requestAplTraceDump);
+#endif
+        ACSDK_INFO(LX("aplTraceEnabled").d("bufferSize", traceBufferSize).d("outputPath", traceOutputPath));
+    }
+
+    auto parameters = AplClientBridgeParameter{maxNumberOfConcurrentDownloads,
+                                               traceOutputPath,
+                                               getSubsystemLogLevel(sampleAppConfig, APL_CLIENT_LOG_LEVEL_KEY),
+                                               getSubsystemLogLevel(sampleAppConfig, APL_CORE_ENGINE_LOG_LEVEL_KEY)};
+    auto aplRenderer = AplClientBridge::create(contentDownloadManager, m_guiClient, parameters, packageStore);
 
     m_guiClient->setAplClientBridge(aplRenderer);
 
     if (!m_guiClient->start()) {
         return false;
     }
+    startupGraph.mark("guiClientStarted");
 
 #ifdef ENABLE_CAPTIONS
     /*
@@ -807,10 +1030,13 @@ bool SampleApplication::initialize(
         deviceInfo->getClientId() + deviceInfo->getDeviceSerialNumber());
 
     // Creating the AuthDelegate - this component takes care of LWA and authorization of the client.
-    auto authDelegateStorage = authorization::cblAuthDelegate::SQLiteCBLAuthDelegateStorage::create(config);
-    std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate =
-        authorization::cblAuthDelegate::CBLAuthDelegate::create(
+    std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate;
+    startupGraph.runStep("authDelegate", [&]() {
+        auto authDelegateStorage = authorization::cblAuthDelegate::SQLiteCBLAuthDelegateStorage::create(config);
+        authDelegate = authorization::cblAuthDelegate::CBLAuthDelegate::create(
             config, customerDataManager, std::move(authDelegateStorage), userInterfaceManager, nullptr, deviceInfo);
+        return nullptr != authDelegate;
+    });
 
     if (!authDelegate) {
         ACSDK_CRITICAL(LX("Creation of AuthDelegate failed!"));
@@ -821,11 +1047,14 @@ bool SampleApplication::initialize(
      * Creating the CapabilitiesDelegate - This component provides the client with the ability to send messages to the
      * Capabilities API.
      */
-    auto capabilitiesDelegateStorage =
-        alexaClientSDK::capabilitiesDelegate::storage::SQLiteCapabilitiesDelegateStorage::create(config);
+    startupGraph.runStep("capabilitiesDelegate", [&]() {
+        auto capabilitiesDelegateStorage =
+            alexaClientSDK::capabilitiesDelegate::storage::SQLiteCapabilitiesDelegateStorage::create(config);
 
-    m_capabilitiesDelegate = alexaClientSDK::capabilitiesDelegate::CapabilitiesDelegate::create(
-        authDelegate, std::move(capabilitiesDelegateStorage), customerDataManager);
+        m_capabilitiesDelegate = alexaClientSDK::capabilitiesDelegate::CapabilitiesDelegate::create(
+            authDelegate, std::move(capabilitiesDelegateStorage), customerDataManager);
+        return nullptr != m_capabilitiesDelegate;
+    });
 
     if (!m_capabilitiesDelegate) {
         alexaSmartScreenSDK::sampleApp::ConsolePrinter::simplePrint("Creation of CapabilitiesDelegate failed!");
@@ -894,19 +1123,6 @@ bool SampleApplication::initialize(
     auto transportFactory = std::make_shared<acl::HTTP2TransportFactory>(
         std::make_shared<avsCommon::utils::libcurlUtils::LibcurlHTTP2ConnectionFactory>(), postConnectSequencerFactory);
 
-    // Creating the buffer (Shared Data Stream) that will hold user audio data. This is the main input into the SDK.
-
-    size_t bufferSize = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
-        BUFFER_SIZE_IN_SAMPLES, WORD_SIZE, MAX_READERS);
-    auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(bufferSize);
-    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> sharedDataStream =
-        alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, WORD_SIZE, MAX_READERS);
-
-    if (!sharedDataStream) {
-        ACSDK_CRITICAL(LX("Failed to create shared data stream!"));
-        return false;
-    }
-
     /*
      * Create the BluetoothDeviceManager to communicate with the Bluetooth stack.
      */
@@ -985,21 +1201,6 @@ bool SampleApplication::initialize(
         wakeCanBeOverridden);
 #endif
 
-#ifdef PORTAUDIO
-    std::shared_ptr<PortAudioMicrophoneWrapper> micWrapper = PortAudioMicrophoneWrapper::create(sharedDataStream);
-#elif defined(ANDROID_MICROPHONE)
-    std::shared_ptr<applicationUtilities::androidUtilities::AndroidSLESMicrophone> micWrapper =
-        m_openSlEngine->createAndroidMicrophone(sharedDataStream);
-#elif defined(UWP_BUILD)
-    std::shared_ptr<alexaSmartScreenSDK::sssdkCommon::NullMicrophone> micWrapper =
-        std::make_shared<alexaSmartScreenSDK::sssdkCommon::NullMicrophone>(sharedDataStream);
-#else
-#error "No audio input provided"
-#endif
-    if (!micWrapper) {
-        ACSDK_CRITICAL(LX("Failed to create PortAudioMicrophoneWrapper!"));
-        return false;
-    }
 
 #ifdef KWD
     // If wake word is enabled, then creating the GUI manager with a wake word audio provider.
@@ -1029,8 +1230,9 @@ bool SampleApplication::initialize(
      * Creating the SmartScreenClient - this component serves as an out-of-box default object that instantiates and
      * "glues" together all the modules.
      */
-    std::shared_ptr<smartScreenClient::SmartScreenClient> smartScreenClient =
-        smartScreenClient::SmartScreenClient::create(
+    std::shared_ptr<smartScreenClient::SmartScreenClient> smartScreenClient;
+    startupGraph.runStep("smartScreenClient", [&]() {
+        smartScreenClient = smartScreenClient::SmartScreenClient::create(
             deviceInfo,
             customerDataManager,
             m_externalMusicProviderMediaPlayersMap,
@@ -1095,6 +1297,8 @@ bool SampleApplication::initialize(
             std::make_shared<alexaClientSDK::capabilityAgents::speakerManager::DefaultChannelVolumeFactory>(),
             m_guiManager,
             APLVersion);
+        return nullptr != smartScreenClient;
+    });
 
     if (!smartScreenClient) {
         ACSDK_CRITICAL(LX("Failed to create default SDK client!"));
@@ -1118,6 +1322,9 @@ bool SampleApplication::initialize(
     }
 #endif  // KWD
 
+    // The microphone is streaming since the GUIManager was created, so the device reacts to the wake word from here on.
+    auto timeToWakeWordReady = startupGraph.mark("wakeWordReady");
+
     smartScreenClient->addSpeakerManagerObserver(userInterfaceManager);
     smartScreenClient->addNotificationsObserver(userInterfaceManager);
     smartScreenClient->addTemplateRuntimeObserver(m_guiManager);
@@ -1147,7 +1354,17 @@ bool SampleApplication::initialize(
     m_capabilitiesDelegate->addCapabilitiesObserver(m_guiClient);
     m_capabilitiesDelegate->addCapabilitiesObserver(smartScreenClient);
 
+#ifndef STARTUP_BENCHMARK
     smartScreenClient->connect();
+#endif
+    // The startup benchmark runs without AVS and stops right before connecting.
+    auto timeToConnectRequest = startupGraph.mark("connectRequested");
+
+    startupGraph.logTimeline();
+    ACSDK_INFO(LX("startupComplete")
+                   .d("timeToWakeWordReadyMs", timeToWakeWordReady.count() / 1000.0)
+                   .d("timeToConnectRequestMs", timeToConnectRequest.count() / 1000.0));
+    m_startupReport = startupGraph.getReport();
 
     return true;
 }
@@ -1158,7 +1375,12 @@ SampleApplication::createApplicationMediaPlayer(
     bool enableEqualizer,
     const std::string& name,
     bool enableLiveMode) {
-#ifdef GSTREAMER_MEDIA_PLAYER
+#if defined(STARTUP_BENCHMARK) || defined(UWP_BUILD)
+    auto mediaPlayer = std::make_shared<alexaSmartScreenSDK::sssdkCommon::TestMediaPlayer>();
+    auto speaker = std::make_shared<alexaSmartScreenSDK::sssdkCommon::NullMediaSpeaker>();
+
+    return {mediaPlayer, speaker};
+#elif defined(GSTREAMER_MEDIA_PLAYER)
     /*
      * For the SDK, the MediaPlayer happens to also provide volume control functionality.
      * Note the externalMusicProviderMediaPlayer is not added to the set of SpeakerInterfaces as there would be
@@ -1181,11 +1403,6 @@ SampleApplication::createApplicationMediaPlayer(
     }
     auto speaker = mediaPlayer->getSpeaker();
     return {std::move(mediaPlayer), speaker};
-#elif defined(UWP_BUILD)
-    auto mediaPlayer = std::make_shared<alexaSmartScreenSDK::sssdkCommon::TestMediaPlayer>();
-    auto speaker = std::make_shared<alexaSmartScreenSDK::sssdkCommon::NullMediaSpeaker>();
-
-    return {mediaPlayer, speaker};
 #endif
 }
 
@@ -13,8 +13,9 @@
  * permissions and limitations under the License.
  */
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
+#include <chrono>
+#include <cstdio>
+
 #include "SampleApp/SmartScreenCaptionPresenter.h"
 
 namespace alexaSmartScreenSDK {
@@ -23,8 +24,18 @@ namespace sampleApp {
 static const std::string TAG{"SmartScreenCaptionPresenter"};
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// A set style flag, the GUI Client expects the strings produced by @c std::to_string(bool).
+static const char STYLE_FLAG_SET[] = "1";
+
+/// An unset style flag.
+static const char STYLE_FLAG_UNSET[] = "0";
+
+/// Large enough for the decimal representation of any 64 bit value and the terminating null.
+static const size_t MAX_DIGITS = 21;
+
 SmartScreenCaptionPresenter::SmartScreenCaptionPresenter(
-    std::shared_ptr<smartScreenSDKInterfaces::RenderCaptionsInterface> renderCaptionsInterface) {
+    std::shared_ptr<smartScreenSDKInterfaces::RenderCaptionsInterface> renderCaptionsInterface) :
+        m_writer{m_buffer} {
     m_renderCaptionsInterface = renderCaptionsInterface;
 }
 
@@ -32,11 +43,15 @@ void SmartScreenCaptionPresenter::onCaptionActivity(
     const alexaClientSDK::captions::CaptionFrame& captionFrame,
     alexaClientSDK::avsCommon::avs::FocusState focusState) {
     if (alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND == focusState) {
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-
-        convertCaptionFrameToJson(captionFrame).Accept(writer);
-        m_renderCaptionsInterface->renderCaptions(buffer.GetString());
+        std::string payload;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_buffer.Clear();
+            m_writer.Reset(m_buffer);
+            writeCaptionFrame(captionFrame);
+            payload.assign(m_buffer.GetString(), m_buffer.GetSize());
+        }
+        m_renderCaptionsInterface->renderCaptions(payload);
     }
 }
 
@@ -46,87 +61,56 @@ std::pair<bool, int> SmartScreenCaptionPresenter::getWrapIndex(
     return std::make_pair(false, 0);
 }
 
-rapidjson::Document SmartScreenCaptionPresenter::convertCaptionFrameToJson(
-    const alexaClientSDK::captions::CaptionFrame& captionFrame) {
-    rapidjson::Document captionFrameJson(rapidjson::kObjectType);
-
-    captionFrameJson.AddMember(
-        "duration",
-        rapidjson::Value(std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDuration()).count())
-            .Move(),
-        captionFrameJson.GetAllocator());
-
-    captionFrameJson.AddMember(
-        "delay",
-        rapidjson::Value(std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDelay()).count()).Move(),
-        captionFrameJson.GetAllocator());
-
-    captionFrameJson.AddMember(
-        "captionLines",
-        rapidjson::Value(
-            convertCaptionLinesToJson(captionFrame.getCaptionLines(), captionFrameJson.GetAllocator()),
-            captionFrameJson.GetAllocator()),
-        captionFrameJson.GetAllocator());
-
-    return captionFrameJson;
-}
-
-rapidjson::Value SmartScreenCaptionPresenter::convertCaptionLinesToJson(
-    const std::vector<alexaClientSDK::captions::CaptionLine>& captionLines,
-    rapidjson::Document::AllocatorType& allocator) {
-    rapidjson::Value captionLinesJson(rapidjson::kArrayType);
-    for (const auto& captionLine : captionLines) {
-        captionLinesJson.PushBack(convertCaptionLineToJson(captionLine, allocator), allocator);
+void SmartScreenCaptionPresenter::writeCaptionFrame(const alexaClientSDK::captions::CaptionFrame& captionFrame) {
+    m_writer.StartObject();
+    m_writer.Key("duration");
+    m_writer.Int64(std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDuration()).count());
+    m_writer.Key("delay");
+    m_writer.Int64(std::chrono::duration_cast<std::chrono::milliseconds>(captionFrame.getDelay()).count());
+    m_writer.Key("captionLines");
+    m_writer.StartArray();
+    for (const auto& captionLine : captionFrame.getCaptionLines()) {
+        writeCaptionLine(captionLine);
     }
-
-    return captionLinesJson;
+    m_writer.EndArray();
+    m_writer.EndObject();
 }
 
-rapidjson::Value SmartScreenCaptionPresenter::convertCaptionLineToJson(
-    const alexaClientSDK::captions::CaptionLine& captionLine,
-    rapidjson::Document::AllocatorType& allocator) {
-    rapidjson::Value captionLineJson(rapidjson::kObjectType);
-    rapidjson::Value captionStyleArrayJson(rapidjson::kArrayType);
-
-    for (auto textStyle : captionLine.styles) {
-        captionStyleArrayJson.PushBack(convertTextStyleToJson(textStyle, allocator), allocator);
+void SmartScreenCaptionPresenter::writeCaptionLine(const alexaClientSDK::captions::CaptionLine& captionLine) {
+    m_writer.StartObject();
+    m_writer.Key("text");
+    m_writer.String(captionLine.text.c_str(), static_cast<rapidjson::SizeType>(captionLine.text.size()));
+    m_writer.Key("styles");
+    m_writer.StartArray();
+    for (const auto& textStyle : captionLine.styles) {
+        writeTextStyle(textStyle);
     }
-
-    captionLineJson.AddMember("text", rapidjson::Value(captionLine.text, allocator), allocator);
-
-    captionLineJson.AddMember("styles", rapidjson::Value(captionStyleArrayJson, allocator), allocator);
-
-    return captionLineJson;
+    m_writer.EndArray();
+    m_writer.EndObject();
 }
 
-rapidjson::Value SmartScreenCaptionPresenter::convertTextStyleToJson(
-    alexaClientSDK::captions::TextStyle textStyle,
-    rapidjson::Document::AllocatorType& allocator) {
-    rapidjson::Value textStyleJson(rapidjson::kObjectType);
-
-    textStyleJson.AddMember(
-        "activeStyle",
-        rapidjson::Value(convertStyleToJson(textStyle.activeStyle, allocator), allocator).Move(),
-        allocator);
-
-    textStyleJson.AddMember(
-        "charIndex", rapidjson::Value(std::to_string(textStyle.charIndex), allocator).Move(), allocator);
-
-    return textStyleJson;
+void SmartScreenCaptionPresenter::writeTextStyle(const alexaClientSDK::captions::TextStyle& textStyle) {
+    m_writer.StartObject();
+    m_writer.Key("activeStyle");
+    writeStyle(textStyle.activeStyle);
+    // The charIndex is sent as a string, as the GUI Client always received it.
+    char charIndex[MAX_DIGITS];
+    auto length =
+        std::snprintf(charIndex, sizeof(charIndex), "%llu", static_cast<unsigned long long>(textStyle.charIndex));
+    m_writer.Key("charIndex");
+    m_writer.String(charIndex, static_cast<rapidjson::SizeType>(length));
+    m_writer.EndObject();
 }
 
-rapidjson::Value SmartScreenCaptionPresenter::convertStyleToJson(
-    alexaClientSDK::captions::Style style,
-    rapidjson::Document::AllocatorType& allocator) {
-    rapidjson::Value styleJson(rapidjson::kObjectType);
-
-    styleJson.AddMember("bold", rapidjson::Value(std::to_string(style.m_bold), allocator).Move(), allocator);
-
-    styleJson.AddMember("italic", rapidjson::Value(std::to_string(style.m_italic), allocator).Move(), allocator);
-
-    styleJson.AddMember("underline", rapidjson::Value(std::to_string(style.m_underline), allocator).Move(), allocator);
-
-    return styleJson;
+void SmartScreenCaptionPresenter::writeStyle(const alexaClientSDK::captions::Style& style) {
+    m_writer.StartObject();
+    m_writer.Key("bold");
+    m_writer.String(style.m_bold ? STYLE_FLAG_SET : STYLE_FLAG_UNSET);
+    m_writer.Key("italic");
+    m_writer.String(style.m_italic ? STYLE_FLAG_SET : STYLE_FLAG_UNSET);
+    m_writer.Key("underline");
+    m_writer.String(style.m_underline ? STYLE_FLAG_SET : STYLE_FLAG_UNSET);
+    m_writer.EndObject();
 }
 }  // namespace sampleApp
-}  // namespace alexaSmartScreenSDK
\ No newline at end of file
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,260 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <ctime>
+#include <thread>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "SampleApp/StartupTaskGraph.h"
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+
+static const std::string TAG{"StartupTaskGraph"};
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/**
+ * @return The CPU time used by the calling thread, zero where the platform does not provide it
+ */
+static std::chrono::microseconds getThreadCpuTime() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    timespec time;
+    if (0 == clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time)) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec));
+    }
+#endif
+    return std::chrono::microseconds::zero();
+}
+
+/**
+ * @return The CPU time used by the process
+ */
+static std::chrono::microseconds getProcessCpuTime() {
+    return std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(
+        static_cast<double>(std::clock()) * std::micro::den / CLOCKS_PER_SEC));
+}
+
+/**
+ * Converts a duration to milliseconds for reports.
+ *
+ * @param duration The duration
+ * @return The duration in milliseconds
+ */
+static double toMilliseconds(std::chrono::microseconds duration) {
+    return duration.count() / 1000.0;
+}
+
+StartupTaskGraph::StartupTaskGraph() :
+        m_origin{Clock::now()},
+        m_originProcessCpuTime{getProcessCpuTime()},
+        m_firstPending{0} {
+}
+
+bool StartupTaskGraph::addTask(const std::string& name, Task task, const std::vector<std::string>& dependencies) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto findNode = [this](const std::string& nodeName) {
+        return std::find_if(
+            m_nodes.begin(), m_nodes.end(), [&nodeName](const Node& node) { return node.name == nodeName; });
+    };
+
+    if (!task) {
+        ACSDK_ERROR(LX("addTaskFailed").d("reason", "nullTask").d("name", name));
+        return false;
+    }
+    if (findNode(name) != m_nodes.end()) {
+        ACSDK_ERROR(LX("addTaskFailed").d("reason", "duplicateName").d("name", name));
+        return false;
+    }
+
+    Node node{name, std::move(task), {}, State::PENDING};
+    for (auto& dependency : dependencies) {
+        auto it = findNode(dependency);
+        if (it == m_nodes.end()) {
+            ACSDK_ERROR(LX("addTaskFailed")
+                            .d("reason", "unknownDependency")
+                            .d("name", name)
+                            .d("dependency", dependency));
+            return false;
+        }
+        node.dependencies.push_back(static_cast<size_t>(it - m_nodes.begin()));
+    }
+    m_nodes.push_back(std::move(node));
+    return true;
+}
+
+bool StartupTaskGraph::run() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    auto first = m_firstPending;
+    auto last = m_nodes.size();
+    m_firstPending = last;
+
+    std::condition_variable finished;
+    std::vector<std::thread> threads;
+    auto outstanding = last - first;
+    bool succeeded = true;
+
+    while (outstanding > 0) {
+        bool progress = false;
+        for (auto index = first; index < last; index++) {
+            auto& node = m_nodes[index];
+            if (State::PENDING != node.state) {
+                continue;
+            }
+
+            bool ready = true;
+            bool blocked = false;
+            for (auto dependency : node.dependencies) {
+                auto state = m_nodes[dependency].state;
+                if (State::FAILED == state || State::SKIPPED == state) {
+                    blocked = true;
+                } else if (State::SUCCEEDED != state) {
+                    ready = false;
+                }
+            }
+
+            if (blocked) {
+                ACSDK_WARN(LX("taskSkipped").d("name", node.name).d("reason", "dependencyFailed"));
+                node.state = State::SKIPPED;
+                succeeded = false;
+                outstanding--;
+                progress = true;
+            } else if (ready) {
+                node.state = State::RUNNING;
+                progress = true;
+                auto task = node.task;
+                threads.emplace_back([this, index, task, &finished, &outstanding, &succeeded]() {
+                    auto start = Clock::now();
+                    auto startCpuTime = getThreadCpuTime();
+                    bool result = task();
+                    auto threadCpuTime = getThreadCpuTime() - startCpuTime;
+                    auto end = Clock::now();
+
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    auto& node = m_nodes[index];
+                    node.state = result ? State::SUCCEEDED : State::FAILED;
+                    if (!result) {
+                        ACSDK_ERROR(LX("taskFailed").d("name", node.name));
+                        succeeded = false;
+                    }
+                    record(node.name, start, end, threadCpuTime, result);
+                    outstanding--;
+                    finished.notify_all();
+                });
+            }
+        }
+        // Task threads update the states while holding the lock, so no completion is missed between the scan above
+        // and the wait.
+        if (!progress && outstanding > 0) {
+            finished.wait(lock);
+        }
+    }
+    lock.unlock();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return succeeded;
+}
+
+bool StartupTaskGraph::runStep(const std::string& name, Task task) {
+    auto start = Clock::now();
+    auto startCpuTime = getThreadCpuTime();
+    bool result = task && task();
+    auto threadCpuTime = getThreadCpuTime() - startCpuTime;
+    auto end = Clock::now();
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    record(name, start, end, threadCpuTime, result);
+    return result;
+}
+
+std::chrono::microseconds StartupTaskGraph::mark(const std::string& name) {
+    auto now = Clock::now();
+    std::lock_guard<std::mutex> lock{m_mutex};
+    record(name, now, now, std::chrono::microseconds::zero(), true);
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - m_origin);
+}
+
+std::vector<StartupTaskGraph::StepTiming> StartupTaskGraph::getTimeline() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto timeline = m_timeline;
+    std::stable_sort(timeline.begin(), timeline.end(), [](const StepTiming& lhs, const StepTiming& rhs) {
+        return lhs.start < rhs.start;
+    });
+    return timeline;
+}
+
+void StartupTaskGraph::logTimeline() const {
+    for (auto& step : getTimeline()) {
+        ACSDK_INFO(LX("startupTimeline")
+                       .d("step", step.name)
+                       .d("startMs", toMilliseconds(step.start))
+                       .d("durationMs", toMilliseconds(step.duration))
+                       .d("threadCpuMs", toMilliseconds(step.threadCpuTime))
+                       .d("processCpuMs", toMilliseconds(step.processCpuTime))
+                       .d("succeeded", step.succeeded));
+    }
+}
+
+std::string StartupTaskGraph::getReport() const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("steps");
+    writer.StartArray();
+    for (auto& step : getTimeline()) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(step.name.c_str());
+        writer.Key("startMs");
+        writer.Double(toMilliseconds(step.start));
+        writer.Key("durationMs");
+        writer.Double(toMilliseconds(step.duration));
+        writer.Key("threadCpuMs");
+        writer.Double(toMilliseconds(step.threadCpuTime));
+        writer.Key("processCpuMs");
+        writer.Double(toMilliseconds(step.processCpuTime));
+        writer.Key("succeeded");
+        writer.Bool(step.succeeded);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+void StartupTaskGraph::record(
+    const std::string& name,
+    Clock::time_point start,
+    Clock::time_point end,
+    std::chrono::microseconds threadCpuTime,
+    bool succeeded) {
+    m_timeline.push_back(
+        {name,
+         std::chrono::duration_cast<std::chrono::microseconds>(start - m_origin),
+         std::chrono::duration_cast<std::chrono::microseconds>(end - start),
+         threadCpuTime,
+         getProcessCpuTime() - m_originProcessCpuTime,
+         succeeded});
+}
+
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
@@ -18,6 +18,7 @@
 #include <Utils/SmartScreenSDKVersion.h>
 
 #include <cstdlib>
+#include <fstream>
 #include <string>
 
 using namespace alexaSmartScreenSDK::sampleApp;
@@ -31,7 +32,7 @@ using namespace alexaSmartScreenSDK::sampleApp;
  */
 bool usesOptStyleArgs(int argc, char* argv[]) {
     for (int i = 1; i < argc; i++) {
-        if (!strcmp(argv[i], "-C") || !strcmp(argv[i], "-K") || !strcmp(argv[i], "-L")) {
+        if (!strcmp(argv[i], "-C") || !strcmp(argv[i], "-K") || !strcmp(argv[i], "-L") || !strcmp(argv[i], "-R")) {
             return true;
         }
     }
@@ -39,6 +40,23 @@ bool usesOptStyleArgs(int argc, char* argv[]) {
     return false;
 }
 
+/**
+ * Writes the timing of the initialization phases of the application.
+ *
+ * @param sampleApplication The initialized application.
+ * @param path The file to write the report to.
+ * @return @c true if the report was written, @c false otherwise.
+ */
+static bool writeStartupReport(const SampleApplication& sampleApplication, const std::string& path) {
+    std::ofstream report(path);
+    report << sampleApplication.getStartupReport() << std::endl;
+    if (!report.good()) {
+        ConsolePrinter::simplePrint("Failed to write startup report " + path);
+        return false;
+    }
+    return true;
+}
+
 /**
  * This serves as the starting point for the application. This code instantiates the @c UserInputManager and processes
  * user input until the @c run() function returns.
@@ -51,6 +69,7 @@ int main(int argc, char* argv[]) {
     std::vector<std::string> configFiles;
     std::string pathToKWDInputFolder;
     std::string logLevel;
+    std::string startupReportPath;
 
     ConsolePrinter::simplePrint(
         "SmartScreenSDKVersion " + alexaSmartScreenSDK::utils::smartScreenSDKVersion::getCurrentVersion());
@@ -75,10 +94,16 @@ int main(int argc, char* argv[]) {
                     return SampleAppReturnCode::ERROR;
                 }
                 logLevel = std::string(argv[++i]);
+            } else if (strcmp(argv[i], "-R") == 0) {
+                if (i + 1 == argc) {
+                    ConsolePrinter::simplePrint("No report file specified for -R option");
+                    return SampleAppReturnCode::ERROR;
+                }
+                startupReportPath = std::string(argv[++i]);
             } else {
                 ConsolePrinter::simplePrint(
                     "USAGE: " + std::string(argv[0]) + " -C <config1.json> -C <config2.json> ... -C <configN.json> " +
-                    " -K <path_to_inputs_folder> -L <log_level>");
+                    " -K <path_to_inputs_folder> -L <log_level> -R <startup_report.json>");
                 return SampleAppReturnCode::ERROR;
             }
         }
@@ -119,6 +144,14 @@ int main(int argc, char* argv[]) {
             ConsolePrinter::simplePrint("Failed to create to SampleApplication!");
             return SampleAppReturnCode::ERROR;
         }
+        if (!startupReportPath.empty() && !writeStartupReport(*sampleApplication, startupReportPath)) {
+            return SampleAppReturnCode::ERROR;
+        }
+#ifdef STARTUP_BENCHMARK
+        // The benchmark measures a single cold start and exits once the application is initialized.
+        ConsolePrinter::simplePrint(sampleApplication->getStartupReport());
+        return SampleAppReturnCode::OK;
+#endif
         returnCode = sampleApplication->run();
         sampleApplication.reset();
     } while (SampleAppReturnCode::RESTART == returnCode);
@@ -0,0 +1,101 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <SampleApp/AplClientBridge.h>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+namespace test {
+
+using alexaClientSDK::avsCommon::utils::logger::Level;
+using APLClient::LogLevel;
+using APLClient::LogSubsystem;
+
+class AplClientBridgeTest : public ::testing::Test {
+protected:
+    /**
+     * Creates the bridge under test.
+     *
+     * @param aplClientLogLevel Most verbose level logged for the APL client binding
+     * @param aplCoreEngineLogLevel Most verbose level logged for the APL core engine
+     */
+    void createBridge(Level aplClientLogLevel, Level aplCoreEngineLogLevel);
+
+    /// The bridge under test.
+    std::shared_ptr<AplClientBridge> m_bridge;
+};
+
+void AplClientBridgeTest::createBridge(Level aplClientLogLevel, Level aplCoreEngineLogLevel) {
+    AplClientBridgeParameter parameters{1, "", aplClientLogLevel, aplCoreEngineLogLevel};
+    m_bridge = AplClientBridge::create(nullptr, nullptr, parameters);
+    ASSERT_TRUE(m_bridge);
+}
+
+/**
+ * Test that messages of the APL client binding are logged from the aplClientLogLevel on, whatever the level of the
+ * core engine.
+ */
+TEST_F(AplClientBridgeTest, test_clientMessagesFollowClientLogLevel) {
+    createBridge(Level::WARN, Level::NONE);
+
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::INFO, LogSubsystem::CLIENT));
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::WARN, LogSubsystem::CLIENT));
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::ERROR, LogSubsystem::CLIENT));
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::CRITICAL, LogSubsystem::CLIENT));
+}
+
+/**
+ * Test that messages of the APL core engine are logged from the aplCoreEngineLogLevel on, whatever the level of the
+ * client binding.
+ */
+TEST_F(AplClientBridgeTest, test_coreEngineMessagesFollowCoreEngineLogLevel) {
+    createBridge(Level::INFO, Level::ERROR);
+
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::INFO, LogSubsystem::CORE_ENGINE));
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::WARN, LogSubsystem::CORE_ENGINE));
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::ERROR, LogSubsystem::CORE_ENGINE));
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::CRITICAL, LogSubsystem::CORE_ENGINE));
+
+    EXPECT_TRUE(m_bridge->shouldLog(LogLevel::WARN, LogSubsystem::CLIENT));
+}
+
+/**
+ * Test that a subsystem whose level is NONE logs nothing, not even critical messages.
+ */
+TEST_F(AplClientBridgeTest, test_noneDisablesSubsystem) {
+    createBridge(Level::NONE, Level::NONE);
+
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::CRITICAL, LogSubsystem::CLIENT));
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::CRITICAL, LogSubsystem::CORE_ENGINE));
+}
+
+/**
+ * Test that debug and trace messages below the subsystem levels are not logged.
+ */
+TEST_F(AplClientBridgeTest, test_debugMessagesBelowSubsystemLevelsAreNotLogged) {
+    createBridge(Level::DEBUG0, Level::INFO);
+
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::TRACE, LogSubsystem::CLIENT));
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::DBG, LogSubsystem::CORE_ENGINE));
+    EXPECT_FALSE(m_bridge->shouldLog(LogLevel::TRACE, LogSubsystem::CORE_ENGINE));
+}
+
+}  // namespace test
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
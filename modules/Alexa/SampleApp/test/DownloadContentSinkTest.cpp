@@ -0,0 +1,102 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <SampleApp/DownloadContentSink.h>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+namespace test {
+
+using namespace ::testing;
+using WriteStatus = alexaClientSDK::avsCommon::avs::attachment::AttachmentWriter::WriteStatus;
+
+/// Chunk size used by the tests.
+static const size_t TEST_CHUNK_SIZE = 4;
+
+/**
+ * Test that written data is collected in order across buffer growth.
+ */
+TEST(DownloadContentSinkTest, test_writeCollectsContent) {
+    DownloadContentSink sink(0, TEST_CHUNK_SIZE);
+    WriteStatus status;
+
+    std::string first = "hello ";
+    std::string second = "world";
+    EXPECT_EQ(first.size(), sink.write(first.data(), first.size(), &status));
+    EXPECT_EQ(WriteStatus::OK, status);
+    EXPECT_EQ(second.size(), sink.write(second.data(), second.size(), &status));
+    EXPECT_EQ(WriteStatus::OK, status);
+    EXPECT_EQ(first.size() + second.size(), sink.getBytesWritten());
+
+    sink.close();
+    EXPECT_EQ("hello world", sink.takeContent());
+}
+
+/**
+ * Test that the completion future only becomes ready once the sink is closed.
+ */
+TEST(DownloadContentSinkTest, test_completionSignalledOnClose) {
+    DownloadContentSink sink(16, TEST_CHUNK_SIZE);
+    auto completion = sink.getCompletionFuture();
+    EXPECT_EQ(std::future_status::timeout, completion.wait_for(std::chrono::milliseconds(0)));
+
+    sink.close();
+    EXPECT_EQ(std::future_status::ready, completion.wait_for(std::chrono::milliseconds(0)));
+
+    // Closing again is a no-op.
+    sink.close();
+}
+
+/**
+ * Test that the completion carries whether every expected byte was received.
+ */
+TEST(DownloadContentSinkTest, test_completionCarriesStatus) {
+    WriteStatus status;
+    std::string data = "data";
+
+    DownloadContentSink unknownSize(0, TEST_CHUNK_SIZE);
+    unknownSize.write(data.data(), data.size(), &status);
+    unknownSize.close();
+    EXPECT_EQ(DownloadContentSink::Status::COMPLETE, unknownSize.getCompletionFuture().get());
+
+    DownloadContentSink complete(data.size(), TEST_CHUNK_SIZE);
+    complete.write(data.data(), data.size(), &status);
+    complete.close();
+    EXPECT_EQ(DownloadContentSink::Status::COMPLETE, complete.getCompletionFuture().get());
+
+    DownloadContentSink incomplete(data.size() * 2, TEST_CHUNK_SIZE);
+    incomplete.write(data.data(), data.size(), &status);
+    incomplete.close();
+    EXPECT_EQ(DownloadContentSink::Status::INCOMPLETE, incomplete.getCompletionFuture().get());
+}
+
+/**
+ * Test that writes after close are rejected.
+ */
+TEST(DownloadContentSinkTest, test_writeAfterCloseFails) {
+    DownloadContentSink sink(0, TEST_CHUNK_SIZE);
+    WriteStatus status;
+    sink.close();
+
+    std::string data = "data";
+    EXPECT_EQ(0u, sink.write(data.data(), data.size(), &status));
+    EXPECT_EQ(WriteStatus::CLOSED, status);
+    EXPECT_TRUE(sink.takeContent().empty());
+}
+
+}  // namespace test
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
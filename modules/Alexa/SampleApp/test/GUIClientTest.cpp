@@ -0,0 +1,454 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <rapidjson/pointer.h>
+
+#include <APLClient/AplTrace.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <RegistrationManager/CustomerDataManager.h>
+#include <SampleApp/AplClientBridge.h>
+#include <SampleApp/GUI/GUIClient.h>
+
+#include "StubMiscStorage.h"
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+namespace gui {
+namespace test {
+
+using namespace ::testing;
+using namespace alexaClientSDK;
+using namespace smartScreenSDKInterfaces::test;
+
+/// Short initResponse timeout so that the tests run through every initRequest quickly.
+static const std::chrono::milliseconds TEST_INIT_RESPONSE_TIMEOUT{50};
+
+/// initResponse timeout leaving time to answer an initRequest before all of them are sent.
+static const std::chrono::milliseconds LONG_INIT_RESPONSE_TIMEOUT{200};
+
+/// Number of initRequests sent before they are no longer repeated.
+static const size_t MAX_INIT_REQUESTS = 5;
+
+/// Time to wait for an expected message.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// Time after which no more messages are expected.
+static const std::chrono::milliseconds QUIET_PERIOD{500};
+
+/// Message type of the initRequest.
+static const std::string INIT_REQUEST_TYPE = "initRequest";
+
+/// Message type of the GUI configuration sent once the handshake succeeded.
+static const std::string GUI_CONFIGURATION_TYPE = "guiConfiguration";
+
+/// A valid initResponse, with the APL version the client starts with so no restart is requested.
+static const std::string INIT_RESPONSE = R"({"type":"initResponse","isSupported":true,"APLMaxVersion":"1.3"})";
+
+/// An initResponse rejecting the SDK version.
+static const std::string UNSUPPORTED_INIT_RESPONSE =
+    R"({"type":"initResponse","isSupported":false,"APLMaxVersion":"1.3"})";
+
+/// Message type of a complete player info card.
+static const std::string RENDER_PLAYER_INFO_TYPE = "renderPlayerInfo";
+
+/// Message type of an update of the displayed player info card.
+static const std::string PLAYER_INFO_UPDATE_TYPE = "playerInfoUpdate";
+
+/// A RenderPlayerInfo payload.
+static const std::string PLAYER_INFO =
+    R"({"audioItemId":"item1","content":{"title":"First","art":"art1"},)"
+    R"("controls":[{"name":"SHUFFLE","selected":false}]})";
+
+/// @c PLAYER_INFO with another title and art.
+static const std::string PLAYER_INFO_NEW_CONTENT =
+    R"({"audioItemId":"item1","content":{"title":"Second","art":"art2"},)"
+    R"("controls":[{"name":"SHUFFLE","selected":false}]})";
+
+/// @c PLAYER_INFO_NEW_CONTENT with another control selection, and its members in another order.
+static const std::string PLAYER_INFO_NEW_CONTROLS =
+    R"({"controls":[{"name":"SHUFFLE","selected":true}],)"
+    R"("content":{"art":"art2","title":"Second"},"audioItemId":"item1"})";
+
+/// @c PLAYER_INFO without its controls.
+static const std::string PLAYER_INFO_WITHOUT_CONTROLS =
+    R"({"audioItemId":"item1","content":{"title":"First","art":"art1"}})";
+
+/// A RenderPlayerInfo payload for another audio item.
+static const std::string OTHER_PLAYER_INFO = R"({"audioItemId":"item2","content":{"title":"Other","art":"art3"}})";
+
+/// Player state of a playing audio item.
+static const smartScreenSDKInterfaces::AudioPlayerInfo PLAYING_INFO{avsCommon::avs::PlayerActivity::PLAYING,
+                                                                    std::chrono::milliseconds(0)};
+
+/// Player state of a paused audio item.
+static const smartScreenSDKInterfaces::AudioPlayerInfo PAUSED_INFO{avsCommon::avs::PlayerActivity::PAUSED,
+                                                                   std::chrono::milliseconds(1000)};
+
+/// Configuration of the GUI client.
+static const std::string GUI_CONFIGURATION = R"({"gui":{"visualCharacteristics":[],"appConfig":{}}})";
+
+/// Messaging server recording the messages written to the client.
+class TestMessagingServer : public smartScreenSDKInterfaces::MessagingServerInterface {
+public:
+    bool start() override {
+        return true;
+    }
+
+    void stop() override {
+    }
+
+    bool isReady() override {
+        return true;
+    }
+
+    void setObserver(const std::shared_ptr<smartScreenSDKInterfaces::MessagingServerObserverInterface>&) override {
+    }
+
+    void setMessageListener(std::shared_ptr<smartScreenSDKInterfaces::MessageListenerInterface>) override {
+    }
+
+    void writeMessage(const std::string& payload) override {
+        rapidjson::Document message;
+        message.Parse(payload);
+        if (message.HasParseError() || !message.IsObject() || !message.HasMember("type")) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_messages.push_back({message["type"].GetString(), payload});
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Waits until a number of messages of a type were written.
+     *
+     * @param type The message type
+     * @param count The number of messages
+     * @param timeout Maximum time to wait
+     * @return Whether @c count messages of @c type were written in time
+     */
+    bool waitForMessages(const std::string& type, size_t count, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        return m_wakeTrigger.wait_for(lock, timeout, [this, &type, count] { return countLocked(type) >= count; });
+    }
+
+    /**
+     * @param type The message type
+     * @return The number of messages of @c type written
+     */
+    size_t count(const std::string& type) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return countLocked(type);
+    }
+
+    /**
+     * Waits for the next message of a type which was not returned yet.
+     *
+     * @param type The message type
+     * @param[out] message The message
+     * @return Whether the message was written in time
+     */
+    bool waitForNextMessage(const std::string& type, rapidjson::Document* message) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        auto& next = m_nextMessage[type];
+        std::string payload;
+        auto found = m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, &type, &next, &payload] {
+            for (; next < m_messages.size(); next++) {
+                if (m_messages[next].first == type) {
+                    payload = m_messages[next++].second;
+                    return true;
+                }
+            }
+            return false;
+        });
+        return found && !message->Parse(payload).HasParseError();
+    }
+
+private:
+    /**
+     * @param type The message type
+     * @return The number of messages of @c type written, with @c m_mutex held
+     */
+    size_t countLocked(const std::string& type) {
+        size_t result = 0;
+        for (const auto& written : m_messages) {
+            result += (written.first == type) ? 1 : 0;
+        }
+        return result;
+    }
+
+    /// Serializes access to @c m_messages and @c m_nextMessage.
+    std::mutex m_mutex;
+
+    /// Notified when a message is written.
+    std::condition_variable m_wakeTrigger;
+
+    /// Type and text of the messages written, in order.
+    std::vector<std::pair<std::string, std::string>> m_messages;
+
+    /// Position in @c m_messages from which @c waitForNextMessage looks for a message, by type.
+    std::map<std::string, size_t> m_nextMessage;
+};
+
+class GUIClientTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    void TearDown() override;
+
+protected:
+    /**
+     * Creates the client under test, with an APL client bridge which dumps the APL trace once it runs.
+     *
+     * @param initResponseTimeout Time the client waits for the initResponse
+     */
+    void createClient(std::chrono::milliseconds initResponseTimeout);
+
+    /**
+     * @return Whether the APL client bridge ran since the connection opened, by its dump of the APL trace
+     */
+    bool isBridgeRunning();
+
+    /// The messaging server
+    std::shared_ptr<TestMessagingServer> m_server;
+
+    /// The client under test
+    std::shared_ptr<GUIClient> m_client;
+
+    /// The APL client bridge of the client
+    std::shared_ptr<AplClientBridge> m_bridge;
+
+    /// File the APL client bridge dumps the APL trace to
+    std::string m_tracePath;
+};
+
+void GUIClientTest::SetUp() {
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream());
+    (*configuration) << GUI_CONFIGURATION;
+    ASSERT_TRUE(avsCommon::utils::configuration::ConfigurationNode::initialize({configuration}));
+
+    char pathTemplate[] = "/tmp/GUIClientTestXXXXXX";
+    int fd = mkstemp(pathTemplate);
+    ASSERT_NE(-1, fd);
+    close(fd);
+    m_tracePath = pathTemplate;
+    std::remove(m_tracePath.c_str());
+}
+
+void GUIClientTest::TearDown() {
+    if (m_bridge) {
+        m_bridge->onConnectionClosed();
+    }
+    if (m_client) {
+        m_client->shutdown();
+    }
+    m_bridge.reset();
+    m_client.reset();
+    std::remove(m_tracePath.c_str());
+    avsCommon::utils::configuration::ConfigurationNode::uninitialize();
+}
+
+void GUIClientTest::createClient(std::chrono::milliseconds initResponseTimeout) {
+    m_server = std::make_shared<TestMessagingServer>();
+    m_client = GUIClient::create(
+        m_server,
+        std::make_shared<StubMiscStorage>(),
+        std::make_shared<registrationManager::CustomerDataManager>(),
+        initResponseTimeout);
+    ASSERT_TRUE(m_client);
+
+    AplClientBridgeParameter parameters{
+        1, m_tracePath, avsCommon::utils::logger::Level::NONE, avsCommon::utils::logger::Level::NONE};
+    m_bridge = AplClientBridge::create(nullptr, m_client, parameters);
+    m_client->setAplClientBridge(m_bridge);
+    APLClient::AplTraceRecorder::getInstance().requestDump();
+}
+
+bool GUIClientTest::isBridgeRunning() {
+    auto deadline = std::chrono::steady_clock::now() + QUIET_PERIOD;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (std::ifstream(m_tracePath).good()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+/**
+ * Test that the initRequest is sent again while the initResponse is overdue, and no more once it was sent the maximum
+ * number of times.
+ */
+TEST_F(GUIClientTest, test_initRequestSentAgainOnTimeout) {
+    createClient(TEST_INIT_RESPONSE_TIMEOUT);
+    m_client->onConnectionOpened();
+
+    ASSERT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, MAX_INIT_REQUESTS, WAIT_TIMEOUT));
+    std::this_thread::sleep_for(QUIET_PERIOD);
+    EXPECT_EQ(MAX_INIT_REQUESTS, m_server->count(INIT_REQUEST_TYPE));
+    EXPECT_EQ(0u, m_server->count(GUI_CONFIGURATION_TYPE));
+    EXPECT_FALSE(isBridgeRunning());
+}
+
+/**
+ * Test that a new connection starts the handshake again once the initRequests of the previous one are exhausted.
+ */
+TEST_F(GUIClientTest, test_reopenedConnectionRestartsHandshake) {
+    createClient(TEST_INIT_RESPONSE_TIMEOUT);
+    m_client->onConnectionOpened();
+    ASSERT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, MAX_INIT_REQUESTS, WAIT_TIMEOUT));
+
+    m_client->onConnectionClosed();
+    m_client->onConnectionOpened();
+
+    EXPECT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, MAX_INIT_REQUESTS + 1, WAIT_TIMEOUT));
+    m_client->onMessage(INIT_RESPONSE);
+    EXPECT_TRUE(m_server->waitForMessages(GUI_CONFIGURATION_TYPE, 1, WAIT_TIMEOUT));
+}
+
+/**
+ * Test that an initResponse answering an earlier initRequest completes the handshake.
+ */
+TEST_F(GUIClientTest, test_lateInitResponseCompletesHandshake) {
+    createClient(LONG_INIT_RESPONSE_TIMEOUT);
+    m_client->onConnectionOpened();
+    ASSERT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, 2, WAIT_TIMEOUT));
+
+    m_client->onMessage(INIT_RESPONSE);
+
+    EXPECT_TRUE(m_server->waitForMessages(GUI_CONFIGURATION_TYPE, 1, WAIT_TIMEOUT));
+    EXPECT_TRUE(isBridgeRunning());
+    std::this_thread::sleep_for(QUIET_PERIOD);
+    EXPECT_GT(MAX_INIT_REQUESTS, m_server->count(INIT_REQUEST_TYPE));
+}
+
+/**
+ * Test that an initResponse arriving once the initRequest is no longer repeated still completes the handshake.
+ */
+TEST_F(GUIClientTest, test_initResponseAfterLastInitRequestCompletesHandshake) {
+    createClient(TEST_INIT_RESPONSE_TIMEOUT);
+    m_client->onConnectionOpened();
+    ASSERT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, MAX_INIT_REQUESTS, WAIT_TIMEOUT));
+    EXPECT_FALSE(isBridgeRunning());
+
+    m_client->onMessage(INIT_RESPONSE);
+
+    EXPECT_TRUE(m_server->waitForMessages(GUI_CONFIGURATION_TYPE, 1, WAIT_TIMEOUT));
+    EXPECT_TRUE(isBridgeRunning());
+}
+
+/**
+ * Test that a rejected initResponse stops the initRequests without completing the handshake, and that a valid one
+ * arriving afterwards still completes it.
+ */
+TEST_F(GUIClientTest, test_validInitResponseAfterRejectedOneCompletesHandshake) {
+    createClient(TEST_INIT_RESPONSE_TIMEOUT);
+    m_client->onConnectionOpened();
+    ASSERT_TRUE(m_server->waitForMessages(INIT_REQUEST_TYPE, 1, WAIT_TIMEOUT));
+
+    m_client->onMessage(UNSUPPORTED_INIT_RESPONSE);
+    EXPECT_FALSE(isBridgeRunning());
+    auto requests = m_server->count(INIT_REQUEST_TYPE);
+    std::this_thread::sleep_for(QUIET_PERIOD);
+    EXPECT_GE(requests + 1, m_server->count(INIT_REQUEST_TYPE));
+    EXPECT_EQ(0u, m_server->count(GUI_CONFIGURATION_TYPE));
+
+    m_client->onMessage(INIT_RESPONSE);
+    EXPECT_TRUE(m_server->waitForMessages(GUI_CONFIGURATION_TYPE, 1, WAIT_TIMEOUT));
+    EXPECT_TRUE(isBridgeRunning());
+}
+
+/**
+ * Test that a new RenderPlayerInfo for the displayed audio item is sent as an update carrying only the payload members
+ * which changed, and no payload if only the player state changed.
+ */
+TEST_F(GUIClientTest, test_playerInfoUpdateCarriesChangedPayloadMembers) {
+    createClient(GUIClient::DEFAULT_INIT_RESPONSE_TIMEOUT);
+    rapidjson::Document message;
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+    EXPECT_EQ("First", std::string(rapidjson::Pointer("/payload/content/title").Get(message)->GetString()));
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO, PAUSED_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(PLAYER_INFO_UPDATE_TYPE, &message));
+    EXPECT_EQ("item1", std::string(message["audioItemId"].GetString()));
+    EXPECT_EQ("PAUSED", std::string(message["audioPlayerState"].GetString()));
+    EXPECT_FALSE(message.HasMember("payload"));
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO_NEW_CONTENT, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(PLAYER_INFO_UPDATE_TYPE, &message));
+    ASSERT_TRUE(message.HasMember("payload"));
+    EXPECT_EQ(1u, message["payload"].MemberCount());
+    EXPECT_EQ("Second", std::string(rapidjson::Pointer("/payload/content/title").Get(message)->GetString()));
+    EXPECT_EQ("art2", std::string(rapidjson::Pointer("/payload/content/art").Get(message)->GetString()));
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO_NEW_CONTROLS, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(PLAYER_INFO_UPDATE_TYPE, &message));
+    ASSERT_TRUE(message.HasMember("payload"));
+    EXPECT_EQ(1u, message["payload"].MemberCount());
+    EXPECT_TRUE(rapidjson::Pointer("/payload/controls/0/selected").Get(message)->GetBool());
+
+    EXPECT_EQ(1u, m_server->count(RENDER_PLAYER_INFO_TYPE));
+}
+
+/**
+ * Test that the complete card is sent for another audio item, once the card was cleared, and when a member of the
+ * displayed payload is missing from the new one.
+ */
+TEST_F(GUIClientTest, test_playerInfoSentInFull) {
+    createClient(GUIClient::DEFAULT_INIT_RESPONSE_TIMEOUT);
+    rapidjson::Document message;
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+
+    m_client->renderPlayerInfoCard(OTHER_PLAYER_INFO, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+    EXPECT_EQ("item2", std::string(rapidjson::Pointer("/payload/audioItemId").Get(message)->GetString()));
+
+    m_client->clearPlayerInfoCard();
+    m_client->renderPlayerInfoCard(OTHER_PLAYER_INFO, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+    EXPECT_EQ("item2", std::string(rapidjson::Pointer("/payload/audioItemId").Get(message)->GetString()));
+
+    m_client->renderPlayerInfoCard(PLAYER_INFO, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+    m_client->renderPlayerInfoCard(PLAYER_INFO_WITHOUT_CONTROLS, PLAYING_INFO, avsCommon::avs::FocusState::FOREGROUND);
+    ASSERT_TRUE(m_server->waitForNextMessage(RENDER_PLAYER_INFO_TYPE, &message));
+    EXPECT_FALSE(rapidjson::Pointer("/payload/controls").Get(message));
+
+    EXPECT_EQ(0u, m_server->count(PLAYER_INFO_UPDATE_TYPE));
+}
+
+}  // namespace test
+}  // namespace gui
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
@@ -0,0 +1,133 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <ftw.h>
+
+#include <gtest/gtest.h>
+#include <SampleApp/LocalPackageStore.h>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+namespace test {
+
+using namespace ::testing;
+
+/// Package name used by the tests.
+static const std::string TEST_PACKAGE_NAME = "alexa-layouts";
+/// Package version used by the tests.
+static const std::string TEST_PACKAGE_VERSION = "1.1.0";
+/// Package content used by the tests.
+static const std::string TEST_PACKAGE_CONTENT = R"({"type":"APL","version":"1.4"})";
+
+/// Maximum number of directories @c nftw keeps open while removing the store root.
+static const int MAX_OPEN_DIRECTORIES = 16;
+
+/**
+ * Removes a file or an emptied directory, as a callback of @c nftw.
+ *
+ * @param path The path
+ * @return The result of @c remove
+ */
+static int removeEntry(const char* path, const struct stat*, int, struct FTW*) {
+    return remove(path);
+}
+
+class LocalPackageStoreTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    /// Temporary root directory of the store.
+    std::string m_rootPath;
+
+    /// The store under test.
+    std::shared_ptr<LocalPackageStore> m_store;
+};
+
+void LocalPackageStoreTest::SetUp() {
+    char rootTemplate[] = "/tmp/LocalPackageStoreTestXXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(rootTemplate));
+    m_rootPath = rootTemplate;
+    m_store = LocalPackageStore::create(m_rootPath);
+    ASSERT_NE(nullptr, m_store);
+}
+
+void LocalPackageStoreTest::TearDown() {
+    m_store.reset();
+    if (!m_rootPath.empty()) {
+        EXPECT_EQ(0, nftw(m_rootPath.c_str(), removeEntry, MAX_OPEN_DIRECTORIES, FTW_DEPTH | FTW_PHYS));
+    }
+}
+
+/**
+ * Test that a stored package is resolved both by name/version and by its CDN URL.
+ */
+TEST_F(LocalPackageStoreTest, test_putAndResolvePackage) {
+    ASSERT_TRUE(m_store->putPackage(TEST_PACKAGE_NAME, TEST_PACKAGE_VERSION, TEST_PACKAGE_CONTENT));
+
+    std::string content;
+    EXPECT_TRUE(m_store->getPackage(TEST_PACKAGE_NAME, TEST_PACKAGE_VERSION, &content));
+    EXPECT_EQ(TEST_PACKAGE_CONTENT, content);
+
+    content.clear();
+    auto source = LocalPackageStore::DEFAULT_IMPORT_BASE_URL + TEST_PACKAGE_NAME + "/" + TEST_PACKAGE_VERSION +
+                  "/document.json";
+    EXPECT_TRUE(m_store->getPackageBySource(source, &content));
+    EXPECT_EQ(TEST_PACKAGE_CONTENT, content);
+
+    content.clear();
+    source = "file://" + m_rootPath + "/" + TEST_PACKAGE_NAME + "/" + TEST_PACKAGE_VERSION + "/document.json";
+    EXPECT_TRUE(m_store->getPackageBySource(source, &content));
+    EXPECT_EQ(TEST_PACKAGE_CONTENT, content);
+}
+
+/**
+ * Test that unknown packages and sources outside of the store are not resolved.
+ */
+TEST_F(LocalPackageStoreTest, test_unresolvedSources) {
+    std::string content;
+    EXPECT_FALSE(m_store->getPackage(TEST_PACKAGE_NAME, TEST_PACKAGE_VERSION, &content));
+    EXPECT_FALSE(m_store->getPackage("..", TEST_PACKAGE_VERSION, &content));
+    EXPECT_FALSE(m_store->getPackageBySource("https://example.com/packages/a/1.0/document.json", &content));
+    EXPECT_FALSE(m_store->getPackageBySource("file:///etc/passwd", &content));
+    EXPECT_FALSE(m_store->getPackageBySource("file://" + m_rootPath + "/../../etc/passwd", &content));
+}
+
+/**
+ * Test that a bundle pre-seeds the store.
+ */
+TEST_F(LocalPackageStoreTest, test_importBundle) {
+    auto bundlePath = m_rootPath + "/bundle.json";
+    {
+        std::ofstream bundle(bundlePath);
+        bundle << R"({"packages":[{"name":")" << TEST_PACKAGE_NAME << R"(","version":")" << TEST_PACKAGE_VERSION
+               << R"(","document":)" << TEST_PACKAGE_CONTENT << R"(},{"name":"invalid"}]})";
+    }
+
+    EXPECT_EQ(1, m_store->importBundle(bundlePath));
+
+    std::string content;
+    EXPECT_TRUE(m_store->getPackage(TEST_PACKAGE_NAME, TEST_PACKAGE_VERSION, &content));
+    EXPECT_EQ(TEST_PACKAGE_CONTENT, content);
+}
+
+}  // namespace test
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
@@ -84,6 +84,31 @@ TEST_F(SmartScreenCaptionPresenterTest, test_renderCaptionsHappyCase) {
 
     m_captionPresenter->onCaptionActivity(captionFrame, alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND);
 }
+
+/**
+ * Test that a frame rendered after a longer one does not carry over any of its content
+ */
+TEST_F(SmartScreenCaptionPresenterTest, test_renderConsecutiveCaptions) {
+    Style style = Style(false, true, false);
+    CaptionLine longCaptionLine = CaptionLine("A longer test caption line", {TextStyle(12, style)});
+    CaptionFrame longCaptionFrame =
+        CaptionFrame(0, std::chrono::milliseconds(2000), std::chrono::milliseconds(10), {longCaptionLine});
+    CaptionFrame shortCaptionFrame =
+        CaptionFrame(1, std::chrono::milliseconds(500), std::chrono::milliseconds(0), {CaptionLine("Short", {})});
+
+    std::string expectedLongPayloadString =
+        R"({"duration":2000,"delay":10,"captionLines":[{"text":"A longer test caption line","styles":[{"activeStyle":{"bold":"0","italic":"1","underline":"0"},"charIndex":"12"}]}]})";
+    std::string expectedShortPayloadString =
+        R"({"duration":500,"delay":0,"captionLines":[{"text":"Short","styles":[]}]})";
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_mockRenderCaptionsInterface, renderCaptions(expectedLongPayloadString)).Times(Exactly(1));
+        EXPECT_CALL(*m_mockRenderCaptionsInterface, renderCaptions(expectedShortPayloadString)).Times(Exactly(1));
+    }
+
+    m_captionPresenter->onCaptionActivity(longCaptionFrame, alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND);
+    m_captionPresenter->onCaptionActivity(shortCaptionFrame, alexaClientSDK::avsCommon::avs::FocusState::FOREGROUND);
+}
 }  // namespace test
 }  // namespace sampleApp
 }  // namespace alexaSmartScreenSDK
@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <SampleApp/StartupTaskGraph.h>
+
+namespace alexaSmartScreenSDK {
+namespace sampleApp {
+namespace test {
+
+using namespace ::testing;
+
+/// Time a task waits for another task running concurrently.
+static const std::chrono::seconds CONCURRENCY_TIMEOUT{5};
+
+/// Wall time a compute bound step runs for.
+static const std::chrono::milliseconds BUSY_DURATION{50};
+
+/// Wall time a waiting step sleeps for.
+static const std::chrono::milliseconds SLEEP_DURATION{50};
+
+class StartupTaskGraphTest : public ::testing::Test {
+protected:
+    /// The graph under test.
+    StartupTaskGraph m_graph;
+};
+
+/**
+ * Verify that independent tasks run concurrently.
+ */
+TEST_F(StartupTaskGraphTest, testIndependentTasksRunConcurrently) {
+    std::promise<void> firstStarted;
+    std::promise<void> secondStarted;
+    auto firstFuture = firstStarted.get_future();
+    auto secondFuture = secondStarted.get_future();
+
+    ASSERT_TRUE(m_graph.addTask("first", [&]() {
+        firstStarted.set_value();
+        return std::future_status::ready == secondFuture.wait_for(CONCURRENCY_TIMEOUT);
+    }));
+    ASSERT_TRUE(m_graph.addTask("second", [&]() {
+        secondStarted.set_value();
+        return std::future_status::ready == firstFuture.wait_for(CONCURRENCY_TIMEOUT);
+    }));
+
+    EXPECT_TRUE(m_graph.run());
+}
+
+/**
+ * Verify that a task starts only after its dependencies have finished.
+ */
+TEST_F(StartupTaskGraphTest, testDependenciesRunFirst) {
+    std::atomic<int> finished{0};
+    int finishedBeforeDependent = -1;
+
+    ASSERT_TRUE(m_graph.addTask("a", [&]() {
+        finished++;
+        return true;
+    }));
+    ASSERT_TRUE(m_graph.addTask("b", [&]() {
+        finished++;
+        return true;
+    }));
+    ASSERT_TRUE(m_graph.addTask(
+        "c",
+        [&]() {
+            finishedBeforeDependent = finished;
+            return true;
+        },
+        {"a", "b"}));
+
+    EXPECT_TRUE(m_graph.run());
+    EXPECT_EQ(2, finishedBeforeDependent);
+}
+
+/**
+ * Verify that tasks depending on a failed task are skipped and the run fails.
+ */
+TEST_F(StartupTaskGraphTest, testFailedDependencySkipsDependents) {
+    bool dependentRan = false;
+    bool independentRan = false;
+
+    ASSERT_TRUE(m_graph.addTask("failing", []() { return false; }));
+    ASSERT_TRUE(m_graph.addTask(
+        "dependent",
+        [&]() {
+            dependentRan = true;
+            return true;
+        },
+        {"failing"}));
+    ASSERT_TRUE(m_graph.addTask("independent", [&]() {
+        independentRan = true;
+        return true;
+    }));
+
+    EXPECT_FALSE(m_graph.run());
+    EXPECT_FALSE(dependentRan);
+    EXPECT_TRUE(independentRan);
+}
+
+/**
+ * Verify that duplicate names and unknown dependencies are rejected.
+ */
+TEST_F(StartupTaskGraphTest, testInvalidTasksRejected) {
+    ASSERT_TRUE(m_graph.addTask("task", []() { return true; }));
+    EXPECT_FALSE(m_graph.addTask("task", []() { return true; }));
+    EXPECT_FALSE(m_graph.addTask("other", []() { return true; }, {"unknown"}));
+    EXPECT_FALSE(m_graph.addTask("empty", nullptr));
+}
+
+/**
+ * Verify that a later run can depend on tasks of an earlier run.
+ */
+TEST_F(StartupTaskGraphTest, testDependencyOnEarlierRun) {
+    int runs = 0;
+    ASSERT_TRUE(m_graph.addTask("early", [&]() {
+        runs++;
+        return true;
+    }));
+    ASSERT_TRUE(m_graph.run());
+
+    ASSERT_TRUE(m_graph.addTask(
+        "late",
+        [&]() {
+            runs++;
+            return true;
+        },
+        {"early"}));
+    EXPECT_TRUE(m_graph.run());
+    EXPECT_EQ(2, runs);
+}
+
+/**
+ * Verify that tasks, steps and marks are recorded in the timeline in start order.
+ */
+TEST_F(StartupTaskGraphTest, testTimeline) {
+    ASSERT_TRUE(m_graph.addTask("task", []() { return true; }));
+    ASSERT_TRUE(m_graph.run());
+    EXPECT_FALSE(m_graph.runStep("step", []() { return false; }));
+    m_graph.mark("ready");
+
+    auto timeline = m_graph.getTimeline();
+    ASSERT_EQ(3u, timeline.size());
+    EXPECT_EQ("task", timeline[0].name);
+    EXPECT_TRUE(timeline[0].succeeded);
+    EXPECT_EQ("step", timeline[1].name);
+    EXPECT_FALSE(timeline[1].succeeded);
+    EXPECT_EQ("ready", timeline[2].name);
+    EXPECT_EQ(0, timeline[2].duration.count());
+    EXPECT_LE(timeline[0].start, timeline[1].start);
+    EXPECT_LE(timeline[1].start, timeline[2].start);
+}
+
+/**
+ * Verify that the CPU time of a step tells compute bound steps from waiting ones.
+ */
+TEST_F(StartupTaskGraphTest, testCpuTime) {
+    ASSERT_TRUE(m_graph.runStep("busy", []() {
+        auto end = StartupTaskGraph::Clock::now() + BUSY_DURATION;
+        volatile unsigned int counter = 0;
+        while (StartupTaskGraph::Clock::now() < end) {
+            counter = counter + 1;
+        }
+        return true;
+    }));
+    ASSERT_TRUE(m_graph.runStep("sleeping", []() {
+        std::this_thread::sleep_for(SLEEP_DURATION);
+        return true;
+    }));
+
+    auto timeline = m_graph.getTimeline();
+    ASSERT_EQ(2u, timeline.size());
+    if (timeline[0].threadCpuTime.count() == 0) {
+        // The platform does not provide the CPU time of threads.
+        return;
+    }
+    EXPECT_GT(timeline[0].threadCpuTime, timeline[1].threadCpuTime);
+    EXPECT_LT(timeline[1].threadCpuTime, timeline[1].duration);
+    EXPECT_GE(timeline[1].processCpuTime, timeline[0].processCpuTime);
+}
+
+/**
+ * Verify that the report lists every step with its times.
+ */
+TEST_F(StartupTaskGraphTest, testReport) {
+    ASSERT_TRUE(m_graph.runStep("step", []() { return true; }));
+    m_graph.mark("ready");
+
+    rapidjson::Document report;
+    ASSERT_FALSE(report.Parse(m_graph.getReport().c_str()).HasParseError());
+    ASSERT_TRUE(report.HasMember("steps"));
+    auto& steps = report["steps"];
+    ASSERT_TRUE(steps.IsArray());
+    ASSERT_EQ(2u, steps.Size());
+    EXPECT_STREQ("step", steps[0]["name"].GetString());
+    EXPECT_STREQ("ready", steps[1]["name"].GetString());
+    for (auto& step : steps.GetArray()) {
+        EXPECT_TRUE(step["startMs"].IsNumber());
+        EXPECT_TRUE(step["durationMs"].IsNumber());
+        EXPECT_TRUE(step["threadCpuMs"].IsNumber());
+        EXPECT_TRUE(step["processCpuMs"].IsNumber());
+        EXPECT_TRUE(step["succeeded"].GetBool());
+    }
+}
+
+}  // namespace test
+}  // namespace sampleApp
+}  // namespace alexaSmartScreenSDK
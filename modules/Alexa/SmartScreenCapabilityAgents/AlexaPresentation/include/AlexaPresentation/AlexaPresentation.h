@@ -22,6 +22,7 @@
 #include <queue>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/AVS/CapabilityAgent.h>
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
@@ -33,7 +34,6 @@
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
-#include <AVSCommon/Utils/Timing/Timer.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
 #include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
@@ -43,6 +43,8 @@
 #include <SmartScreenSDKInterfaces/AlexaPresentationObserverInterface.h>
 #include <SmartScreenSDKInterfaces/DisplayCardState.h>
 #include <SmartScreenSDKInterfaces/VisualStateProviderInterface.h>
+#include <SSSDKCommon/JsonMemberScanner.h>
+#include <SSSDKCommon/WheelTimer.h>
 
 namespace alexaSmartScreenSDK {
 namespace smartScreenCapabilityAgents {
@@ -398,6 +400,22 @@ private:
      */
     bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
 
+    /**
+     * This function finds top level members of a @c Directive's payload without deserializing it, see
+     * @c sssdkCommon::scanJsonMembers.
+     *
+     * @param info The @c DirectiveInfo to read the payload string from.
+     * @param names Names of the members to find.
+     * @param validateAll Whether the whole payload is validated, or the scan stops once every member is found.
+     * @param[out] members Receives the members found.
+     * @return @c true if scanning was successful, else @c false.
+     */
+    bool scanDirectivePayload(
+        std::shared_ptr<DirectiveInfo> info,
+        const std::vector<std::string>& names,
+        bool validateAll,
+        sssdkCommon::JsonMembers* members);
+
     /**
      * This function handles the notification of the renderDocument callbacks to all the observers.  This function
      * is intended to be used in the context of @c m_executor worker thread.
@@ -525,10 +543,10 @@ private:
     void proactiveStateReport();
 
     /// Timer that is responsible for clearing the display on IDLE.
-    alexaClientSDK::avsCommon::utils::timing::Timer m_idleTimer;
+    sssdkCommon::WheelTimer m_idleTimer;
 
     /// Timer that is responsible for delayed execution.
-    alexaClientSDK::avsCommon::utils::timing::Timer m_delayedExecutionTimer;
+    sssdkCommon::WheelTimer m_delayedExecutionTimer;
 
     /**
      * @name Executor Thread Variables
@@ -702,7 +720,7 @@ private:
     bool m_stateReportPending;
 
     /// An internal timer used to check for context changes
-    alexaClientSDK::avsCommon::utils::timing::Timer m_proactiveStateTimer;
+    sssdkCommon::WheelTimer m_proactiveStateTimer;
 
     /// This is the worker thread for the @c AlexaPresentation CA.
     std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> m_executor;
@@ -39,7 +39,6 @@ using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
 using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::json;
-using namespace alexaClientSDK::avsCommon::utils::timing;
 
 /// AlexaPresentation capability constants
 /// AlexaPresentation interface type
@@ -265,8 +264,8 @@ bool AlexaPresentation::initialize() {
 
         m_proactiveStateTimer.start(
             m_stateReportCheckInterval,
-            Timer::PeriodType::ABSOLUTE,
-            Timer::FOREVER,
+            sssdkCommon::WheelTimer::PeriodType::ABSOLUTE,
+            sssdkCommon::WheelTimer::FOREVER,
             std::bind(&AlexaPresentation::proactiveStateReport, this));
     }
 
@@ -564,25 +563,43 @@ bool AlexaPresentation::parseDirectivePayload(std::shared_ptr<DirectiveInfo> inf
     }
 }
 
+bool AlexaPresentation::scanDirectivePayload(
+    std::shared_ptr<DirectiveInfo> info,
+    const std::vector<std::string>& names,
+    bool validateAll,
+    sssdkCommon::JsonMembers* members) {
+    if (sssdkCommon::scanJsonMembers(info->directive->getPayload(), names, validateAll, members)) {
+        return true;
+    }
+    ACSDK_ERROR(LX("parseDirectivePayloadFailed")
+                    .d("reason", "malformedPayload")
+                    .d("messageId", info->directive->getMessageId()));
+    sendExceptionEncounteredAndReportFailed(
+        info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
+    return false;
+}
+
 void AlexaPresentation::handleRenderDocumentDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG5(LX(__func__));
 
     m_executor->submit([this, info]() {
         ACSDK_DEBUG9(LX("handleRenderDocumentDirectiveInExecutor").sensitive("payload", info->directive->getPayload()));
-        rapidjson::Document payload;
-        if (!parseDirectivePayload(info, &payload)) {
+        // The document can be large, the payload is only validated here and parsed in full when it is rendered.
+        sssdkCommon::JsonMembers members;
+        if (!scanDirectivePayload(info, {PRESENTATION_TOKEN, DOCUMENT_FIELD}, true, &members)) {
             return;
         }
 
-        std::string presentationToken;
-        if (!jsonUtils::retrieveValue(payload, PRESENTATION_TOKEN, &presentationToken)) {
+        auto token = members.find(PRESENTATION_TOKEN);
+        if (token == members.end() || token->second.type != rapidjson::kStringType) {
             ACSDK_ERROR(LX("handleRenderDocumentDirectiveFailedInExecutor").d("reason", "NoPresentationToken"));
             sendExceptionEncounteredAndReportFailed(info, "missing presentationToken");
             return;
         }
 
-        std::string APLdocument;
-        if (!jsonUtils::retrieveValue(payload, DOCUMENT_FIELD, &APLdocument)) {
+        auto document = members.find(DOCUMENT_FIELD);
+        if (document == members.end() ||
+            (document->second.type != rapidjson::kObjectType && document->second.type != rapidjson::kStringType)) {
             ACSDK_ERROR(LX("handleRenderDocumentDirectiveFailedInExecutor").d("reason", "NoDocument"));
             sendExceptionEncounteredAndReportFailed(info, "missing APLdocument");
             return;
@@ -624,8 +641,10 @@ void AlexaPresentation::handleExecuteCommandDirective(std::shared_ptr<DirectiveI
             return;
         }
 
-        rapidjson::Document renderedPayload;
-        if (!parseDirectivePayload(m_lastDisplayedDirective, &renderedPayload)) {
+        // Only the token of the last displayed directive is needed, the scan stops before its document.
+        sssdkCommon::JsonMembers renderedMembers;
+        if (!sssdkCommon::scanJsonMembers(
+                m_lastDisplayedDirective->directive->getPayload(), {PRESENTATION_TOKEN}, false, &renderedMembers)) {
             sendExceptionEncounteredAndReportFailed(info, "Parse error of previous render directive");
             ACSDK_ERROR(LX("handleExecuteCommandDirectiveFailedInExecutor")
                             .d("reason", "Could not parse the last displayed directive."));
@@ -633,15 +652,16 @@ void AlexaPresentation::handleExecuteCommandDirective(std::shared_ptr<DirectiveI
             return;
         }
 
-        std::string renderedPresentationToken;
-        if (!jsonUtils::retrieveValue(renderedPayload, PRESENTATION_TOKEN, &renderedPresentationToken)) {
+        auto renderedPresentationToken = renderedMembers.find(PRESENTATION_TOKEN);
+        if (renderedPresentationToken == renderedMembers.end() ||
+            renderedPresentationToken->second.type != rapidjson::kStringType) {
             sendExceptionEncounteredAndReportFailed(info, "Missing presentationToken in last display directive.");
             ACSDK_ERROR(LX("handleExecuteCommandDirectiveFailedInExecutor")
                             .d("reason", "No presentationToken in the last displayed directive."));
             return;
         }
 
-        if (presentationToken != renderedPresentationToken) {
+        if (presentationToken != renderedPresentationToken->second.string) {
             sendExceptionEncounteredAndReportFailed(
                 info, "token mismatch between ExecuteCommand and last rendering directive.");
             ACSDK_ERROR(
@@ -683,8 +703,10 @@ void AlexaPresentation::handleDynamicListDataDirective(
             return;
         }
 
-        rapidjson::Document renderedPayload;
-        if (!parseDirectivePayload(m_lastDisplayedDirective, &renderedPayload)) {
+        // Only the token of the last displayed directive is needed, the scan stops before its document.
+        sssdkCommon::JsonMembers renderedMembers;
+        if (!sssdkCommon::scanJsonMembers(
+                m_lastDisplayedDirective->directive->getPayload(), {PRESENTATION_TOKEN}, false, &renderedMembers)) {
             sendExceptionEncounteredAndReportFailed(info, "Parse error of previous render directive");
             ACSDK_ERROR(LX("handleDynamicListDataDirectiveFailedInExecutor")
                             .d("reason", "Could not parse the last displayed directive."));
@@ -692,15 +714,16 @@ void AlexaPresentation::handleDynamicListDataDirective(
             return;
         }
 
-        std::string renderedPresentationToken;
-        if (!jsonUtils::retrieveValue(renderedPayload, PRESENTATION_TOKEN, &renderedPresentationToken)) {
+        auto renderedPresentationToken = renderedMembers.find(PRESENTATION_TOKEN);
+        if (renderedPresentationToken == renderedMembers.end() ||
+            renderedPresentationToken->second.type != rapidjson::kStringType) {
             sendExceptionEncounteredAndReportFailed(info, "Missing presentationToken in last display directive.");
             ACSDK_ERROR(LX("handleDynamicListDataDirectiveFailedInExecutor")
                             .d("reason", "No presentationToken in the last displayed directive."));
             return;
         }
 
-        if (presentationToken != renderedPresentationToken) {
+        if (presentationToken != renderedPresentationToken->second.string) {
             sendExceptionEncounteredAndReportFailed(
                 info, "token mismatch between DynamicListData and last rendering directive.");
             ACSDK_ERROR(
@@ -731,43 +754,37 @@ void AlexaPresentation::handleUnknownDirective(std::shared_ptr<DirectiveInfo> in
 }
 
 /**
- * Get the token from payload of renderDocument message with APL document
+ * Get the token and the target windowId from payload of renderDocument message with APL document
  *
  * @param payload - the payload of the message
- * @return The token for APL payload, empty string otherwise.
+ * @param[out] APLToken - the token for APL payload, empty string otherwise
+ * @param[out] targetWindowId - the windowId for APL payload, empty string otherwise
  */
-static const std::string getAPLToken(const std::string& payload) {
-    rapidjson::Document document;
-    document.Parse(payload);
-
-    std::string APLToken;
-    if (!jsonUtils::retrieveValue(document, PRESENTATION_TOKEN, &APLToken)) {
+static void getAPLTokenAndTargetWindowId(
+    const std::string& payload,
+    std::string* APLToken,
+    std::string* targetWindowId) {
+    // Both members usually precede the document, so the scan rarely has to read through it.
+    sssdkCommon::JsonMembers members;
+    sssdkCommon::scanJsonMembers(payload, {PRESENTATION_TOKEN, WINDOW_ID}, false, &members);
+
+    auto token = members.find(PRESENTATION_TOKEN);
+    if (token == members.end() || token->second.type != rapidjson::kStringType) {
         ACSDK_ERROR(LX("getAPLTokenFailed").d("reason", "Couldn't find token in APL document"));
-        return "";
+        APLToken->clear();
+    } else {
+        *APLToken = token->second.string;
+        ACSDK_DEBUG5(LX(__func__).d("Token", *APLToken));
     }
-    ACSDK_DEBUG5(LX(__func__).d("Token", APLToken));
-
-    return APLToken;
-}
-
-/**
- * Get the target windowId from payload of renderDocument message with APL document
- *
- * @param payload - the payload of the message
- * @return The windowId for APL payload, empty string otherwise.
- */
-static const std::string getTargetWindowId(const std::string& payload) {
-    rapidjson::Document document;
-    document.Parse(payload);
 
-    std::string targetWindowId;
-    if (!jsonUtils::retrieveValue(document, WINDOW_ID, &targetWindowId)) {
+    auto windowId = members.find(WINDOW_ID);
+    if (windowId == members.end() || windowId->second.type != rapidjson::kStringType) {
         ACSDK_ERROR(LX("getTargetWindowIdFailed").d("reason", "Couldn't find windowId in APL document"));
-        return "";
+        targetWindowId->clear();
+    } else {
+        *targetWindowId = windowId->second.string;
+        ACSDK_DEBUG5(LX(__func__).d("Target Window Id", *targetWindowId));
     }
-    ACSDK_DEBUG5(LX(__func__).d("Target Window Id", targetWindowId));
-
-    return targetWindowId;
 }
 
 void AlexaPresentation::executeRenderDocumentCallbacks(bool isClearCard) {
@@ -776,8 +793,7 @@ void AlexaPresentation::executeRenderDocumentCallbacks(bool isClearCard) {
     std::string windowId;
 
     if (!isClearCard) {
-        newToken = getAPLToken(m_lastDisplayedDirective->directive->getPayload());
-        windowId = getTargetWindowId(m_lastDisplayedDirective->directive->getPayload());
+        getAPLTokenAndTargetWindowId(m_lastDisplayedDirective->directive->getPayload(), &newToken, &windowId);
     }
 
     ACSDK_DEBUG3(LX(__func__)
@@ -17,6 +17,7 @@
 #define ALEXA_SMART_SCREEN_SDK_CAPABILITYAGENTS_TEMPLATERUNTIME_INCLUDE_TEMPLATERUNTIME_TEMPLATERUNTIME_H_
 
 #include <chrono>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <string>
@@ -32,7 +33,7 @@
 #include <AVSCommon/SDKInterfaces/RenderPlayerInfoCardsProviderInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
-#include <AVSCommon/Utils/Timing/Timer.h>
+#include <SSSDKCommon/WheelTimer.h>
 
 #include "SmartScreenSDKInterfaces/ActivityEvent.h"
 #include "SmartScreenSDKInterfaces/AlexaPresentationObserverInterface.h"
@@ -207,6 +208,17 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityAgent::DirectiveInfo> directive;
     };
 
+    /**
+     * Utility structure holding the state of the @c AudioItem in execution of a RenderPlayerInfoCards provider.
+     */
+    struct PlayerInfoState {
+        /// The @c AudioItem in execution and its @c RenderPlayerInfo directive.
+        AudioItemPair audioItemInExecution;
+
+        /// The @c AudioPlayerInfo to be passed to the observers in the renderPlayerInfoCard callback.
+        smartScreenSDKInterfaces::AudioPlayerInfo audioPlayerInfo;
+    };
+
     /**
      * Constructor.
      *
@@ -342,6 +354,31 @@ private:
      */
     void executeStopTimer();
 
+    /**
+     * This is an internal function to queue a @c RenderPlayerInfo directive whose audioItemId is not in execution.
+     * The oldest directive is discarded if the queue is full.
+     *
+     * @param itemPair The audioItemId and its @c RenderPlayerInfo directive.
+     */
+    void executePushAudioItem(const AudioItemPair& itemPair);
+
+    /**
+     * This is an internal function to take the most recent queued @c RenderPlayerInfo directive matching an
+     * audioItemId out of @c m_audioItems.  All directives queued before it are discarded as well.
+     *
+     * @param audioItemId The audioItemId reported by the RenderPlayerInfoCards provider.
+     * @return The matching directive, @c nullptr if there is none.
+     */
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityAgent::DirectiveInfo> executeTakeAudioItem(
+        const std::string& audioItemId);
+
+    /**
+     * This is an internal function to discard the oldest directives of @c m_audioItems until at most @c size remain.
+     *
+     * @param size The number of directives to keep.
+     */
+    void executeTruncateAudioItems(size_t size);
+
     /**
      * This is a state machine function to handle the clear card event.
      * Called when agent has been asked to clear the displayed card.
@@ -366,7 +403,7 @@ private:
         const std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityAgent::DirectiveInfo> info);
 
     /// Timer that is responsible for clearing the display.
-    alexaClientSDK::avsCommon::utils::timing::Timer m_clearDisplayTimer;
+    sssdkCommon::WheelTimer m_clearDisplayTimer;
 
     /**
      * @name Executor Thread Variables
@@ -379,13 +416,13 @@ private:
     std::unordered_set<std::shared_ptr<smartScreenSDKInterfaces::TemplateRuntimeObserverInterface>> m_observers;
 
     /*
-     * This is a map that is used to store the current executing @c AudioItem based on the callbacks from the
-     * @c RenderPlayerInfoCardsProviderInterface.
+     * This is a map that is used to store the current executing @c AudioItem and its @c AudioPlayerInfo based on the
+     * callbacks from the @c RenderPlayerInfoCardsProviderInterface.
      */
     std::unordered_map<
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MediaPropertiesInterface>,
-        AudioItemPair>
-        m_audioItemsInExecution;
+        PlayerInfoState>
+        m_playerInfoStates;
 
     /// The current active RenderPlayerInfoCards provider that has the matching audioItemId.
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MediaPropertiesInterface>
@@ -397,11 +434,15 @@ private:
      */
     std::deque<AudioItemPair> m_audioItems;
 
-    /// This map is to store the @c AudioPlayerInfo to be passed to the observers in the renderPlayerInfoCard callback.
-    std::unordered_map<
-        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MediaPropertiesInterface>,
-        smartScreenSDKInterfaces::AudioPlayerInfo>
-        m_audioPlayerInfo;
+    /*
+     * Index of @c m_audioItems, mapping an audioItemId to the sequence number of its most recent entry.  Entries are
+     * numbered in the order they are queued, so the entry with sequence number n is at position
+     * @c m_audioItemsFrontSequence - n of the queue.
+     */
+    std::unordered_map<std::string, uint64_t> m_audioItemIndex;
+
+    /// The sequence number of the front of @c m_audioItems.
+    uint64_t m_audioItemsFrontSequence;
 
     /// The directive corresponding to the RenderTemplate directive.
     std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityAgent::DirectiveInfo> m_lastDisplayedDirective;
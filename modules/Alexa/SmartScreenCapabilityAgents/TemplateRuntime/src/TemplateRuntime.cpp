@@ -298,6 +298,7 @@ TemplateRuntime::TemplateRuntime(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender) :
         CapabilityAgent{NAMESPACE, exceptionSender},
         RequiresShutdown{"TemplateRuntime"},
+        m_audioItemsFrontSequence{0},
         m_activeNonPlayerInfoType{NonPlayerInfoDisplayType::NONE},
         m_isPlayerInfoCardUpdated{false},
         m_focus{FocusState::NONE},
@@ -329,8 +330,7 @@ void TemplateRuntime::doShutdown() {
     m_focusManager.reset();
     m_observers.clear();
     m_activeRenderPlayerInfoCardsProvider.reset();
-    m_audioItemsInExecution.clear();
-    m_audioPlayerInfo.clear();
+    m_playerInfoStates.clear();
     for (const auto renderPlayerInfoCardsInterface : m_renderPlayerInfoCardsInterfaces) {
         renderPlayerInfoCardsInterface->setObserver(nullptr);
     }
@@ -377,10 +377,10 @@ void TemplateRuntime::executeNonPlayerInfoCardCleared(NonPlayerInfoDisplayType c
             /**
              * Update the audioPlayerInfo to the most recent state and offset
              * */
-            m_audioPlayerInfo[m_activeRenderPlayerInfoCardsProvider].audioPlayerState = m_playerActivityState;
-            m_audioPlayerInfo[m_activeRenderPlayerInfoCardsProvider].offset =
-                m_activeRenderPlayerInfoCardsProvider->getAudioItemOffset();
-            executeDisplayCardEvent(m_audioItemsInExecution[m_activeRenderPlayerInfoCardsProvider].directive);
+            auto& playerInfoState = m_playerInfoStates[m_activeRenderPlayerInfoCardsProvider];
+            playerInfoState.audioPlayerInfo.audioPlayerState = m_playerActivityState;
+            playerInfoState.audioPlayerInfo.offset = m_activeRenderPlayerInfoCardsProvider->getAudioItemOffset();
+            executeDisplayCardEvent(playerInfoState.audioItemInExecution.directive);
         }
     }
 }
@@ -439,28 +439,28 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
         }
 
         size_t found = std::string::npos;
-        for (auto& executionMap : m_audioItemsInExecution) {
-            if (!executionMap.second.audioItemId.empty()) {
-                found = audioItemId.find(executionMap.second.audioItemId);
+        for (auto& executionMap : m_playerInfoStates) {
+            auto& audioItemInExecution = executionMap.second.audioItemInExecution;
+            if (!audioItemInExecution.audioItemId.empty()) {
+                found = audioItemId.find(audioItemInExecution.audioItemId);
             }
             if (found != std::string::npos) {
                 ACSDK_DEBUG3(LX("handleRenderPlayerInfoDirectiveInExecutor")
                                  .d("audioItemId", audioItemId)
                                  .m("Matching audioItemId in execution."));
 
-                if (nullptr == executionMap.second.directive ||
-                    executionMap.second.directive->directive->getPayload() != info->directive->getPayload()) {
-                    executionMap.second.directive = info;
+                if (nullptr == audioItemInExecution.directive ||
+                    audioItemInExecution.directive->directive->getPayload() != info->directive->getPayload()) {
+                    audioItemInExecution.directive = info;
                     m_activeRenderPlayerInfoCardsProvider = executionMap.first;
-                    m_audioPlayerInfo[m_activeRenderPlayerInfoCardsProvider].offset =
-                        executionMap.first->getAudioItemOffset();
+                    executionMap.second.audioPlayerInfo.offset = executionMap.first->getAudioItemOffset();
                     executeStopTimer();
                     executeDisplayCardEvent(info);
                 } else {
                     ACSDK_DEBUG9(LX("notRenderingPlayerInfo").d("reason", "sameDirectiveMultipleTimes."));
                 }
                 // Since there'a match, we can safely empty m_audioItems.
-                m_audioItems.clear();
+                executeTruncateAudioItems(0);
                 break;
             }
         }
@@ -470,16 +470,7 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
                              .d("audioItemId", audioItemId)
                              .m("Not matching audioItemId in execution."));
 
-            AudioItemPair itemPair{audioItemId, info};
-            if (m_audioItems.size() == MAXIMUM_QUEUE_SIZE) {
-                // Something is wrong, so we pop the back of the queue and log an error.
-                auto discardedAudioItem = m_audioItems.back();
-                m_audioItems.pop_back();
-                ACSDK_ERROR(LX("handleRenderPlayerInfoDirective")
-                                .d("reason", "queueIsFull")
-                                .d("discardedAudioItemId", discardedAudioItem.audioItemId));
-            }
-            m_audioItems.push_front(itemPair);
+            executePushAudioItem(AudioItemPair{audioItemId, info});
 
             if (NonPlayerInfoDisplayType::RENDER_TEMPLATE == m_activeNonPlayerInfoType) {
                 /**
@@ -533,8 +524,10 @@ void TemplateRuntime::executeAudioPlayerInfoUpdates(
     }
 
     const auto& currentRenderPlayerInfoCardsProvider = context.mediaProperties;
-    if (m_audioPlayerInfo[currentRenderPlayerInfoCardsProvider].audioPlayerState == state &&
-        m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].audioItemId == context.audioItemId) {
+    auto& playerInfoState = m_playerInfoStates[currentRenderPlayerInfoCardsProvider];
+    auto& audioPlayerInfo = playerInfoState.audioPlayerInfo;
+    auto& audioItemInExecution = playerInfoState.audioItemInExecution;
+    if (audioPlayerInfo.audioPlayerState == state && audioItemInExecution.audioItemId == context.audioItemId) {
         /*
          * The AudioPlayer notification is chatty during audio playback as it will frequently toggle between
          * BUFFER_UNDERRUN and PLAYER state.  So we filter out the callbacks if the notification are with the
@@ -543,36 +536,28 @@ void TemplateRuntime::executeAudioPlayerInfoUpdates(
         return;
     }
 
-    auto isStateUpdated = (m_audioPlayerInfo[currentRenderPlayerInfoCardsProvider].audioPlayerState != state);
-    m_audioPlayerInfo[currentRenderPlayerInfoCardsProvider].audioPlayerState = state;
-    m_audioPlayerInfo[currentRenderPlayerInfoCardsProvider].offset = context.offset;
+    auto isStateUpdated = (audioPlayerInfo.audioPlayerState != state);
+    audioPlayerInfo.audioPlayerState = state;
+    audioPlayerInfo.offset = context.offset;
     m_isPlayerInfoCardUpdated = true;
-    if (m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].audioItemId != context.audioItemId) {
-        m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].audioItemId = context.audioItemId;
-        m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].directive.reset();
-        // iterate from front to back (front is most recent)
-        for (auto it = m_audioItems.begin(); it != m_audioItems.end(); ++it) {
-            auto found = it->audioItemId.find(context.audioItemId);
-            if (std::string::npos != found) {
-                ACSDK_DEBUG3(LX("executeAudioPlayerInfoUpdates")
-                                 .d("audioItemId", context.audioItemId)
-                                 .m("Found matching audioItemId in queue."));
-                m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].directive = it->directive;
-                m_activeRenderPlayerInfoCardsProvider = currentRenderPlayerInfoCardsProvider;
-                // We are erasing items older than the current found, as well as the current item.
-                m_audioItems.erase(it, m_audioItems.end());
-                break;
-            }
+    if (audioItemInExecution.audioItemId != context.audioItemId) {
+        audioItemInExecution.audioItemId = context.audioItemId;
+        audioItemInExecution.directive = executeTakeAudioItem(context.audioItemId);
+        if (audioItemInExecution.directive) {
+            ACSDK_DEBUG3(LX("executeAudioPlayerInfoUpdates")
+                             .d("audioItemId", context.audioItemId)
+                             .m("Found matching audioItemId in queue."));
+            m_activeRenderPlayerInfoCardsProvider = currentRenderPlayerInfoCardsProvider;
         }
     }
 
     /*
      * If the AudioPlayer notifies a PLAYING state before the RenderPlayerInfo with the corresponding
-     * audioItemId is received, this function will also be called but the m_audioItemsInExecution.directive
+     * audioItemId is received, this function will also be called but the audioItemInExecution.directive
      * will be set to nullptr.  So we need to do a nullptr check here to make sure there is a RenderPlayerInfo
      * displayCard to display..
      */
-    if (m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].directive) {
+    if (audioItemInExecution.directive) {
         if (isStateUpdated) {
             executeAudioPlayerStartTimer(state);
         }
@@ -589,8 +574,59 @@ void TemplateRuntime::executeAudioPlayerInfoUpdates(
         // Don't render the card if it's not displayed and state changed to STOPPED.
         if (state != alexaClientSDK::avsCommon::avs::PlayerActivity::STOPPED ||
             m_state == smartScreenSDKInterfaces::State::DISPLAYING) {
-            executeDisplayCardEvent(m_audioItemsInExecution[currentRenderPlayerInfoCardsProvider].directive);
+            executeDisplayCardEvent(audioItemInExecution.directive);
+        }
+    }
+}
+
+void TemplateRuntime::executePushAudioItem(const AudioItemPair& itemPair) {
+    if (m_audioItems.size() == MAXIMUM_QUEUE_SIZE) {
+        // Something is wrong, so we pop the back of the queue and log an error.
+        ACSDK_ERROR(LX("handleRenderPlayerInfoDirective")
+                        .d("reason", "queueIsFull")
+                        .d("discardedAudioItemId", m_audioItems.back().audioItemId));
+        executeTruncateAudioItems(MAXIMUM_QUEUE_SIZE - 1);
+    }
+    m_audioItems.push_front(itemPair);
+    // An older entry with the same audioItemId stays in the queue, but the index points to the most recent one.
+    m_audioItemIndex[itemPair.audioItemId] = ++m_audioItemsFrontSequence;
+}
+
+std::shared_ptr<DirectiveInfo> TemplateRuntime::executeTakeAudioItem(const std::string& audioItemId) {
+    size_t position = m_audioItems.size();
+    auto indexed = m_audioItemIndex.find(audioItemId);
+    if (indexed != m_audioItemIndex.end()) {
+        position = static_cast<size_t>(m_audioItemsFrontSequence - indexed->second);
+    } else {
+        /*
+         * The audioItemId of a RenderPlayerInfo directive may only contain the audioItemId reported by the provider,
+         * which cannot be looked up in the index.  Iterate from front to back (front is most recent).
+         */
+        for (size_t i = 0; i < m_audioItems.size(); ++i) {
+            if (std::string::npos != m_audioItems[i].audioItemId.find(audioItemId)) {
+                position = i;
+                break;
+            }
+        }
+    }
+    if (position >= m_audioItems.size()) {
+        return nullptr;
+    }
+
+    auto directive = m_audioItems[position].directive;
+    // We are erasing items older than the current found, as well as the current item.
+    executeTruncateAudioItems(position);
+    return directive;
+}
+
+void TemplateRuntime::executeTruncateAudioItems(size_t size) {
+    while (m_audioItems.size() > size) {
+        auto sequence = m_audioItemsFrontSequence - (m_audioItems.size() - 1);
+        auto indexed = m_audioItemIndex.find(m_audioItems.back().audioItemId);
+        if (indexed != m_audioItemIndex.end() && indexed->second == sequence) {
+            m_audioItemIndex.erase(indexed);
         }
+        m_audioItems.pop_back();
     }
 }
 
@@ -619,14 +655,14 @@ void TemplateRuntime::executeRenderPlayerInfoCallbacks(bool isClearCard) {
                 LX("executeRenderPlayerInfoCallbacksFailed").d("reason", "nullActiveRenderPlayerInfoCardsProvider"));
             return;
         }
-        if (!m_audioItemsInExecution[m_activeRenderPlayerInfoCardsProvider].directive) {
+        const auto& playerInfoState = m_playerInfoStates[m_activeRenderPlayerInfoCardsProvider];
+        if (!playerInfoState.audioItemInExecution.directive) {
             ACSDK_ERROR(LX("executeRenderPlayerInfoCallbacksFailed").d("reason", "nullAudioItemInExecution"));
             return;
         }
-        auto payload =
-            m_audioItemsInExecution[m_activeRenderPlayerInfoCardsProvider].directive->directive->getPayload();
+        auto payload = playerInfoState.audioItemInExecution.directive->directive->getPayload();
         for (auto& observer : m_observers) {
-            observer->renderPlayerInfoCard(payload, m_audioPlayerInfo[m_activeRenderPlayerInfoCardsProvider], m_focus);
+            observer->renderPlayerInfoCard(payload, playerInfoState.audioPlayerInfo, m_focus);
         }
     }
 }
@@ -16,6 +16,8 @@
 #include <condition_variable>
 #include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -585,6 +587,44 @@ TEST_F(TemplateRuntimeTest, test_renderPlayerInfoDirectiveWithTwoProviders) {
     waitForAsyncTask();
 }
 
+/**
+ * Tests several RenderPlayerInfo Directives queued before the AudioPlayer notifies the handling of one of them.  Expect
+ * that the card of the notified audioItemId is rendered, and that the Directives queued before it are discarded.
+ */
+TEST_F(TemplateRuntimeTest, test_renderPlayerInfoDirectiveFromQueue) {
+    auto attachmentManager = std::make_shared<StrictMock<smartScreenSDKInterfaces::test::MockAttachmentManager>>();
+    std::vector<std::string> audioItemIds;
+    std::vector<std::string> payloads;
+    for (int i = 0; i < 3; ++i) {
+        audioItemIds.push_back(AUDIO_ITEM_ID_1 + std::to_string(i));
+        payloads.push_back("{\"audioItemId\":\"" + audioItemIds.back() + "\",\"content\":{\"title\":\"TITLE\"}}");
+        auto avsMessageHeader = std::make_shared<AVSMessageHeader>(
+            PLAYER_INFO.nameSpace, PLAYER_INFO.name, MESSAGE_ID + std::to_string(i));
+        m_templateRuntime->handleDirectiveImmediately(
+            AVSDirective::create("", avsMessageHeader, payloads.back(), attachmentManager, ""));
+    }
+    waitForAsyncTask();
+
+    EXPECT_CALL(*m_mockGui, renderPlayerInfoCard(payloads[1], _, _)).Times(Exactly(1));
+
+    RenderPlayerInfoCardsObserverInterface::Context context;
+    context.mediaProperties = m_mediaPropertiesFetcher;
+    context.audioItemId = audioItemIds[1];
+    context.offset = TIMEOUT;
+    m_templateRuntime->onRenderPlayerCardsInfoChanged(alexaClientSDK::avsCommon::avs::PlayerActivity::PLAYING, context);
+    waitForAsyncTask();
+
+    // The Directive of the first audioItemId was queued before the rendered one, so it has been discarded.
+    EXPECT_CALL(*m_mockGui, renderPlayerInfoCard(payloads[0], _, _)).Times(Exactly(0));
+    EXPECT_CALL(*m_mockGui, renderPlayerInfoCard(payloads[2], _, _)).Times(Exactly(1));
+
+    context.audioItemId = audioItemIds[0];
+    m_templateRuntime->onRenderPlayerCardsInfoChanged(alexaClientSDK::avsCommon::avs::PlayerActivity::PLAYING, context);
+    context.audioItemId = audioItemIds[2];
+    m_templateRuntime->onRenderPlayerCardsInfoChanged(alexaClientSDK::avsCommon::avs::PlayerActivity::PLAYING, context);
+    waitForAsyncTask();
+}
+
 /**
  * Tests AudioPlayer callbacks will trigger the correct renderPlayerInfoCard callbacks. Expect
  * the payload, audioPlayerState and offset to match to the ones passed in by the
@@ -73,7 +73,7 @@ public:
     /// @}
 
     /**
-     * Set device window state
+     * Set device window state, which is reported to the context manager once per change and cached there.
      * @param deviceWindowState The input payload for device window state
      */
     void setDeviceWindowState(const std::string& deviceWindowState);
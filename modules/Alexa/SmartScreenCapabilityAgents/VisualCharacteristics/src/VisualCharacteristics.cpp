@@ -181,13 +181,21 @@ void VisualCharacteristics::provideState(
     const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
     unsigned int stateRequestToken) {
     m_executor.submit([this, stateRequestToken] {
-        m_contextManager->setState(
-            DEVICE_WINDOW_STATE, m_deviceWindowState, StateRefreshPolicy::ALWAYS, stateRequestToken);
+        // Only requested until the GUI sends the first window state, the context manager caches it from then on.
+        auto refreshPolicy = m_deviceWindowState.empty() ? StateRefreshPolicy::ALWAYS : StateRefreshPolicy::NEVER;
+        m_contextManager->setState(DEVICE_WINDOW_STATE, m_deviceWindowState, refreshPolicy, stateRequestToken);
     });
 }
 
 void VisualCharacteristics::setDeviceWindowState(const std::string& deviceWindowState) {
-    m_executor.submit([this, deviceWindowState] { m_deviceWindowState = deviceWindowState; });
+    m_executor.submit([this, deviceWindowState] {
+        if (deviceWindowState == m_deviceWindowState) {
+            return;
+        }
+        m_deviceWindowState = deviceWindowState;
+        // The window state only changes here, so the context manager keeps it instead of requesting it per event.
+        m_contextManager->setState(DEVICE_WINDOW_STATE, m_deviceWindowState, StateRefreshPolicy::NEVER);
+    });
 }
 
 }  // namespace visualCharacteristics
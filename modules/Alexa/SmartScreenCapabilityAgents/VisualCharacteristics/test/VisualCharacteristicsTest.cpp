@@ -13,9 +13,17 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+
+#include "MockContextManager.h"
 #include "VisualCharacteristics/VisualCharacteristics.h"
 
 namespace alexaSmartScreenSDK {
@@ -26,6 +34,37 @@ using namespace ::testing;
 using namespace alexaClientSDK;
 using namespace avsCommon;
 using namespace avs;
+using namespace sdkInterfaces;
+using namespace smartScreenSDKInterfaces::test;
+
+/// Time to wait for the context manager to be called.
+static const std::chrono::seconds WAIT_TIMEOUT{2};
+
+/// Configuration without any visual characteristics.
+static const std::string CONFIGURATION = R"({"gui":{"visualCharacteristics":[]}})";
+
+/// Namespace of the window state.
+static const std::string WINDOW_STATE_NAMESPACE = "Alexa.Display.Window";
+
+/// Name of the window state.
+static const std::string WINDOW_STATE_NAME = "WindowState";
+
+/// A window state sent by the GUI.
+static const std::string WINDOW_STATE = R"({"defaultWindowId":"main","instances":[]})";
+
+/// Another window state sent by the GUI.
+static const std::string OTHER_WINDOW_STATE = R"({"defaultWindowId":"other","instances":[]})";
+
+/// Token of a first state request.
+static const unsigned int FIRST_REQUEST_TOKEN = 1;
+
+/// Token of a second state request.
+static const unsigned int SECOND_REQUEST_TOKEN = 2;
+
+/// Matches the tag of the window state.
+MATCHER(IsWindowState, "") {
+    return WINDOW_STATE_NAMESPACE == arg.nameSpace && WINDOW_STATE_NAME == arg.name;
+}
 
 class MockVisualCharacteristicsTest : public VisualCharacteristics {
 public:
@@ -34,11 +73,130 @@ public:
 
 /// Test harness for @c VisualCharacteristics class.
 class VisualCharacteristicsTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    void TearDown() override;
+
 protected:
+    /**
+     * Records a call to @c ContextManagerInterface::setState.
+     *
+     * @return The result of the call
+     */
+    SetStateResult onSetState();
+
+    /**
+     * Waits for calls to @c ContextManagerInterface::setState.
+     *
+     * @param count Number of calls since the start of the test
+     * @return Whether @c count calls were made in time
+     */
+    bool waitForSetStates(size_t count);
+
     /// A pointer to an instance of the VisualCharacteristics that will be instantiated per test.
     std::shared_ptr<StrictMock<MockVisualCharacteristicsTest>> m_visualCharacteristics;
+
+    /// The mock context manager.
+    std::shared_ptr<StrictMock<MockContextManager>> m_contextManager;
+
+    /// The capability agent under test.
+    std::shared_ptr<VisualCharacteristics> m_visualCharacteristicsAgent;
+
+    /// Serializes access to @c m_setStateCount.
+    std::mutex m_mutex;
+
+    /// Notified on calls to @c ContextManagerInterface::setState.
+    std::condition_variable m_setStateTrigger;
+
+    /// Number of calls to @c ContextManagerInterface::setState.
+    size_t m_setStateCount = 0;
 };
 
+void VisualCharacteristicsTest::SetUp() {
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream(CONFIGURATION));
+    std::vector<std::shared_ptr<std::istream>> jsonStream({configuration});
+    utils::configuration::ConfigurationNode::initialize(jsonStream);
+
+    m_contextManager = std::make_shared<StrictMock<MockContextManager>>();
+    EXPECT_CALL(*m_contextManager, setStateProvider(IsWindowState(), NotNull()));
+    m_visualCharacteristicsAgent = VisualCharacteristics::create(m_contextManager);
+    ASSERT_TRUE(m_visualCharacteristicsAgent);
+}
+
+void VisualCharacteristicsTest::TearDown() {
+    if (m_visualCharacteristicsAgent) {
+        m_visualCharacteristicsAgent->shutdown();
+    }
+    utils::configuration::ConfigurationNode::uninitialize();
+}
+
+SetStateResult VisualCharacteristicsTest::onSetState() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_setStateCount++;
+    m_setStateTrigger.notify_all();
+    return SetStateResult::SUCCESS;
+}
+
+bool VisualCharacteristicsTest::waitForSetStates(size_t count) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_setStateTrigger.wait_for(lock, WAIT_TIMEOUT, [this, count] { return m_setStateCount >= count; });
+}
+
+/**
+ * Tests that the window state is requested on every context request until the GUI sends the first one, after which
+ * the context manager keeps the state it is given.
+ */
+TEST_F(VisualCharacteristicsTest, test_stateRequestedUntilFirstWindowState) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(
+            *m_contextManager, setState(IsWindowState(), "", StateRefreshPolicy::ALWAYS, FIRST_REQUEST_TOKEN))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+        EXPECT_CALL(*m_contextManager, setState(IsWindowState(), WINDOW_STATE, StateRefreshPolicy::NEVER, 0))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+        EXPECT_CALL(
+            *m_contextManager,
+            setState(IsWindowState(), WINDOW_STATE, StateRefreshPolicy::NEVER, SECOND_REQUEST_TOKEN))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+    }
+
+    m_visualCharacteristicsAgent->provideState(
+        NamespaceAndName(WINDOW_STATE_NAMESPACE, WINDOW_STATE_NAME), FIRST_REQUEST_TOKEN);
+    ASSERT_TRUE(waitForSetStates(1));
+    m_visualCharacteristicsAgent->setDeviceWindowState(WINDOW_STATE);
+    ASSERT_TRUE(waitForSetStates(2));
+    m_visualCharacteristicsAgent->provideState(
+        NamespaceAndName(WINDOW_STATE_NAMESPACE, WINDOW_STATE_NAME), SECOND_REQUEST_TOKEN);
+    EXPECT_TRUE(waitForSetStates(3));
+}
+
+/**
+ * Tests that a window state equal to the current one does not update the context manager.
+ */
+TEST_F(VisualCharacteristicsTest, test_unchangedWindowStateIgnored) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_contextManager, setState(IsWindowState(), WINDOW_STATE, StateRefreshPolicy::NEVER, 0))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+        EXPECT_CALL(*m_contextManager, setState(IsWindowState(), OTHER_WINDOW_STATE, StateRefreshPolicy::NEVER, 0))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+        EXPECT_CALL(
+            *m_contextManager,
+            setState(IsWindowState(), OTHER_WINDOW_STATE, StateRefreshPolicy::NEVER, FIRST_REQUEST_TOKEN))
+            .WillOnce(InvokeWithoutArgs([this] { return onSetState(); }));
+    }
+
+    m_visualCharacteristicsAgent->setDeviceWindowState(WINDOW_STATE);
+    m_visualCharacteristicsAgent->setDeviceWindowState(WINDOW_STATE);
+    m_visualCharacteristicsAgent->setDeviceWindowState(OTHER_WINDOW_STATE);
+    m_visualCharacteristicsAgent->setDeviceWindowState(OTHER_WINDOW_STATE);
+    // The request is handled after the window states, so every update is made by the time it is answered.
+    m_visualCharacteristicsAgent->provideState(
+        NamespaceAndName(WINDOW_STATE_NAMESPACE, WINDOW_STATE_NAME), FIRST_REQUEST_TOKEN);
+    EXPECT_TRUE(waitForSetStates(3));
+}
+
 /**
  * Tests that the VisualCharacteristics capability agent can successfully publish the four APIs in the config
  * file.
@@ -0,0 +1,182 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_SMART_SCREEN_SDK_INTERFACES_TEST_STUBMISCSTORAGE_H_
+#define ALEXA_SMART_SCREEN_SDK_INTERFACES_TEST_STUBMISCSTORAGE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "AVSCommon/SDKInterfaces/Storage/MiscStorageInterface.h"
+
+namespace alexaSmartScreenSDK {
+namespace smartScreenSDKInterfaces {
+namespace test {
+
+/// In memory @c MiscStorageInterface implementation with string keys and values.
+class StubMiscStorage : public alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface {
+public:
+    bool createDatabase() override {
+        return true;
+    }
+
+    bool open() override {
+        return true;
+    }
+
+    bool isOpened() override {
+        return true;
+    }
+
+    void close() override {
+    }
+
+    bool createTable(const std::string& componentName, const std::string& tableName, KeyType, ValueType) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_tables[getTableKey(componentName, tableName)];
+        return true;
+    }
+
+    bool clearTable(const std::string& componentName, const std::string& tableName) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        table->second.clear();
+        return true;
+    }
+
+    bool deleteTable(const std::string& componentName, const std::string& tableName) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_tables.erase(getTableKey(componentName, tableName)) > 0;
+    }
+
+    bool get(const std::string& componentName, const std::string& tableName, const std::string& key, std::string* value)
+        override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        auto entry = table->second.find(key);
+        value->assign(entry == table->second.end() ? "" : entry->second);
+        return true;
+    }
+
+    bool add(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::string& key,
+        const std::string& value) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        return table != m_tables.end() && table->second.insert({key, value}).second;
+    }
+
+    bool update(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::string& key,
+        const std::string& value) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end() || table->second.find(key) == table->second.end()) {
+            return false;
+        }
+        table->second[key] = value;
+        return true;
+    }
+
+    bool put(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::string& key,
+        const std::string& value) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        table->second[key] = value;
+        return true;
+    }
+
+    bool remove(const std::string& componentName, const std::string& tableName, const std::string& key) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        table->second.erase(key);
+        return true;
+    }
+
+    bool tableEntryExists(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::string& key,
+        bool* tableEntryExistsValue) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        *tableEntryExistsValue = table->second.find(key) != table->second.end();
+        return true;
+    }
+
+    bool tableExists(const std::string& componentName, const std::string& tableName, bool* tableExistsValue)
+        override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        *tableExistsValue = m_tables.find(getTableKey(componentName, tableName)) != m_tables.end();
+        return true;
+    }
+
+    bool load(
+        const std::string& componentName,
+        const std::string& tableName,
+        std::unordered_map<std::string, std::string>* valueContainer) override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto table = m_tables.find(getTableKey(componentName, tableName));
+        if (table == m_tables.end()) {
+            return false;
+        }
+        valueContainer->insert(table->second.begin(), table->second.end());
+        return true;
+    }
+
+private:
+    /**
+     * @return The key of a table
+     */
+    static std::string getTableKey(const std::string& componentName, const std::string& tableName) {
+        return componentName + "/" + tableName;
+    }
+
+    /// Serializes access to @c m_tables
+    std::mutex m_mutex;
+
+    /// The tables, by component and table name
+    std::map<std::string, std::map<std::string, std::string>> m_tables;
+};
+
+}  // namespace test
+}  // namespace smartScreenSDKInterfaces
+}  // namespace alexaSmartScreenSDK
+
+#endif  // ALEXA_SMART_SCREEN_SDK_INTERFACES_TEST_STUBMISCSTORAGE_H_
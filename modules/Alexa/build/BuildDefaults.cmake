@@ -69,6 +69,12 @@ include (Metrics)
 # Setup Captions variables.
 include (Captions)
 
+# Setup Benchmarks variables.
+include (Benchmarks)
+
+# Setup RapidJSON SIMD variables.
+include (RapidJSON)
+
 if (HAS_EXTERNAL_MEDIA_PLAYER_ADAPTERS)
     include (ExternalMediaPlayerAdapters)
 endif()
@@ -0,0 +1,11 @@
+#
+# Setup the Benchmarks compiler options.
+#
+# To build the performance benchmarks, include the following option on the cmake command line.
+#     cmake <path-to-source> -DBENCHMARKS=ON
+#
+option(BENCHMARKS "Build performance benchmarks." OFF)
+
+if(BENCHMARKS)
+    message("Creating ${PROJECT_NAME} with performance benchmarks")
+endif()
@@ -0,0 +1,28 @@
+#
+# Setup the SIMD acceleration of RapidJSON.
+#
+# RapidJSON can skip whitespace with SSE2 or SSE4.2 instructions, which speeds up parsing of large pretty printed
+# payloads such as APL documents.  To enable it, include one of the following options on the cmake command line.
+#     cmake <path-to-source> -DRAPIDJSON_SIMD=SSE2
+#     cmake <path-to-source> -DRAPIDJSON_SIMD=SSE42
+#
+# Every module must be built with the same setting, and the instruction set must be available on the target device.
+#
+set(RAPIDJSON_SIMD "OFF" CACHE STRING "SIMD instruction set used by RapidJSON, options are: OFF, SSE2, or SSE42.")
+set_property(CACHE RAPIDJSON_SIMD PROPERTY STRINGS OFF SSE2 SSE42)
+
+if(RAPIDJSON_SIMD STREQUAL "SSE42")
+    add_definitions("-DRAPIDJSON_SSE42")
+    if(NOT MSVC)
+        add_compile_options("-msse4.2")
+    endif()
+    message("Creating ${PROJECT_NAME} with RapidJSON SSE4.2 acceleration")
+elseif(RAPIDJSON_SIMD STREQUAL "SSE2")
+    add_definitions("-DRAPIDJSON_SSE2")
+    if(NOT MSVC)
+        add_compile_options("-msse2")
+    endif()
+    message("Creating ${PROJECT_NAME} with RapidJSON SSE2 acceleration")
+elseif(NOT RAPIDJSON_SIMD STREQUAL "OFF")
+    message(FATAL_ERROR "Unknown RAPIDJSON_SIMD ${RAPIDJSON_SIMD}. Please select from OFF, SSE2, or SSE42. Quitting!")
+endif()
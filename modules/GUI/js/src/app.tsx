@@ -17,6 +17,7 @@ import {
     IAPLCoreMessage,
     IRenderStaticDocumentMessage,
     IRenderPlayerInfoMessage,
+    IPlayerInfoUpdateMessage,
     IBaseOutboundMessage,
     IRenderTemplateMessage,
     IAlexaStateChangedMessage,
@@ -39,7 +40,7 @@ import {
     IRenderCaptionsMessage
 } from './lib/messages/messages';
 import { PlayerInfoWindow, RENDER_PLAYER_INFO_WINDOW_ID } from './components/PlayerInfoWindow';
-import { resolveRenderTemplate } from './lib/displayCards/AVSDisplayCardHelpers';
+import { applyPlayerInfoUpdate, resolveRenderTemplate } from './lib/displayCards/AVSDisplayCardHelpers';
 import { SDKLogTransport } from './lib/messages/sdkLogTransport';
 import { ILogger, LoggerFactory } from 'apl-client';
 import { FocusManager } from './lib/focus/FocusManager';
@@ -165,6 +166,18 @@ export class App extends React.Component<any, IAppState> {
         });
     }
 
+    protected handlePlayerInfoUpdateMessage(message : IBaseInboundMessage) {
+        const playerInfoUpdateMessage : IPlayerInfoUpdateMessage = message as IPlayerInfoUpdateMessage;
+        const playerInfoMessage : IRenderPlayerInfoMessage = this.state.playerInfoMessage;
+        if (!playerInfoMessage || playerInfoMessage.payload.audioItemId !== playerInfoUpdateMessage.audioItemId) {
+            // The update is for a card which is no longer displayed
+            return;
+        }
+        this.setState({
+            playerInfoMessage : applyPlayerInfoUpdate(playerInfoMessage, playerInfoUpdateMessage)
+        });
+    }
+
     protected handleAPLRender(message : IAPLRenderMessage) {
         let targetWindowId : string = message.windowId ? message.windowId : this.deviceAppConfig.defaultWindowId;
         // Setting the token on the displaying window
@@ -304,6 +317,10 @@ export class App extends React.Component<any, IAppState> {
                 this.handleRenderPlayerInfoMessage(message);
                 break;
             }
+            case 'playerInfoUpdate': {
+                this.handlePlayerInfoUpdateMessage(message);
+                break;
+            }
             case 'clearPlayerInfoCard': {
                 this.handleClearPlayerInfoWindow();
                 break;
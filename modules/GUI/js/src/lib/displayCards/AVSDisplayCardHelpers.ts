@@ -5,6 +5,7 @@
 import {
     IRenderTemplateMessage,
     IRenderPlayerInfoMessage,
+    IPlayerInfoUpdateMessage,
     IExecuteCommandsMessage,
     IRenderStaticDocumentMessage,
     createRenderStaticDocumentMessage,
@@ -85,3 +86,21 @@ export const resolveRenderPlayerInfoCommand = (
     };
     return createExecuteCommandsMessage(RENDER_PLAYER_INFO_KEY, command);
 };
+
+/**
+ * Applies a playerInfoUpdate message to the RenderPlayerInfo message of the displayed card.
+ * The update carries the player state and offset of the audio item the card shows, and the members of its
+ * RenderPlayerInfo payload which changed.
+ *
+ * @param message IRenderPlayerInfoMessage of the displayed card.
+ * @param update IPlayerInfoUpdateMessage for the same audio item.
+ */
+export const applyPlayerInfoUpdate = (
+        message : IRenderPlayerInfoMessage, update : IPlayerInfoUpdateMessage) : IRenderPlayerInfoMessage => {
+    const payload = update.payload ? Object.assign({}, message.payload, update.payload) : message.payload;
+    return Object.assign({}, message, {
+        payload,
+        audioPlayerState : update.audioPlayerState,
+        audioOffset : update.audioOffset
+    });
+};
@@ -60,6 +60,7 @@ export type InboundMessageType =
     | 'focusResponse'
     | 'renderTemplate'
     | 'renderPlayerInfo'
+    | 'playerInfoUpdate'
     | 'clearTemplateCard'
     | 'clearPlayerInfoCard'
     | 'clearDocument'
@@ -113,6 +114,13 @@ export interface IRenderPlayerInfoMessage extends IBaseInboundMessage {
     audioOffset : number;
 }
 
+export interface IPlayerInfoUpdateMessage extends IBaseInboundMessage {
+    audioItemId : string;
+    audioPlayerState : AudioPlayerState;
+    audioOffset : number;
+    payload? : any;
+}
+
 export interface IAPLRenderMessage extends IBaseInboundMessage {
     windowId? : string;
     token : string;